@@ -77,7 +77,18 @@ SOURCES += Sources/main.cpp\
     Sources/Widgets/lavabutton.cpp \
     Sources/Widgets/draftherowindow.cpp \
     Sources/twitchhandler.cpp \
-    Sources/Widgets/twitchbutton.cpp
+    Sources/Widgets/twitchbutton.cpp \
+    Sources/Utils/logpatterns.cpp \
+    Sources/Utils/powertokenizer.cpp \
+    Sources/Utils/powertags.cpp \
+    Sources/Utils/carddb.cpp \
+    Sources/Utils/histmatcher.cpp \
+    Sources/Utils/histcache.cpp \
+    Sources/Utils/screenlocator.cpp \
+    Sources/Synergies/draftedcards.cpp \
+    Sources/Utils/bombsolver.cpp \
+    Sources/Utils/pixmapcache.cpp \
+    Sources/Utils/logsink.cpp
 
 HEADERS  += Sources/mainwindow.h \
     Sources/logloader.h \
@@ -147,7 +158,19 @@ HEADERS  += Sources/mainwindow.h \
     Sources/Widgets/lavabutton.h \
     Sources/Widgets/draftherowindow.h \
     Sources/twitchhandler.h \
-    Sources/Widgets/twitchbutton.h
+    Sources/Widgets/twitchbutton.h \
+    Sources/Utils/logpatterns.h \
+    Sources/Utils/powertokenizer.h \
+    Sources/Utils/powertags.h \
+    Sources/Utils/carddb.h \
+    Sources/Utils/histmatcher.h \
+    Sources/Utils/histcache.h \
+    Sources/Utils/screenlocator.h \
+    Sources/Synergies/synergyfeatures.h \
+    Sources/Synergies/draftedcards.h \
+    Sources/Utils/bombsolver.h \
+    Sources/Utils/pixmapcache.h \
+    Sources/Utils/logsink.h
 
 FORMS    += mainwindow.ui
 
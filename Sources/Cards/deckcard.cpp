@@ -1,6 +1,7 @@
 #include "deckcard.h"
 #include "../utility.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 
@@ -69,9 +70,9 @@ void DeckCard::setCode(QString code)
 
     if(!code.isEmpty())
     {
-        cost = Utility::getCardAttribute(code, "cost").toInt();
+        cost = Utility::getCostFromCode(code);
         type = Utility::getTypeFromCode(code);
-        name = Utility::getCardAttribute(code, "name").toString();
+        name = Utility::cardLocalNameFromCode(code);
         rarity = Utility::getRarityFromCode(code);
         cardClass = Utility::getClassFromCode(code);
         cardRace = Utility::getRaceFromCode(code);
@@ -97,9 +98,9 @@ void DeckCard::setCreatedByCode(QString code)
 
     if(!createdByCode.isEmpty())
     {
-        cost = Utility::getCardAttribute(code, "cost").toInt();
+        cost = Utility::getCostFromCode(code);
         type = Utility::getTypeFromCode(code);
-        name = Utility::getCardAttribute(code, "name").toString();
+        name = Utility::cardLocalNameFromCode(code);
         rarity = Utility::getRarityFromCode(code);
         cardClass = Utility::getClassFromCode(code);
         cardRace = Utility::getRaceFromCode(code);
@@ -143,8 +144,25 @@ void DeckCard::draw()
 }
 
 
+//Todo lo que cambia el dibujo de draw(total...), incluido el tema y la altura de las cartas
+QString DeckCard::drawKey(int total, bool drawRarity, QColor nameColor, bool resize)
+{
+    return "DeckCard|" + code + "|" + name + "|" + QString::number(total) + "|" +
+            QString::number(rarity) + QString::number(type) + QString::number(cardClass) + "|" + QString::number(cost) + "|" +
+            QString::number(drawRarity) + QString::number(resize) + QString::number(outsider) +
+            QString::number(drawClassColor) + QString::number(drawSpellWeaponColor) +
+            QString::number(topManaLimit) + QString::number(bottomManaLimit) + "|" +
+            QString::number(nameColor.rgba()) + "|" + ThemeHandler::themeLoaded() + "|" + QString::number(resize?cardHeight:35);
+}
+
+
+//Las tiras ya dibujadas se guardan en PixmapCache, compartidas por todas las listas (deck, enemy deck, graveyard...)
 QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize)
 {
+    QString key = drawKey(total, drawRarity, nameColor, resize);
+    QPixmap canvas;
+    if(PixmapCache::findCardRender(key, canvas))    return canvas;
+
     QFont font(ThemeHandler::cardsFont());
     font.setBold(true);
     font.setKerning(true);
@@ -154,7 +172,7 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
             font.setLetterSpacing(QFont::AbsoluteSpacing, -1);
 #endif
 
-    QPixmap canvas(CARD_SIZE);
+    canvas = QPixmap(CARD_SIZE);
     canvas.fill(Qt::transparent);
     QPainter painter;
     painter.begin(&canvas);
@@ -166,7 +184,7 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
         //Borders behind
         if(ThemeHandler::manaLimitBehind())
         {
-            QPixmap pixmap(ThemeHandler::manaLimitFile());
+            QPixmap pixmap = PixmapCache::get(ThemeHandler::manaLimitFile());
             int pixmapHMid = pixmap.height()/2;
             int pixmapW = pixmap.width();
             if(topManaLimit)        painter.drawPixmap(0, 0, pixmap, 0, pixmapHMid, pixmapW, pixmapHMid);
@@ -182,8 +200,8 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
         if(total == 1 && rarity != LEGENDARY)   target = QRectF(113,6,100,25);
         else                                    target = QRectF(100,6,100,25);
 
-        if(name == "unknown")   painter.drawPixmap(target, QPixmap(ThemeHandler::unknownFile()), source);
-        else    painter.drawPixmap(target, QPixmap(Utility::hscardsPath() + "/" + code + ".png"), source);
+        if(name == "unknown")   painter.drawPixmap(target, PixmapCache::get(ThemeHandler::unknownFile()), source);
+        else    painter.drawPixmap(target, PixmapCache::card(code), source);
 
         //Background and #cards
         painter.setPen(QPen(BLACK));
@@ -200,12 +218,12 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
         if(total == 1 && rarity != LEGENDARY)
         {
             maxNameLong = 174;
-            painter.drawPixmap(0,0,QPixmap(drawClassColor?ThemeHandler::bgCard1File(cardClass):ThemeHandler::bgCard1File()));
+            painter.drawPixmap(0,0,PixmapCache::get(drawClassColor?ThemeHandler::bgCard1File(cardClass):ThemeHandler::bgCard1File()));
         }
         else
         {
             maxNameLong = 155;
-            painter.drawPixmap(0,0,QPixmap(drawClassColor?ThemeHandler::bgCard2File(cardClass):ThemeHandler::bgCard2File()));
+            painter.drawPixmap(0,0,PixmapCache::get(drawClassColor?ThemeHandler::bgCard2File(cardClass):ThemeHandler::bgCard2File()));
 
             if(total > 1)
             {
@@ -214,7 +232,7 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
             }
             else
             {
-                painter.drawPixmap(195, 8, QPixmap(ThemeHandler::starFile()));
+                painter.drawPixmap(195, 8, PixmapCache::get(ThemeHandler::starFile()));
             }
         }
 
@@ -253,7 +271,7 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
             //Borders front
             if(!ThemeHandler::manaLimitBehind())
             {
-                QPixmap pixmap(ThemeHandler::manaLimitFile());
+                QPixmap pixmap = PixmapCache::get(ThemeHandler::manaLimitFile());
                 int pixmapHMid = pixmap.height()/2;
                 int pixmapW = pixmap.width();
                 if(topManaLimit)        painter.drawPixmap(0, 0, pixmap, 0, pixmapHMid, pixmapW, pixmapHMid);
@@ -263,13 +281,20 @@ QPixmap DeckCard::draw(int total, bool drawRarity, QColor nameColor, bool resize
     painter.end();
 
     //Adapt to size
-    if(resize)  return resizeCardHeight(canvas);
-    else        return canvas;
+    if(resize)  canvas = resizeCardHeight(canvas);
+    PixmapCache::insertCardRender(code, key, canvas);
+    return canvas;
 }
 
 
 QPixmap DeckCard::drawCustomCard(QString customCode, QString customText)
 {
+    QString key = "DeckCardCustom|" + customCode + "|" + customText + "|" + name + "|" + QString::number(type) + "|" +
+            QString::number(outsider) + QString::number(drawSpellWeaponColor) + "|" +
+            ThemeHandler::themeLoaded() + "|" + QString::number(cardHeight);
+    QPixmap canvas;
+    if(PixmapCache::findCardRender(key, canvas))    return canvas;
+
     QFont font(ThemeHandler::cardsFont());
     font.setBold(true);
     font.setKerning(true);
@@ -279,7 +304,7 @@ QPixmap DeckCard::drawCustomCard(QString customCode, QString customText)
         font.setLetterSpacing(QFont::AbsoluteSpacing, -1);
 #endif
 
-    QPixmap canvas(CARD_SIZE);
+    canvas = QPixmap(CARD_SIZE);
     canvas.fill(Qt::transparent);
     QPainter painter;
     painter.begin(&canvas);
@@ -292,21 +317,21 @@ QPixmap DeckCard::drawCustomCard(QString customCode, QString customText)
         QRectF target = QRectF(113,6,100,25);;
         QRectF source;
 
-        QFileInfo cardFI(Utility::hscardsPath() + "/" + customCode + ".png");
-        if(cardFI.exists())
+        QPixmap customPixmap = PixmapCache::card(customCode);
+        if(!customPixmap.isNull())
         {
             if(type==MINION)        source = QRectF(46,72,100,25);
             else                    source = QRectF(46,98,100,25);
-            painter.drawPixmap(target, QPixmap(Utility::hscardsPath() + "/" + customCode + ".png"), source);
+            painter.drawPixmap(target, customPixmap, source);
         }
         else
         {
             source = QRectF(63,18,100,25);
-            painter.drawPixmap(target, QPixmap(ThemeHandler::unknownFile()), source);
+            painter.drawPixmap(target, PixmapCache::get(ThemeHandler::unknownFile()), source);
         }
 
         //Background
-        painter.drawPixmap(0,0,QPixmap(ThemeHandler::handCardBYFile()));
+        painter.drawPixmap(0,0,PixmapCache::get(ThemeHandler::handCardBYFile()));
 
         //BY
         int fontSize = 15;
@@ -339,7 +364,9 @@ QPixmap DeckCard::drawCustomCard(QString customCode, QString customText)
         Utility::drawShadowText(painter, font, name, 14 + customTextWide, 20, false);
     painter.end();
 
-    return resizeCardHeight(canvas);
+    canvas = resizeCardHeight(canvas);
+    PixmapCache::insertCardRender(customCode, key, canvas);
+    return canvas;
 }
 
 
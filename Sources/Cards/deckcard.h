@@ -51,6 +51,7 @@ private:
 //Metodos
 protected:
     QPixmap draw(int total, bool drawRarity, QColor nameColor=BLACK, bool resize=true);
+    QString drawKey(int total, bool drawRarity, QColor nameColor, bool resize);
     QPixmap drawCustomCard(QString customCode, QString customText);
     QColor getRarityColor();
     QPixmap resizeCardHeight(QPixmap &canvas);
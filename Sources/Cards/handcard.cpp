@@ -1,5 +1,6 @@
 #include "handcard.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 
@@ -51,7 +52,7 @@ void HandCard::drawDefaultHandCard()
         painter.setRenderHint(QPainter::TextAntialiasing);
 
         //Background
-        painter.drawPixmap(0,0,QPixmap(this->special?ThemeHandler::handCardBYUnknownFile():ThemeHandler::handCardFile()));
+        painter.drawPixmap(0,0,PixmapCache::get(this->special?ThemeHandler::handCardBYUnknownFile():ThemeHandler::handCardFile()));
 
         //Turn
         font.setPixelSize(25);//18
@@ -1,6 +1,7 @@
 #include "secretcard.h"
 #include "../utility.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 SecretCard::SecretCard() : DeckCard("")
@@ -36,7 +37,7 @@ void SecretCard::draw()
 
         painter.begin(&canvas);
             painter.fillRect(canvas.rect(), Qt::black);
-            painter.drawPixmap(0,0,QPixmap(ThemeHandler::handCardFile()));
+            painter.drawPixmap(0,0,PixmapCache::get(ThemeHandler::handCardFile()));
         painter.end();
     }
 
@@ -45,23 +46,23 @@ void SecretCard::draw()
     switch(hero)
     {
         case MAGE:
-            painter.drawPixmap(25,4,QPixmap(":Images/secretMage.png"));
-            painter.drawPixmap(166,4,QPixmap(":Images/secretMage.png"));
+            painter.drawPixmap(25,4,PixmapCache::get(":Images/secretMage.png"));
+            painter.drawPixmap(166,4,PixmapCache::get(":Images/secretMage.png"));
             break;
 
         case HUNTER:
-            painter.drawPixmap(25,4,QPixmap(":Images/secretHunter.png"));
-            painter.drawPixmap(166,4,QPixmap(":Images/secretHunter.png"));
+            painter.drawPixmap(25,4,PixmapCache::get(":Images/secretHunter.png"));
+            painter.drawPixmap(166,4,PixmapCache::get(":Images/secretHunter.png"));
             break;
 
         case PALADIN:
-            painter.drawPixmap(25,4,QPixmap(":Images/secretPaladin.png"));
-            painter.drawPixmap(166,4,QPixmap(":Images/secretPaladin.png"));
+            painter.drawPixmap(25,4,PixmapCache::get(":Images/secretPaladin.png"));
+            painter.drawPixmap(166,4,PixmapCache::get(":Images/secretPaladin.png"));
             break;
 
         case ROGUE:
-            painter.drawPixmap(25,4,QPixmap(":Images/secretRogue.png"));
-            painter.drawPixmap(166,4,QPixmap(":Images/secretRogue.png"));
+            painter.drawPixmap(25,4,PixmapCache::get(":Images/secretRogue.png"));
+            painter.drawPixmap(166,4,PixmapCache::get(":Images/secretRogue.png"));
             break;
 
         default:
@@ -0,0 +1,83 @@
+#include "draftedcards.h"
+#include <algorithm>
+
+DraftedCards::DraftedCards()
+{
+
+}
+
+
+//Inserta el id manteniendo la lista ordenada y sin repetidos
+void DraftedCards::insertId(QVector<int> &idList, int id)
+{
+    QVector<int>::iterator it = std::lower_bound(idList.begin(), idList.end(), id);
+    if(it == idList.end() || *it != id)     idList.insert(it, id);
+}
+
+
+bool DraftedCards::containsId(const QVector<int> &idList, int id)
+{
+    return std::binary_search(idList.constBegin(), idList.constEnd(), id);
+}
+
+
+void DraftedCards::clear()
+{
+    codes.clear();
+    totals.clear();
+    ids.clear();
+}
+
+
+//Suma una copia del codigo y devuelve su id
+int DraftedCards::add(const QString &code)
+{
+    int id = ids.value(code, -1);
+    if(id == -1)
+    {
+        id = codes.count();
+        ids[code] = id;
+        codes.append(code);
+        totals.append(0);
+    }
+    totals[id]++;
+    return id;
+}
+
+
+int DraftedCards::id(const QString &code) const
+{
+    return ids.value(code, -1);
+}
+
+
+QString DraftedCards::code(int id) const
+{
+    return codes.at(id);
+}
+
+
+int DraftedCards::total(int id) const
+{
+    return totals.at(id);
+}
+
+
+int DraftedCards::count() const
+{
+    return codes.count();
+}
+
+
+//Vuelca los ids marcados en synergies (codigo --> copias), sin pisar los codigos que ya esten
+void DraftedCards::insertCards(const QBitArray &synergyIds, QMap<QString, int> &synergies) const
+{
+    const int numIds = std::min(synergyIds.size(), codes.count());
+    for(int id=0; id<numIds; id++)
+    {
+        if(synergyIds.testBit(id) && !synergies.contains(codes[id]))
+        {
+            synergies[codes[id]] = totals[id];
+        }
+    }
+}
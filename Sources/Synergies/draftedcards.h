@@ -0,0 +1,39 @@
+#ifndef DRAFTEDCARDS_H
+#define DRAFTEDCARDS_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QHash>
+#include <QMap>
+#include <QBitArray>
+
+
+//Mazo draftado compacto: cada codigo distinto recibe un id (su indice) y se guarda su numero de copias.
+//Los contadores de sinergias (DraftItemCounter, StatSynergies) guardan listas ordenadas de estos ids
+//en vez de copias de DeckCard.
+class DraftedCards
+{
+public:
+    DraftedCards();
+
+//Variables
+private:
+    QStringList codes;
+    QVector<int> totals;
+    QHash<QString, int> ids;
+
+//Metodos
+public:
+    static void insertId(QVector<int> &idList, int id);
+    static bool containsId(const QVector<int> &idList, int id);
+    void clear();
+    int add(const QString &code);
+    int id(const QString &code) const;
+    QString code(int id) const;
+    int total(int id) const;
+    int count() const;
+    void insertCards(const QBitArray &synergyIds, QMap<QString, int> &synergies) const;
+};
+
+#endif // DRAFTEDCARDS_H
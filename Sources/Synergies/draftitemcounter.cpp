@@ -24,6 +24,8 @@ DraftItemCounter::DraftItemCounter(QObject *parent, QGridLayout *gridLayout, int
 
 void DraftItemCounter::init(QHBoxLayout *hLayout, bool iconHover)
 {
+    draftedCards = new DraftedCards();
+    ownDraftedCards = true;
     labelIcon = new HoverLabel();
     labelCounter = new QLabel();
     hLayout->addWidget(labelIcon);
@@ -45,6 +47,8 @@ DraftItemCounter::DraftItemCounter(QObject *parent) : QObject(parent)
 {
     labelIcon = nullptr;
     labelCounter = nullptr;
+    draftedCards = new DraftedCards();
+    ownDraftedCards = true;
     reset();
 }
 
@@ -53,6 +57,26 @@ DraftItemCounter::~DraftItemCounter()
 {
     if(labelIcon != nullptr)       delete labelIcon;
     if(labelCounter != nullptr)    delete labelCounter;
+    if(ownDraftedCards)            delete draftedCards;
+}
+
+
+//Con el mazo de SynergyHandler compartido, SynergyHandler suma las copias de cada carta draftada
+//y los contadores solo guardan sus ids. Sin mazo compartido (DraftMechanicsWindow) cada increase cuenta una copia.
+void DraftItemCounter::setDraftedCards(DraftedCards *draftedCards)
+{
+    if(ownDraftedCards)     delete this->draftedCards;
+    this->draftedCards = draftedCards;
+    this->ownDraftedCards = false;
+    reset();
+}
+
+
+int DraftItemCounter::getId(const QString &code)
+{
+    int id = draftedCards->id(code);
+    if(id == -1 && ownDraftedCards)     id = draftedCards->add(code);
+    return id;
 }
 
 
@@ -76,8 +100,9 @@ void DraftItemCounter::setTheme(QPixmap pixmap, int iconWidth, bool inDraftMecha
 void DraftItemCounter::reset()
 {
     this->counter = 0;
-    this->deckCardList.clear();
-    this->deckCardListSyn.clear();
+    this->cardIds.clear();
+    this->cardIdsSyn.clear();
+    if(ownDraftedCards)     draftedCards->clear();
 
     if(labelIcon != nullptr && labelCounter != nullptr)
     {
@@ -135,22 +160,8 @@ void DraftItemCounter::increase(int numIncrease, int draftedCardsCount)
 }
 void DraftItemCounter::increase(const QString &code, bool count)
 {
-    bool duplicatedCard = false;
-    for(DeckCard &deckCard: deckCardList)
-    {
-        if(deckCard.getCode() == code)
-        {
-            deckCard.total++;
-            deckCard.remaining = deckCard.total;
-            duplicatedCard = true;
-            break;
-        }
-    }
-
-    if(!duplicatedCard)
-    {
-        deckCardList.append(DeckCard(code));
-    }
+    int id = (ownDraftedCards?draftedCards->add(code):draftedCards->id(code));
+    if(id != -1)    DraftedCards::insertId(cardIds, id);
 
     if(labelIcon != nullptr && labelCounter != nullptr && count)
     {
@@ -167,64 +178,34 @@ void DraftItemCounter::increase(const QString &code, bool count)
 
 void DraftItemCounter::increaseSyn(const QString &code)
 {
-    bool duplicatedCard = false;
-    for(DeckCard &deckCard: deckCardListSyn)
-    {
-        if(deckCard.getCode() == code)
-        {
-            deckCard.total++;
-            deckCard.remaining = deckCard.total;
-            duplicatedCard = true;
-            break;
-        }
-    }
-
-    if(!duplicatedCard)
-    {
-        deckCardListSyn.append(DeckCard(code));
-    }
+    int id = getId(code);
+    if(id != -1)    DraftedCards::insertId(cardIdsSyn, id);
 }
 
 
-bool DraftItemCounter::insertCode(const QString code, QMap<QString,int> &synergies)
+bool DraftItemCounter::insertCode(const QString &code, QBitArray &synergyIds)
 {
-    for(DeckCard &deckCard: deckCardList)
-    {
-        if(code == deckCard.getCode())
-        {
-            if(!synergies.contains(code))
-            {
-                synergies[code] = deckCard.total;
-            }
-            return true;
-        }
-    }
-    return false;
+    int id = draftedCards->id(code);
+    if(id == -1 || !DraftedCards::containsId(cardIds, id))  return false;
+    if(id < synergyIds.size())  synergyIds.setBit(id);
+    return true;
 }
 
 
-void DraftItemCounter::insertCards(QMap<QString,int> &synergies)
+void DraftItemCounter::insertCards(QBitArray &synergyIds)
 {
-    for(DeckCard &deckCard: deckCardList)
+    for(const int id: cardIds)
     {
-        QString code = deckCard.getCode();
-        if(!synergies.contains(code))
-        {
-            synergies[code] = deckCard.total;
-        }
+        if(id < synergyIds.size())  synergyIds.setBit(id);
     }
 }
 
 
-void DraftItemCounter::insertSynCards(QMap<QString,int> &synergies)
+void DraftItemCounter::insertSynCards(QBitArray &synergyIds)
 {
-    for(DeckCard &deckCard: deckCardListSyn)
+    for(const int id: cardIdsSyn)
     {
-        QString code = deckCard.getCode();
-        if(!synergies.contains(code))
-        {
-            synergies[code] = deckCard.total;
-        }
+        if(id < synergyIds.size())  synergyIds.setBit(id);
     }
 }
 
@@ -241,8 +222,28 @@ int DraftItemCounter::count()
 }
 
 
+//Cada codigo repetido tantas veces como copias
+QStringList DraftItemCounter::getCodes()
+{
+    QStringList codes;
+    for(const int id: cardIds)
+    {
+        QString code = draftedCards->code(id);
+        for(int i=0; i<draftedCards->total(id); i++)    codes.append(code);
+    }
+    return codes;
+}
+
+
 QList<DeckCard> DraftItemCounter::getDeckCardList()
 {
+    QList<DeckCard> deckCardList;
+    for(const int id: cardIds)
+    {
+        DeckCard deckCard(draftedCards->code(id));
+        deckCard.total = deckCard.remaining = draftedCards->total(id);
+        deckCardList.append(deckCard);
+    }
     return deckCardList;
 }
 
@@ -254,7 +255,7 @@ void DraftItemCounter::sendIconEnter()
     QRect labelRect = QRect(topLeft, bottomRight);
 
     QMap<int,DeckCard> deckCardMap;
-    for(DeckCard &deckCard: deckCardList)   deckCardMap.insertMulti(deckCard.getCost(), deckCard);
+    for(DeckCard &deckCard: getDeckCardList())  deckCardMap.insertMulti(deckCard.getCost(), deckCard);
     QList<DeckCard> deckCardOrderedList = deckCardMap.values();
 
     emit iconEnter(deckCardOrderedList, labelRect);
@@ -4,8 +4,10 @@
 #include <QObject>
 #include <QLabel>
 #include <QHBoxLayout>
+#include <QBitArray>
 #include "../Widgets/hoverlabel.h"
 #include "../utility.h"
+#include "draftedcards.h"
 
 class DraftItemCounter : public QObject
 {
@@ -21,23 +23,28 @@ private:
     HoverLabel *labelIcon;
     QLabel *labelCounter;
     int counter;
-    QList<DeckCard> deckCardList, deckCardListSyn;
+    DraftedCards *draftedCards;
+    bool ownDraftedCards;
+    QVector<int> cardIds, cardIdsSyn;  //Ids ordenados en draftedCards
 
 //Metodos
 private:
     void init(QHBoxLayout *hLayout, bool iconHover);
+    int getId(const QString &code);
 
 public:
     void reset();
+    void setDraftedCards(DraftedCards *draftedCards);
     void setTransparency(Transparency transparency, bool mouseInApp);
     void increase(int numIncrease, int draftedCardsCount);
     void increase(const QString &code, bool count=true);
     bool isEmpty();
-    bool insertCode(const QString code, QMap<QString, int> &synergies);
-    void insertCards(QMap<QString, int> &synergies);
+    bool insertCode(const QString &code, QBitArray &synergyIds);
+    void insertCards(QBitArray &synergyIds);
     void increaseSyn(const QString &code);
-    void insertSynCards(QMap<QString, int> &synergies);
+    void insertSynCards(QBitArray &synergyIds);
     int count();
+    QStringList getCodes();
     QList<DeckCard> getDeckCardList();
     void setTheme(QPixmap pixmap, int iconWidth=32, bool inDraftMechanicsWindow=false);
     void setIcon(QPixmap pixmap, int iconWidth=32);
@@ -3,7 +3,14 @@
 
 StatSynergies::StatSynergies()
 {
+    draftedCards = nullptr;
+}
+
 
+//Mazo de SynergyHandler, las copias de cada carta se suman alli
+void StatSynergies::setDraftedCards(DraftedCards *draftedCards)
+{
+    this->draftedCards = draftedCards;
 }
 
 
@@ -39,62 +46,47 @@ void StatSynergies::updateStatsMapSyn(const StatSyn &statSyn, QString &code)
 
 void StatSynergies::appendStatValue(bool appendToSyn, int statValue, QString &code)
 {
-    QMap<int, QList<DeckCard>> &statsMap = (appendToSyn?this->statsMapSyn:this->statsMap);
-
-    bool duplicatedCard = false;
-    for(DeckCard &deckCard: statsMap[statValue])
-    {
-        if(deckCard.getCode() == code)
-        {
-            deckCard.total++;
-            deckCard.remaining = deckCard.total;
-            duplicatedCard = true;
-            break;
-        }
-    }
+    if(draftedCards == nullptr)     return;
+    int id = draftedCards->id(code);
+    if(id == -1)    return;
 
-    if(!duplicatedCard)
-    {
-        statsMap[statValue].append(DeckCard(code));
-    }
+    QMap<int, QVector<int>> &statsMap = (appendToSyn?this->statsMapSyn:this->statsMap);
+    DraftedCards::insertId(statsMap[statValue], id);
 }
 
 
-void StatSynergies::insertStatCards(const StatSyn &statSyn, QMap<QString,int> &synergies)
+void StatSynergies::insertStatCards(const StatSyn &statSyn, QBitArray &synergyIds)
 {
     switch(statSyn.op)
     {
         case S_EQUAL:
-            insertCards(false, statSyn.statValue, synergies);
+            insertCards(false, statSyn.statValue, synergyIds);
         break;
         case S_LOWER_IGUAL:
             for(int i = statSyn.statValue; i >= 0; i--)
             {
-                insertCards(false, i, synergies);
+                insertCards(false, i, synergyIds);
             }
         break;
         case S_HIGHER_EQUAL:
             for(int i = statSyn.statValue; i <= 15; i++)
             {
-                insertCards(false, i, synergies);
+                insertCards(false, i, synergyIds);
             }
         break;
     }
 }
 
 
-void StatSynergies::insertCards(bool insertSyn, int statValue, QMap<QString,int> &synergies)
+void StatSynergies::insertCards(bool insertSyn, int statValue, QBitArray &synergyIds)
 {
-    QMap<int, QList<DeckCard>> &statsMap = (insertSyn?this->statsMapSyn:this->statsMap);
-    if(!statsMap.contains(statValue))    return;
+    QMap<int, QVector<int>> &statsMap = (insertSyn?this->statsMapSyn:this->statsMap);
+    QMap<int, QVector<int>>::const_iterator it = statsMap.constFind(statValue);
+    if(it == statsMap.constEnd())   return;
 
-    for(DeckCard &deckCard: statsMap[statValue])
+    for(const int id: it.value())
     {
-        QString code = deckCard.getCode();
-        if(!synergies.contains(code))
-        {
-            synergies[code] = deckCard.total;
-        }
+        if(id < synergyIds.size())  synergyIds.setBit(id);
     }
 }
 
@@ -105,9 +97,9 @@ void StatSynergies::qDebugContents()
     for(const int key: statsMap.keys())
     {
         qDebug()<<'['<<key<<']'<<endl;
-        for(DeckCard &deckCard: statsMap[key])
+        for(const int id: statsMap[key])
         {
-            qDebug()<<'\t'<<deckCard.getName();
+            qDebug()<<'\t'<<DeckCard(draftedCards->code(id)).getName();
         }
     }
 
@@ -115,9 +107,9 @@ void StatSynergies::qDebugContents()
     for(const int key: statsMapSyn.keys())
     {
         qDebug()<<'['<<key<<']'<<endl;
-        for(DeckCard &deckCard: statsMapSyn[key])
+        for(const int id: statsMapSyn[key])
         {
-            qDebug()<<'\t'<<deckCard.getName();
+            qDebug()<<'\t'<<DeckCard(draftedCards->code(id)).getName();
         }
     }
 }
@@ -2,7 +2,9 @@
 #define STATSYNERGIES_H
 
 #include <QObject>
+#include <QBitArray>
 #include "../Cards/deckcard.h"
+#include "draftedcards.h"
 
 
 enum SynergyStat {S_COST, S_ATTACK, S_HEALTH};
@@ -28,17 +30,19 @@ public:
 
 //Variables
 private:
-    QMap<int, QList<DeckCard>> statsMap, statsMapSyn;
+    DraftedCards *draftedCards;
+    QMap<int, QVector<int>> statsMap, statsMapSyn;     //[statValue] --> Ids ordenados en draftedCards
 
 //Metodos
 public:
     static QList<StatSyn> getStatsSynergiesFromJson(const QString &code, QMap<QString, QList<QString> > &synergyCodes);
+    void setDraftedCards(DraftedCards *draftedCards);
     void clear();
     void qDebugContents();
     void updateStatsMapSyn(const StatSyn &statSyn, QString &code);
     void appendStatValue(bool appendToSyn, int statValue, QString &code);
-    void insertStatCards(const StatSyn &statSyn, QMap<QString, int> &synergies);
-    void insertCards(bool insertSyn, int statValue, QMap<QString, int> &synergies);
+    void insertStatCards(const StatSyn &statSyn, QBitArray &synergyIds);
+    void insertCards(bool insertSyn, int statValue, QBitArray &synergyIds);
 };
 
 #endif // STATSYNERGIES_H
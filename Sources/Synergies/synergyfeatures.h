@@ -0,0 +1,42 @@
+#ifndef SYNERGYFEATURES_H
+#define SYNERGYFEATURES_H
+
+#include <QtGlobal>
+#include <bitset>
+
+
+//Un flag por cada predicado is*Gen/is*Syn de SynergyHandler
+enum SynergyFeature {F_SPELL_GEN, F_WEAPON_GEN, F_MURLOC_GEN, F_DEMON_GEN, F_MECH_GEN, F_ELEMENTAL_GEN, F_BEAST_GEN, F_TOTEM_GEN,
+                    F_PIRATE_GEN, F_DRAGON_GEN, F_DISCOVER_DRAW_GEN, F_DISCOVER_GEN, F_DRAW_GEN, F_TO_YOUR_HAND_GEN, F_TAUNT,
+                    F_TAUNT_GEN, F_AOE_GEN, F_DAMAGE_MINIONS_GEN, F_DESTROY_GEN, F_PING_GEN, F_REACH_GEN, F_ENRAGE_GEN,
+                    F_OVERLOAD, F_JADE_GOLEM_GEN, F_SECRET, F_SECRET_GEN, F_ECHO, F_ECHO_GEN, F_RUSH, F_RUSH_GEN, F_MAGNETIC,
+                    F_MAGNETIC_GEN, F_EGG_GEN, F_DAMAGE_FRIENDLY_HERO_GEN, F_FREEZE_ENEMY_GEN, F_DISCARD_GEN,
+                    F_DEATHRATTLE_MINION, F_DEATHRATTLE_GOOD_ALL, F_BATTLECRY, F_SILENCE_OWN_GEN, F_TAUNT_GIVER_GEN, F_TOKEN_GEN,
+                    F_TOKEN_CARD_GEN, F_COMBO_GEN, F_WINDFURY_MINION, F_ATTACK_BUFF_GEN, F_HEALTH_BUFF_GEN, F_RETURN_GEN,
+                    F_STEALTH_GEN, F_DIVINE_SHIELD, F_DIVINE_SHIELD_GEN, F_RESTORE_TARGET_MINION_GEN,
+                    F_RESTORE_FRIENDLY_HERO_GEN, F_RESTORE_FRIENDLY_MINION_GEN, F_ARMOR_GEN, F_LIFESTEAL_MINION,
+                    F_SPELL_DAMAGE_GEN, F_EVOLVE_GEN, F_SPAWN_ENEMY_GEN, F_MURLOC_SYN, F_DEMON_SYN, F_MECH_SYN, F_ELEMENTAL_SYN,
+                    F_BEAST_SYN, F_TOTEM_SYN, F_PIRATE_SYN, F_DRAGON_SYN, F_MURLOC_ALL_SYN, F_DEMON_ALL_SYN, F_MECH_ALL_SYN,
+                    F_ELEMENTAL_ALL_SYN, F_BEAST_ALL_SYN, F_TOTEM_ALL_SYN, F_PIRATE_ALL_SYN, F_DRAGON_ALL_SYN, F_DISCOVER_SYN,
+                    F_DRAW_SYN, F_TO_YOUR_HAND_SYN, F_SPELL_SYN, F_SPELL_ALL_SYN, F_WEAPON_SYN, F_WEAPON_ALL_SYN, F_ENRAGE_SYN,
+                    F_OVERLOAD_SYN, F_PING_SYN, F_AOE_SYN, F_TAUNT_SYN, F_TAUNT_ALL_SYN, F_SECRET_SYN, F_SECRET_ALL_SYN,
+                    F_ECHO_SYN, F_ECHO_ALL_SYN, F_RUSH_SYN, F_RUSH_ALL_SYN, F_MAGNETIC_SYN, F_MAGNETIC_ALL_SYN, F_EGG_SYN,
+                    F_DAMAGE_FRIENDLY_HERO_SYN, F_FREEZE_ENEMY_SYN, F_DISCARD_SYN, F_DEATHRATTLE_SYN, F_DEATHRATTLE_GOOD_ALL_SYN,
+                    F_BATTLECRY_SYN, F_SILENCE_OWN_SYN, F_TAUNT_GIVER_SYN, F_TOKEN_SYN, F_TOKEN_CARD_SYN, F_COMBO_SYN,
+                    F_WINDFURY_MINION_SYN, F_ATTACK_BUFF_SYN, F_HEALTH_BUFF_SYN, F_RETURN_SYN, F_STEALTH_SYN,
+                    F_DIVINE_SHIELD_SYN, F_DIVINE_SHIELD_ALL_SYN, F_RESTORE_TARGET_MINION_SYN, F_RESTORE_FRIENDLY_HERO_SYN,
+                    F_RESTORE_FRIENDLY_MINION_SYN, F_ARMOR_SYN, F_LIFESTEAL_MINION_SYN, F_SPELL_DAMAGE_SYN, F_EVOLVE_SYN,
+                    F_SPAWN_ENEMY_SYN, F_NUM_FEATURES};
+
+
+//Features de sinergias de una carta, se calculan una vez (SynergyHandler::computeFeatures)
+class CardSynergyFeatures
+{
+public:
+    std::bitset<F_NUM_FEATURES> flags;
+    quint8 numDiscover = 0, numDraw = 0, numToYourHand = 0;
+
+    bool has(SynergyFeature feature) const {return flags.test(feature);}
+};
+
+#endif // SYNERGYFEATURES_H
@@ -0,0 +1,231 @@
+#include "bombsolver.h"
+#include <QtWidgets>
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+
+//Palabra de la clave donde esta un digito: un quint64 solo tiene la 0
+static inline quint64 &keyWord(quint64 &key, int word)
+{
+    Q_UNUSED(word);
+    return key;
+}
+
+
+static inline quint64 keyWord(const quint64 &key, int word)
+{
+    Q_UNUSED(word);
+    return key;
+}
+
+
+static inline quint64 &keyWord(BombKey &key, int word)
+{
+    return key.words[word];
+}
+
+
+static inline quint64 keyWord(const BombKey &key, int word)
+{
+    return key.words[word];
+}
+
+
+BombSolver::BombSolver(const QList<int> &targets, int missiles)
+{
+    numTargets = targets.count();
+    numGroups = 0;
+    wideKey = false;
+
+    //Con mas vida que misiles no puede morir, todas esas vidas son equivalentes
+    QList<int> healths;
+    for(const int target: targets)  healths.append(std::max(0, std::min(target, missiles+1)));
+
+    slotHealths = healths.toVector();
+    std::sort(slotHealths.begin(), slotHealths.end(), std::greater<int>());
+
+    for(int slot=0; slot<numTargets; slot++)
+    {
+        if(slot == 0 || slotHealths[slot] != slotHealths[slot-1])
+        {
+            groupStarts.append(slot);
+            groupSizes.append(0);
+            numGroups++;
+        }
+        groupSizes[numGroups-1]++;
+    }
+
+    for(const int health: healths)
+    {
+        int group = 0;
+        while(slotHealths[groupStarts[group]] != health)    group++;
+        targetGroups.append(group);
+    }
+
+    //Base mixta; los digitos que no caben en la primera palabra pasan a la segunda (BombKey).
+    //Solo si tampoco caben en 128 bits el solver no es valido.
+    quint64 weight = 1;
+    int word = 0;
+    for(int slot=0; slot<numTargets; slot++)
+    {
+        quint64 radix = static_cast<quint64>(slotHealths[slot] + 1);
+        if(weight > std::numeric_limits<quint64>::max()/radix)
+        {
+            if(word == 1)
+            {
+                slotWeights.clear();
+                slotWords.clear();
+                return;
+            }
+            word = 1;
+            weight = 1;
+            wideKey = true;
+        }
+        slotWeights.append(weight);
+        slotWords.append(word);
+        weight *= radix;
+    }
+}
+
+
+bool BombSolver::isValid() const
+{
+    return numTargets > 0 && slotWeights.count() == numTargets;
+}
+
+
+template<typename Key> Key BombSolver::initialState() const
+{
+    Key key = Key();
+    for(int slot=0; slot<numTargets; slot++)
+    {
+        keyWord(key, slotWords[slot]) += static_cast<quint64>(slotHealths[slot]) * slotWeights[slot];
+    }
+    return key;
+}
+
+
+template<typename Key> void BombSolver::decode(const Key &key, QVector<int> &values) const
+{
+    for(int slot=0; slot<numTargets; slot++)
+    {
+        values[slot] = static_cast<int>((keyWord(key, slotWords[slot]) / slotWeights[slot]) %
+                                        static_cast<quint64>(slotHealths[slot] + 1));
+    }
+}
+
+
+//Un misil. maxHealth es la vida maxima que importa despues de este misil (misiles restantes + 1).
+//Dentro de un grupo los objetivos con la misma vida dan el mismo estado: se golpea el ultimo de ellos,
+//que mantiene el orden del grupo, con la probabilidad de todos.
+template<typename Key> void BombSolver::bomb(const QHash<Key, double> &oldStates, QHash<Key, double> &newStates,
+                                             int maxHealth, QVector<int> &values) const
+{
+    newStates.clear();
+    newStates.reserve(oldStates.count()*2);
+
+    for(typename QHash<Key, double>::const_iterator it=oldStates.constBegin(); it!=oldStates.constEnd(); it++)
+    {
+        const Key oldKey = it.key();
+        decode(oldKey, values);
+
+        int livingTargets = 0;
+        Key cappedKey = oldKey;
+        for(int slot=0; slot<numTargets; slot++)
+        {
+            if(values[slot] > 0)            livingTargets++;
+            if(values[slot] > maxHealth)    keyWord(cappedKey, slotWords[slot]) -= slotWeights[slot];
+        }
+
+        if(livingTargets == 0)
+        {
+            newStates[oldKey] += it.value();
+            continue;
+        }
+
+        const double prob = it.value()/livingTargets;
+        for(int group=0; group<numGroups; group++)
+        {
+            const int groupEnd = groupStarts[group] + groupSizes[group];
+            for(int slot=groupStarts[group]; slot<groupEnd;)
+            {
+                const int health = values[slot];
+                int runEnd = slot;
+                while(runEnd < groupEnd && values[runEnd] == health)  runEnd++;
+
+                if(health > 0)
+                {
+                    //Por encima de maxHealth el golpe no cambia el estado recortado
+                    Key newKey = cappedKey;
+                    if(health <= maxHealth)     keyWord(newKey, slotWords[runEnd-1]) -= slotWeights[runEnd-1];
+                    newStates[newKey] += prob*(runEnd - slot);
+                }
+                slot = runEnd;
+            }
+        }
+    }
+}
+
+
+//Los objetivos de un grupo son simetricos: todos tienen la media de muertos del grupo
+template<typename Key> QList<float> BombSolver::getDeadProbs(const QHash<Key, double> &states) const
+{
+    QVector<double> groupDeads(numGroups, 0);
+    QVector<int> values(numTargets);
+
+    for(typename QHash<Key, double>::const_iterator it=states.constBegin(); it!=states.constEnd(); it++)
+    {
+        decode(it.key(), values);
+        for(int group=0; group<numGroups; group++)
+        {
+            const int groupEnd = groupStarts[group] + groupSizes[group];
+            for(int slot=groupStarts[group]; slot<groupEnd; slot++)
+            {
+                if(values[slot] == 0)   groupDeads[group] += it.value();
+            }
+        }
+    }
+
+    QList<float> deadProbs;
+    for(int target=0; target<numTargets; target++)
+    {
+        const int group = targetGroups[target];
+        deadProbs.append(static_cast<float>(groupDeads[group]/groupSizes[group]));
+    }
+    return deadProbs;
+}
+
+
+template<typename Key> QList<float> BombSolver::solve(int missiles, const QAtomicInt *generation, int jobGeneration) const
+{
+    QHash<Key, double> states, newStates;
+    QVector<int> values(numTargets);
+    states[initialState<Key>()] = 1;
+
+    for(int missile=0; missile<missiles; missile++)
+    {
+        if(generation != nullptr && generation->load() != jobGeneration)    return QList<float>();
+
+        bomb<Key>(states, newStates, missiles - missile, values);
+        states.swap(newStates);
+    }
+
+    return getDeadProbs<Key>(states);
+}
+
+
+//Si generation deja de valer jobGeneration se abandona el calculo y se devuelve una lista vacia.
+QList<float> BombSolver::deadProbs(const QList<int> &targets, int missiles, const QAtomicInt *generation, int jobGeneration)
+{
+    missiles = std::max(missiles, 0);
+    BombSolver solver(targets, missiles);
+    if(!solver.isValid())
+    {
+        qDebug() << "BombSolver: Board too big:" << targets.count() << "targets" << missiles << "missiles";
+        return QList<float>();
+    }
+
+    if(solver.wideKey)  return solver.solve<BombKey>(missiles, generation, jobGeneration);
+    else                return solver.solve<quint64>(missiles, generation, jobGeneration);
+}
@@ -0,0 +1,67 @@
+#ifndef BOMBSOLVER_H
+#define BOMBSOLVER_H
+
+#include <QList>
+#include <QVector>
+#include <QHash>
+#include <QAtomicInt>
+
+
+//Clave de 128 bits para los tableros cuyo estado no cabe en un quint64 (16 objetivos con mucha vida y misiles)
+class BombKey
+{
+public:
+    quint64 words[2];
+
+    BombKey()
+    {
+        words[0] = words[1] = 0;
+    }
+    bool operator==(const BombKey &other) const
+    {
+        return words[0] == other.words[0] && words[1] == other.words[1];
+    }
+};
+
+inline uint qHash(const BombKey &key, uint seed = 0)
+{
+    return qHashBits(key.words, sizeof(key.words), seed);
+}
+
+
+//Probabilidad exacta de que muera cada objetivo con misiles aleatorios (Arcane Missiles, Avenging Wrath, Mad Bomber...).
+//Cada misil golpea a un objetivo vivo al azar. targets son los golpes que aguanta cada objetivo.
+//
+//Cada estado es la vida restante de todos los objetivos empaquetada en un quint64 (base mixta, un digito por objetivo).
+//Si los digitos no caben en 64 bits se reparten en las dos palabras de un BombKey.
+//Los objetivos con la misma vida inicial son intercambiables: se guardan ordenados dentro de su grupo,
+//asi los estados simetricos son uno solo. La vida por encima de los misiles que quedan no importa y se recorta.
+class BombSolver
+{
+//Variables
+private:
+    int numTargets, numGroups;
+    QVector<int> slotHealths;               //Vida inicial (recortada) de cada digito, ordenada de mayor a menor
+    QVector<quint64> slotWeights;           //Peso de cada digito dentro de su palabra de la clave
+    QVector<int> slotWords;                 //Palabra de la clave de cada digito (0, o 1 con BombKey)
+    bool wideKey;
+    QVector<int> groupStarts, groupSizes;   //Digitos de cada grupo de vida inicial
+    QVector<int> targetGroups;              //Grupo de cada objetivo
+
+//Metodos
+private:
+    BombSolver(const QList<int> &targets, int missiles);
+    bool isValid() const;
+    template<typename Key> Key initialState() const;
+    template<typename Key> void decode(const Key &key, QVector<int> &values) const;
+    template<typename Key> void bomb(const QHash<Key, double> &oldStates, QHash<Key, double> &newStates,
+                                     int maxHealth, QVector<int> &values) const;
+    template<typename Key> QList<float> getDeadProbs(const QHash<Key, double> &states) const;
+    template<typename Key> QList<float> solve(int missiles, const QAtomicInt *generation, int jobGeneration) const;
+
+public:
+    static QList<float> deadProbs(const QList<int> &targets, int missiles,
+                                  const QAtomicInt *generation=nullptr, int jobGeneration=0);
+};
+
+#endif // BOMBSOLVER_H
@@ -0,0 +1,682 @@
+#include "carddb.h"
+#include <QJsonValue>
+#include <QFile>
+#include <algorithm>
+
+
+CardDB::CardDB()
+{
+    localLang = "enUS";
+}
+
+
+CardDB::~CardDB()
+{
+    clear();
+}
+
+
+void CardDB::clear()
+{
+    codeIndex.clear();
+    codes.clear();
+    rawCards.clear();
+    costs.clear();
+    attacks.clear();
+    healths.clear();
+    durabilities.clear();
+    armors.clear();
+    overloads.clear();
+    spellDamages.clear();
+    types.clear();
+    rarities.clear();
+    cardClasses.clear();
+    races.clear();
+    sets.clear();
+    dbfIds.clear();
+    collectibles.clear();
+    hasCosts.clear();
+    mechanics.clear();
+    referencedTags.clear();
+    enNames.clear();
+    enTexts.clear();
+    enLowerTexts.clear();
+    localNames.clear();
+    localTexts.clear();
+    setNames.clear();
+    setIds.clear();
+    tagNames.clear();
+    tagIds.clear();
+    enNameIndexes.clear();
+    localNameIndexes.clear();
+    dbfIdIndexes.clear();
+    setIndexes.clear();
+    collectibleIndexes.clear();
+    sortedIndexes.clear();
+}
+
+
+void CardDB::load(const QJsonArray &jsonArray)
+{
+    clear();
+
+    int size = jsonArray.size();
+    codeIndex.reserve(size);
+    for(QVector<qint16> *column: {&costs, &attacks, &healths, &durabilities, &armors, &overloads, &spellDamages})
+    {
+        column->reserve(size);
+    }
+
+    for(const QJsonValue &jsonCard: jsonArray)    appendCard(jsonCard.toObject());
+    buildIndexes();
+}
+
+
+//La cache solo vale para la misma version de cards.json (setting cardsJsonVersion).
+//Las columnas se leen tal cual, sin pasar por QJsonObject. Los nombres y textos locales se guardan
+//en el idioma de quien la escribio; si localLang es otro se rehacen desde rawCards.
+bool CardDB::loadCache(const QString &path, const QString &cardsJsonVersion)
+{
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly))     return false;
+    QByteArray data = file.readAll();
+    file.close();
+
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_5_0);
+    quint32 magic, format;
+    QString version, cacheLang;
+    stream >> magic >> format;
+    if(stream.status() != QDataStream::Ok || magic != CARDDB_CACHE_MAGIC || format != CARDDB_CACHE_FORMAT)  return false;
+    stream >> version >> cacheLang;
+    if(stream.status() != QDataStream::Ok || version != cardsJsonVersion)     return false;
+
+    clear();
+    stream >> setNames >> tagNames >> codes >> rawCards
+           >> costs >> attacks >> healths >> durabilities >> armors >> overloads >> spellDamages;
+    readEnums<CardType>(stream, types);
+    readEnums<CardRarity>(stream, rarities);
+    readEnums<CardClass>(stream, cardClasses);
+    readEnums<CardRace>(stream, races);
+    stream >> sets >> dbfIds >> collectibles >> hasCosts;
+    readTags(stream, mechanics);
+    readTags(stream, referencedTags);
+    stream >> enNames >> enTexts >> enLowerTexts >> localNames >> localTexts;
+
+    int size = codes.count();
+    bool ok = stream.status() == QDataStream::Ok && tagNames.count() <= CARDDB_MAX_TAGS;
+    for(const QVector<qint16> *column: {&costs, &attacks, &healths, &durabilities, &armors, &overloads, &spellDamages})
+    {
+        ok = ok && column->count() == size;
+    }
+    ok = ok && rawCards.count() == size && types.count() == size && rarities.count() == size &&
+            cardClasses.count() == size && races.count() == size && sets.count() == size &&
+            dbfIds.count() == size && collectibles.count() == size && hasCosts.count() == size &&
+            mechanics.count() == size && referencedTags.count() == size && enNames.count() == size &&
+            enTexts.count() == size && enLowerTexts.count() == size && localNames.count() == size && localTexts.count() == size;
+    for(int i=0; ok && i<size; i++)     ok = sets[i] >= 0 && sets[i] < setNames.count();
+    if(!ok)
+    {
+        clear();
+        return false;
+    }
+
+    codeIndex.reserve(size);
+    for(int i=0; i<size; i++)   codeIndex[codes[i]] = i;
+    for(int i=0; i<setNames.count(); i++)   setIds[setNames[i]] = i;
+    for(int i=0; i<tagNames.count(); i++)   tagIds[tagNames[i]] = i;
+
+    buildIndexes();
+    if(cacheLang != localLang)  fillLocalColumns();
+    return true;
+}
+
+
+bool CardDB::saveCache(const QString &path, const QString &cardsJsonVersion) const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << static_cast<quint32>(CARDDB_CACHE_MAGIC) << static_cast<quint32>(CARDDB_CACHE_FORMAT)
+           << cardsJsonVersion << localLang;
+    stream << setNames << tagNames << codes << rawCards
+           << costs << attacks << healths << durabilities << armors << overloads << spellDamages;
+    writeEnums<CardType>(stream, types);
+    writeEnums<CardRarity>(stream, rarities);
+    writeEnums<CardClass>(stream, cardClasses);
+    writeEnums<CardRace>(stream, races);
+    stream << sets << dbfIds << collectibles << hasCosts;
+    writeTags(stream, mechanics);
+    writeTags(stream, referencedTags);
+    stream << enNames << enTexts << enLowerTexts << localNames << localTexts;
+
+    QFile file(path);
+    if(!file.open(QIODevice::WriteOnly))    return false;
+    bool ok = file.write(data) == data.size();
+    file.close();
+    if(!ok)     file.remove();
+    return ok;
+}
+
+
+//Por carta: numero de tags y sus ids (< CARDDB_MAX_TAGS, caben en un byte)
+void CardDB::writeTags(QDataStream &stream, const QVector<CardTags> &column)
+{
+    QByteArray ids;
+    for(const CardTags &cardTags: column)
+    {
+        int countPos = ids.size();
+        ids.append('\0');
+        for(size_t id=0; id<cardTags.size(); id++)
+        {
+            if(!cardTags.test(id))  continue;
+            ids.append(static_cast<char>(id));
+            ids[countPos] = static_cast<char>(ids[countPos] + 1);
+        }
+    }
+    stream << static_cast<quint32>(column.count()) << ids;
+}
+
+
+void CardDB::readTags(QDataStream &stream, QVector<CardTags> &column)
+{
+    quint32 count;
+    QByteArray ids;
+    stream >> count >> ids;
+    if(stream.status() != QDataStream::Ok)  return;
+
+    column.resize(static_cast<int>(count));
+    const uchar *data = reinterpret_cast<const uchar *>(ids.constData());
+    int pos = 0;
+    for(CardTags &cardTags: column)
+    {
+        if(pos >= ids.size())
+        {
+            stream.setStatus(QDataStream::ReadCorruptData);
+            return;
+        }
+        int numTags = data[pos++];
+        for(int i=0; i<numTags && pos<ids.size(); i++)  cardTags.set(data[pos++]);
+    }
+}
+
+
+//Se construyen despues de leer todas las cartas para que un codigo repetido solo aparezca una vez.
+//Se recorren por codigo ordenado, como el antiguo QMap: con nombres repetidos (tokens, reediciones, HERO_...)
+//las busquedas por nombre devuelven el mismo codigo que antes.
+void CardDB::buildIndexes()
+{
+    int size = codes.count();
+    sortedIndexes.resize(size);
+    for(int i=0; i<size; i++)   sortedIndexes[i] = i;
+    std::sort(sortedIndexes.begin(), sortedIndexes.end(), [this](int a, int b){return codes[a] < codes[b];});
+
+    enNameIndexes.reserve(size);
+    dbfIdIndexes.reserve(size);
+    setIndexes.resize(setNames.count());
+
+    for(int i: sortedIndexes)
+    {
+        enNameIndexes[enNames[i]].append(i);
+        if(!dbfIdIndexes.contains(dbfIds[i]))   dbfIdIndexes[dbfIds[i]] = i;
+        setIndexes[sets[i]].append(i);
+        if(collectibles[i])     collectibleIndexes.append(i);
+    }
+    buildLocalIndexes();
+}
+
+
+void CardDB::buildLocalIndexes()
+{
+    localNameIndexes.clear();
+    localNameIndexes.reserve(codes.count());
+    for(int i: sortedIndexes)   localNameIndexes[localNames[i]].append(i);
+}
+
+
+void CardDB::appendCard(const QJsonObject &jsonCard)
+{
+    QString code = jsonCard.value("id").toString();
+
+    //Codigo repetido: como en el antiguo QMap, gana el ultimo
+    int index = codeIndex.value(code, -1);
+    if(index == -1)
+    {
+        index = codes.count();
+        codeIndex[code] = index;
+        codes.append(code);
+        rawCards.append(QByteArray());
+        costs.append(0);
+        attacks.append(0);
+        healths.append(0);
+        durabilities.append(0);
+        armors.append(0);
+        overloads.append(0);
+        spellDamages.append(0);
+        types.append(INVALID_TYPE);
+        rarities.append(INVALID_RARITY);
+        cardClasses.append(NEUTRAL);
+        races.append(INVALID_RACE);
+        sets.append(-1);
+        dbfIds.append(0);
+        collectibles.append(false);
+        hasCosts.append(false);
+        mechanics.append(CardTags());
+        referencedTags.append(CardTags());
+        enNames.append(QString());
+        enTexts.append(QString());
+        enLowerTexts.append(QString());
+        localNames.append(QString());
+        localTexts.append(QString());
+    }
+
+    rawCards[index] = QJsonDocument(jsonCard).toJson(QJsonDocument::Compact);
+    costs[index] = static_cast<qint16>(jsonCard.value("cost").toInt());
+    hasCosts[index] = !jsonCard.value("cost").isUndefined();
+    attacks[index] = static_cast<qint16>(jsonCard.value("attack").toInt());
+    healths[index] = static_cast<qint16>(jsonCard.value("health").toInt());
+    durabilities[index] = static_cast<qint16>(jsonCard.value("durability").toInt());
+    armors[index] = static_cast<qint16>(jsonCard.value("armor").toInt());
+    overloads[index] = static_cast<qint16>(jsonCard.value("overload").toInt());
+    spellDamages[index] = static_cast<qint16>(jsonCard.value("spellDamage").toInt());
+    types[index] = typeFromString(jsonCard.value("type").toString());
+    rarities[index] = rarityFromString(jsonCard.value("rarity").toString());
+    cardClasses[index] = classFromString(jsonCard.value("cardClass").toString());
+    races[index] = raceFromString(jsonCard.value("race").toString());
+    sets[index] = internSet(jsonCard.value("set").toString());
+    dbfIds[index] = jsonCard.value("dbfId").toInt();
+    collectibles[index] = jsonCard.value("collectible").toBool();
+    mechanics[index] = internTags(jsonCard.value("mechanics").toArray());
+    referencedTags[index] = internTags(jsonCard.value("referencedTags").toArray());
+    enNames[index] = jsonCard.value("name").toObject().value("enUS").toString();
+    enTexts[index] = jsonCard.value("text").toObject().value("enUS").toString();
+    enLowerTexts[index] = enTexts[index].toLower();
+    localNames[index] = jsonCard.value("name").toObject().value(localLang).toString();
+    localTexts[index] = jsonCard.value("text").toObject().value(localLang).toString();
+}
+
+
+//Nombre y texto en el idioma de Hearthstone, se rehacen al cambiar localLang
+void CardDB::fillLocalColumns()
+{
+    int size = codes.count();
+    localNames.resize(size);
+    localTexts.resize(size);
+    for(int i=0; i<size; i++)
+    {
+        QJsonObject jsonCard = QJsonDocument::fromJson(rawCards[i]).object();
+        localNames[i] = jsonCard.value("name").toObject().value(localLang).toString();
+        localTexts[i] = jsonCard.value("text").toObject().value(localLang).toString();
+    }
+    buildLocalIndexes();
+}
+
+
+void CardDB::setLocalLang(const QString &localLang)
+{
+    if(this->localLang == localLang)    return;
+    this->localLang = localLang;
+    fillLocalColumns();
+}
+
+
+int CardDB::internSet(const QString &set)
+{
+    int id = setIds.value(set, -1);
+    if(id == -1)
+    {
+        id = setNames.count();
+        setIds[set] = id;
+        setNames.append(set);
+    }
+    return id;
+}
+
+
+CardTags CardDB::internTags(const QJsonArray &jsonTags)
+{
+    CardTags cardTags;
+    for(const QJsonValue &jsonTag: jsonTags)
+    {
+        QString tag = jsonTag.toString();
+        int id = tagIds.value(tag, -1);
+        if(id == -1)
+        {
+            if(tagNames.count() >= CARDDB_MAX_TAGS)   continue;
+            id = tagNames.count();
+            tagIds[tag] = id;
+            tagNames.append(tag);
+        }
+        cardTags.set(static_cast<size_t>(id));
+    }
+    return cardTags;
+}
+
+
+int CardDB::count() const
+{
+    return codes.count();
+}
+
+
+bool CardDB::contains(const QString &code) const
+{
+    return codeIndex.contains(code);
+}
+
+
+int CardDB::index(const QString &code) const
+{
+    return codeIndex.value(code, -1);
+}
+
+
+const QVector<QString> &CardDB::getCodes() const
+{
+    return codes;
+}
+
+
+//mechanics y referencedTags salen de las columnas (en orden de tagId), el resto se parsea del JSON de la carta
+QJsonValue CardDB::getJsonAttribute(const QString &code, const QString &attribute) const
+{
+    int index = codeIndex.value(code, -1);
+    if(index == -1)     return QJsonValue(QJsonValue::Undefined);
+    if(attribute == "mechanics")            return tagsToJson(mechanics.at(index));
+    else if(attribute == "referencedTags")  return tagsToJson(referencedTags.at(index));
+    return QJsonDocument::fromJson(rawCards.at(index)).object().value(attribute);
+}
+
+
+QJsonArray CardDB::tagsToJson(const CardTags &cardTags) const
+{
+    QJsonArray jsonTags;
+    for(int id=0; id<tagNames.count(); id++)
+    {
+        if(cardTags.test(static_cast<size_t>(id)))  jsonTags.append(tagNames[id]);
+    }
+    return jsonTags;
+}
+
+
+int CardDB::cost(const QString &code) const
+{
+    return value<qint16>(costs, code, 0);
+}
+
+
+bool CardDB::hasCost(const QString &code) const
+{
+    return value<bool>(hasCosts, code, false);
+}
+
+
+int CardDB::attack(const QString &code) const
+{
+    return value<qint16>(attacks, code, 0);
+}
+
+
+int CardDB::health(const QString &code) const
+{
+    return value<qint16>(healths, code, 0);
+}
+
+
+int CardDB::durability(const QString &code) const
+{
+    return value<qint16>(durabilities, code, 0);
+}
+
+
+int CardDB::armor(const QString &code) const
+{
+    return value<qint16>(armors, code, 0);
+}
+
+
+int CardDB::overload(const QString &code) const
+{
+    return value<qint16>(overloads, code, 0);
+}
+
+
+int CardDB::spellDamage(const QString &code) const
+{
+    return value<qint16>(spellDamages, code, 0);
+}
+
+
+CardType CardDB::type(const QString &code) const
+{
+    return value<CardType>(types, code, INVALID_TYPE);
+}
+
+
+CardRarity CardDB::rarity(const QString &code) const
+{
+    return value<CardRarity>(rarities, code, INVALID_RARITY);
+}
+
+
+CardClass CardDB::cardClass(const QString &code) const
+{
+    //Sin cardClass en el json --> NEUTRAL, igual que una carta desconocida
+    return value<CardClass>(cardClasses, code, NEUTRAL);
+}
+
+
+CardRace CardDB::race(const QString &code) const
+{
+    return value<CardRace>(races, code, INVALID_RACE);
+}
+
+
+QString CardDB::set(const QString &code) const
+{
+    int id = value<int>(sets, code, -1);
+    return (id == -1)?QString():setNames.at(id);
+}
+
+
+int CardDB::dbfId(const QString &code) const
+{
+    return value<int>(dbfIds, code, 0);
+}
+
+
+bool CardDB::isCollectible(const QString &code) const
+{
+    return value<bool>(collectibles, code, false);
+}
+
+
+QString CardDB::enName(const QString &code) const
+{
+    return value<QString>(enNames, code, QString());
+}
+
+
+QString CardDB::enText(const QString &code) const
+{
+    return value<QString>(enTexts, code, QString());
+}
+
+
+QString CardDB::enLowerText(const QString &code) const
+{
+    return value<QString>(enLowerTexts, code, QString());
+}
+
+
+QString CardDB::localName(const QString &code) const
+{
+    return value<QString>(localNames, code, QString());
+}
+
+
+QString CardDB::localText(const QString &code) const
+{
+    return value<QString>(localTexts, code, QString());
+}
+
+
+QString CardDB::codeFromEnName(const QString &name, bool onlyCollectible) const
+{
+    for(int index: enNameIndexes.value(name))
+    {
+        if(!onlyCollectible || collectibles[index])     return codes[index];
+    }
+    return QString();
+}
+
+
+//Solo cartas con coste, como hacia Utility::cardLocalCodeFromName
+QString CardDB::codeFromLocalName(const QString &name) const
+{
+    for(int index: localNameIndexes.value(name))
+    {
+        if(hasCosts[index])     return codes[index];
+    }
+    return QString();
+}
+
+
+QString CardDB::codeFromDbfId(int dbfId) const
+{
+    int index = dbfIdIndexes.value(dbfId, -1);
+    return (index == -1)?QString():codes[index];
+}
+
+
+QStringList CardDB::indexesToCodes(const QVector<int> &indexes, bool onlyCollectible) const
+{
+    QStringList indexCodes;
+    indexCodes.reserve(indexes.count());
+    for(int index: indexes)
+    {
+        if(!onlyCollectible || collectibles[index])     indexCodes.append(codes[index]);
+    }
+    return indexCodes;
+}
+
+
+QStringList CardDB::getSetCodes(const QString &set, bool onlyCollectible) const
+{
+    int id = setIds.value(set, -1);
+    if(id == -1)    return QStringList();
+    return indexesToCodes(setIndexes[id], onlyCollectible);
+}
+
+
+QStringList CardDB::getCollectibleCodes() const
+{
+    return indexesToCodes(collectibleIndexes, false);
+}
+
+
+int CardDB::tagId(const QString &tag) const
+{
+    return tagIds.value(tag, -1);
+}
+
+
+CardTags CardDB::getMechanics(const QString &code) const
+{
+    return value<CardTags>(mechanics, code, CardTags());
+}
+
+
+CardTags CardDB::getReferencedTags(const QString &code) const
+{
+    return value<CardTags>(referencedTags, code, CardTags());
+}
+
+
+bool CardDB::hasMechanic(const QString &code, const QString &mechanic) const
+{
+    int id = tagIds.value(mechanic, -1);
+    int index = codeIndex.value(code, -1);
+    if(id == -1 || index == -1)     return false;
+    return mechanics.at(index).test(static_cast<size_t>(id));
+}
+
+
+bool CardDB::hasReferencedTag(const QString &code, const QString &tag) const
+{
+    int id = tagIds.value(tag, -1);
+    int index = codeIndex.value(code, -1);
+    if(id == -1 || index == -1)     return false;
+    return referencedTags.at(index).test(static_cast<size_t>(id));
+}
+
+
+CardType CardDB::typeFromString(const QString &value)
+{
+    if(value == "MINION")           return MINION;
+    else if(value == "SPELL")       return SPELL;
+    else if(value == "WEAPON")      return WEAPON;
+    else if(value == "ENCHANTMENT") return ENCHANTMENT;
+    else if(value == "HERO")        return HERO;
+    else if(value == "HERO_POWER")  return HERO_POWER;
+    else                            return INVALID_TYPE;
+}
+
+
+CardRarity CardDB::rarityFromString(const QString &value)
+{
+    if(value == "FREE")             return COMMON;
+    else if(value == "COMMON")      return COMMON;
+    else if(value == "RARE")        return RARE;
+    else if(value == "EPIC")        return EPIC;
+    else if(value == "LEGENDARY")   return LEGENDARY;
+    else                            return INVALID_RARITY;
+}
+
+
+CardClass CardDB::classFromString(const QString &value)
+{
+    if(value == "")             return NEUTRAL;
+    else if(value == "NEUTRAL") return NEUTRAL;
+    else if(value == "DRUID")   return DRUID;
+    else if(value == "HUNTER")  return HUNTER;
+    else if(value == "MAGE")    return MAGE;
+    else if(value == "PALADIN") return PALADIN;
+    else if(value == "PRIEST")  return PRIEST;
+    else if(value == "ROGUE")   return ROGUE;
+    else if(value == "SHAMAN")  return SHAMAN;
+    else if(value == "WARLOCK") return WARLOCK;
+    else if(value == "WARRIOR") return WARRIOR;
+    else if(value == "DREAM")   return DREAM;
+    else                        return INVALID_CLASS;
+}
+
+
+CardRace CardDB::raceFromString(const QString &value)
+{
+    if(value == "BLOODELF")         return BLOODELF;
+    else if(value == "DRAENEI")     return DRAENEI;
+    else if(value == "DWARF")       return DWARF;
+    else if(value == "GNOME")       return GNOME;
+    else if(value == "GOBLIN")      return GOBLIN;
+    else if(value == "HUMAN")       return HUMAN;
+    else if(value == "NIGHTELF")    return NIGHTELF;
+    else if(value == "ORC")         return ORC;
+    else if(value == "TAUREN")      return TAUREN;
+    else if(value == "TROLL")       return TROLL;
+    else if(value == "UNDEAD")      return UNDEAD;
+    else if(value == "WORGEN")      return WORGEN;
+    else if(value == "GOBLIN2")     return GOBLIN2;
+    else if(value == "MURLOC")      return MURLOC;
+    else if(value == "DEMON")       return DEMON;
+    else if(value == "SCOURGE")     return SCOURGE;
+    else if(value == "MECHANICAL")  return MECHANICAL;
+    else if(value == "ELEMENTAL")   return ELEMENTAL;
+    else if(value == "OGRE")        return OGRE;
+    else if(value == "BEAST")       return BEAST;
+    else if(value == "TOTEM")       return TOTEM;
+    else if(value == "NERUBIAN")    return NERUBIAN;
+    else if(value == "PIRATE")      return PIRATE;
+    else if(value == "DRAGON")      return DRAGON;
+    else                            return INVALID_RACE;
+}
@@ -0,0 +1,151 @@
+#ifndef CARDDB_H
+#define CARDDB_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QDataStream>
+#include <bitset>
+#include "../Cards/deckcard.h"
+
+//Maximo de mechanics/referencedTags distintos en cards.json (hay unos 100)
+#define CARDDB_MAX_TAGS 256
+
+//Cache binaria (QDataStream) con las columnas ya extraidas de cards.json.
+//Subir CARDDB_CACHE_FORMAT si cambian las columnas o su orden en el fichero.
+#define CARDDB_CACHE_MAGIC 0x41544344 //"ATCD"
+#define CARDDB_CACHE_FORMAT 2
+
+typedef std::bitset<CARDDB_MAX_TAGS> CardTags;
+
+
+//Base de datos de cartas construida una sola vez a partir de cards.json.
+//Cada carta tiene un indice denso (codeIndex) y sus atributos se guardan por columnas (struct of arrays),
+//asi los getters de Utility son una busqueda en QHash y una lectura de array.
+//Los atributos poco usados se leen del JSON compacto de cada carta (rawCards), que solo se parsea al pedirlos.
+class CardDB
+{
+//Constructor
+public:
+    CardDB();
+    ~CardDB();
+
+//Variables
+private:
+    QHash<QString, int> codeIndex;
+    QVector<QString> codes;
+    QVector<QByteArray> rawCards;
+
+    //Columnas
+    QVector<qint16> costs, attacks, healths, durabilities, armors, overloads, spellDamages;
+    QVector<CardType> types;
+    QVector<CardRarity> rarities;
+    QVector<CardClass> cardClasses;
+    QVector<CardRace> races;
+    QVector<int> sets;//Indice en setNames
+    QVector<int> dbfIds;
+    QVector<bool> collectibles, hasCosts;
+    QVector<CardTags> mechanics, referencedTags;
+    QVector<QString> enNames, enTexts, enLowerTexts;
+    QVector<QString> localNames, localTexts;
+
+    QStringList setNames, tagNames;
+    QHash<QString, int> setIds, tagIds;
+    QString localLang;
+
+    //Indices inversos, en orden de codigo (sortedIndexes)
+    QVector<int> sortedIndexes;
+    QHash<QString, QVector<int>> enNameIndexes, localNameIndexes;
+    QHash<int, int> dbfIdIndexes;
+    QVector<QVector<int>> setIndexes;//Por id de set
+    QVector<int> collectibleIndexes;
+
+//Metodos
+private:
+    void clear();
+    void appendCard(const QJsonObject &jsonCard);
+    void fillLocalColumns();
+    void buildIndexes();
+    void buildLocalIndexes();
+    QStringList indexesToCodes(const QVector<int> &indexes, bool onlyCollectible) const;
+    int internSet(const QString &set);
+    CardTags internTags(const QJsonArray &jsonTags);
+    QJsonArray tagsToJson(const CardTags &cardTags) const;
+    static void writeTags(QDataStream &stream, const QVector<CardTags> &column);
+    static void readTags(QDataStream &stream, QVector<CardTags> &column);
+
+    template<typename T> static void writeEnums(QDataStream &stream, const QVector<T> &column)
+    {
+        QVector<qint32> values(column.count());
+        for(int i=0; i<column.count(); i++)     values[i] = static_cast<qint32>(column[i]);
+        stream << values;
+    }
+    template<typename T> static void readEnums(QDataStream &stream, QVector<T> &column)
+    {
+        QVector<qint32> values;
+        stream >> values;
+        column.resize(values.count());
+        for(int i=0; i<values.count(); i++)     column[i] = static_cast<T>(values[i]);
+    }
+
+    template<typename T> T value(const QVector<T> &column, const QString &code, T defaultValue) const
+    {
+        int index = codeIndex.value(code, -1);
+        return (index == -1)?defaultValue:column.at(index);
+    }
+
+public:
+    void load(const QJsonArray &jsonArray);
+    bool loadCache(const QString &path, const QString &cardsJsonVersion);
+    bool saveCache(const QString &path, const QString &cardsJsonVersion) const;
+    void setLocalLang(const QString &localLang);
+    int count() const;
+    bool contains(const QString &code) const;
+    int index(const QString &code) const;
+    const QVector<QString> &getCodes() const;
+    QJsonValue getJsonAttribute(const QString &code, const QString &attribute) const;
+
+    int cost(const QString &code) const;
+    bool hasCost(const QString &code) const;
+    int attack(const QString &code) const;
+    int health(const QString &code) const;
+    int durability(const QString &code) const;
+    int armor(const QString &code) const;
+    int overload(const QString &code) const;
+    int spellDamage(const QString &code) const;
+    CardType type(const QString &code) const;
+    CardRarity rarity(const QString &code) const;
+    CardClass cardClass(const QString &code) const;
+    CardRace race(const QString &code) const;
+    QString set(const QString &code) const;
+    int dbfId(const QString &code) const;
+    bool isCollectible(const QString &code) const;
+    QString enName(const QString &code) const;
+    QString enText(const QString &code) const;
+    QString enLowerText(const QString &code) const;
+    QString localName(const QString &code) const;
+    QString localText(const QString &code) const;
+
+    QString codeFromEnName(const QString &name, bool onlyCollectible) const;
+    QString codeFromLocalName(const QString &name) const;
+    QString codeFromDbfId(int dbfId) const;
+    QStringList getSetCodes(const QString &set, bool onlyCollectible) const;
+    QStringList getCollectibleCodes() const;
+
+    int tagId(const QString &tag) const;
+    CardTags getMechanics(const QString &code) const;
+    CardTags getReferencedTags(const QString &code) const;
+    bool hasMechanic(const QString &code, const QString &mechanic) const;
+    bool hasReferencedTag(const QString &code, const QString &tag) const;
+
+    static CardType typeFromString(const QString &value);
+    static CardRarity rarityFromString(const QString &value);
+    static CardClass classFromString(const QString &value);
+    static CardRace raceFromString(const QString &value);
+};
+
+#endif // CARDDB_H
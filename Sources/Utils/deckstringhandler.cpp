@@ -258,13 +258,13 @@ char DeckStringHandler::takeChar(QByteArray &stream)
 
 QString DeckStringHandler::getCode(const quint64 &dbfId)
 {
-    return Utility::getCodeFromCardAttribute("dbfId", QJsonValue((qint64)dbfId));
+    return Utility::getCodeFromDbfId(static_cast<int>(dbfId));
 }
 
 
 quint64 DeckStringHandler::getId(const QString &code)
 {
-    return Utility::getCardAttribute(code, "dbfId").toVariant().toULongLong();
+    return static_cast<quint64>(Utility::getDbfIdFromCode(code));
 }
 
 
@@ -0,0 +1,144 @@
+#include "histcache.h"
+#include <QFile>
+#include <QDataStream>
+
+
+HistCache::HistCache()
+{
+    loaded = dirty = false;
+}
+
+
+//Se lee el fichero entero de una vez. Una cache de otra version o corrupta se descarta y se rehace.
+void HistCache::load(const QString &path)
+{
+    this->path = path;
+    this->loaded = true;
+    this->dirty = false;
+    entries.clear();
+
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly))     return;
+    QByteArray data = file.readAll();
+    file.close();
+
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_5_0);
+    quint32 magic, version, numEntries;
+    stream >> magic >> version >> numEntries;
+    if(stream.status() != QDataStream::Ok || magic != HIST_CACHE_MAGIC || version != HIST_CACHE_VERSION)    return;
+
+    entries.reserve(static_cast<int>(numEntries));
+    for(quint32 i=0; i<numEntries; i++)
+    {
+        QString code;
+        HistCacheEntry entry;
+        qint32 x, y, width, height, rows, cols;
+        stream >> code >> entry.mtime >> x >> y >> width >> height >> rows >> cols >> entry.sparseHist;
+        if(stream.status() != QDataStream::Ok)
+        {
+            entries.clear();
+            return;
+        }
+        entry.crop = cv::Rect(x, y, width, height);
+        entry.rows = rows;
+        entry.cols = cols;
+        entries[code] = entry;
+    }
+}
+
+
+bool HistCache::save()
+{
+    if(!dirty || path.isEmpty())    return true;
+
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << static_cast<quint32>(HIST_CACHE_MAGIC) << static_cast<quint32>(HIST_CACHE_VERSION) << static_cast<quint32>(entries.count());
+    for(QHash<QString, HistCacheEntry>::const_iterator it=entries.constBegin(); it!=entries.constEnd(); it++)
+    {
+        const HistCacheEntry &entry = it.value();
+        stream << it.key() << entry.mtime
+               << static_cast<qint32>(entry.crop.x) << static_cast<qint32>(entry.crop.y)
+               << static_cast<qint32>(entry.crop.width) << static_cast<qint32>(entry.crop.height)
+               << static_cast<qint32>(entry.rows) << static_cast<qint32>(entry.cols) << entry.sparseHist;
+    }
+
+    QFile file(path);
+    if(!file.open(QIODevice::WriteOnly) || file.write(data) != data.size())    return false;
+    file.close();
+    dirty = false;
+    return true;
+}
+
+
+bool HistCache::isLoaded() const
+{
+    return loaded;
+}
+
+
+int HistCache::count() const
+{
+    return entries.count();
+}
+
+
+bool HistCache::get(const QString &code, qint64 mtime, const cv::Rect &crop, cv::MatND &hist) const
+{
+    QHash<QString, HistCacheEntry>::const_iterator it = entries.constFind(code);
+    if(it == entries.constEnd() || it->mtime != mtime || it->crop != crop)     return false;
+    hist = fromSparse(it.value());
+    return true;
+}
+
+
+void HistCache::set(const QString &code, qint64 mtime, const cv::Rect &crop, const cv::MatND &hist)
+{
+    if(hist.empty() || hist.dims != 2 || hist.type() != CV_32F)     return;
+
+    HistCacheEntry entry;
+    entry.mtime = mtime;
+    entry.crop = crop;
+    entry.rows = hist.rows;
+    entry.cols = hist.cols;
+    entry.sparseHist = toSparse(hist);
+    entries[code] = entry;
+    dirty = true;
+}
+
+
+QByteArray HistCache::toSparse(const cv::MatND &hist)
+{
+    QByteArray sparseHist;
+    const int numBins = static_cast<int>(hist.total());
+    const float *bins = hist.ptr<float>(0);
+    for(int i=0; i<numBins; i++)
+    {
+        if(bins[i] == 0.f)   continue;
+        quint16 bin = static_cast<quint16>(i);
+        sparseHist.append(reinterpret_cast<const char *>(&bin), sizeof(bin));
+        sparseHist.append(reinterpret_cast<const char *>(&bins[i]), sizeof(float));
+    }
+    return sparseHist;
+}
+
+
+cv::MatND HistCache::fromSparse(const HistCacheEntry &entry)
+{
+    cv::MatND hist = cv::MatND::zeros(entry.rows, entry.cols, CV_32F);
+    float *bins = hist.ptr<float>(0);
+    const int numBins = entry.rows*entry.cols;
+    const int pairSize = sizeof(quint16) + sizeof(float);
+    const char *data = entry.sparseHist.constData();
+    for(int pos=0; pos + pairSize <= entry.sparseHist.size(); pos += pairSize)
+    {
+        quint16 bin;
+        float value;
+        memcpy(&bin, data + pos, sizeof(bin));
+        memcpy(&value, data + pos + sizeof(bin), sizeof(value));
+        if(bin < numBins)   bins[bin] = value;
+    }
+    return hist;
+}
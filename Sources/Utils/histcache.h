@@ -0,0 +1,54 @@
+#ifndef HISTCACHE_H
+#define HISTCACHE_H
+
+#include "opencv2/opencv.hpp"
+#include <QString>
+#include <QHash>
+#include <QByteArray>
+
+#define HIST_CACHE_FILE "hists.bin"
+#define HIST_CACHE_MAGIC 0x41544853 //"ATHS"
+//Subir HIST_CACHE_VERSION si cambia getHist (bins, espacio de color, normalizacion...)
+#define HIST_CACHE_VERSION 1
+
+
+class HistCacheEntry
+{
+public:
+    qint64 mtime;
+    cv::Rect crop;
+    int rows, cols;
+    QByteArray sparseHist;  //Pares (quint16 bin, float valor) de los bins distintos de 0
+};
+
+
+//Cache en disco de los histogramas de referencia de las cartas (DraftHandler::getHist).
+//Cada entrada solo vale para la misma imagen (mtime del png) y el mismo recorte.
+//Los histogramas tienen pocos bins ocupados, se guardan dispersos.
+class HistCache
+{
+//Constructor
+public:
+    HistCache();
+
+//Variables
+private:
+    QHash<QString, HistCacheEntry> entries;
+    QString path;
+    bool loaded, dirty;
+
+//Metodos
+private:
+    static QByteArray toSparse(const cv::MatND &hist);
+    static cv::MatND fromSparse(const HistCacheEntry &entry);
+
+public:
+    void load(const QString &path);
+    bool save();
+    bool isLoaded() const;
+    int count() const;
+    bool get(const QString &code, qint64 mtime, const cv::Rect &crop, cv::MatND &hist) const;
+    void set(const QString &code, qint64 mtime, const cv::Rect &crop, const cv::MatND &hist);
+};
+
+#endif // HISTCACHE_H
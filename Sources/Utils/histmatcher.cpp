@@ -0,0 +1,183 @@
+#include "histmatcher.h"
+#include <algorithm>
+#include <cfloat>
+
+
+HistMatcher::HistMatcher()
+{
+    groupsDirty = false;
+}
+
+
+void HistMatcher::clear()
+{
+    codeIndex.clear();
+    codes.clear();
+    sqrtHists.release();
+    histSums.clear();
+    rowGroups.clear();
+    groupIndexes.clear();
+    groupSqrtHists.clear();
+    groupsDirty = false;
+}
+
+
+cv::Mat HistMatcher::sqrtRow(const cv::MatND &hist)
+{
+    cv::Mat row;
+    hist.reshape(1, 1).convertTo(row, CV_32F);
+    cv::sqrt(row, row);
+    return row;
+}
+
+
+//Si el codigo ya existe (imagen descargada de nuevo) se sustituye su fila
+void HistMatcher::setHist(const QString &code, const cv::MatND &hist, int group)
+{
+    if(hist.empty())    return;
+
+    cv::Mat row = sqrtRow(hist);
+    if(!sqrtHists.empty() && row.cols != sqrtHists.cols)    return;
+
+    int index = codeIndex.value(code, -1);
+    if(index == -1)
+    {
+        codeIndex[code] = codes.count();
+        codes.append(code);
+        sqrtHists.push_back(row);
+        histSums.append(cv::sum(hist)[0]);
+        rowGroups.append(group);
+    }
+    else
+    {
+        row.copyTo(sqrtHists.row(index));
+        histSums[index] = cv::sum(hist)[0];
+        rowGroups[index] = group;
+    }
+    groupsDirty = true;
+}
+
+
+void HistMatcher::buildGroups() const
+{
+    groupIndexes.clear();
+    groupSqrtHists.clear();
+    for(int j=0; j<count(); j++)    groupIndexes[rowGroups[j]].append(j);
+
+    for(QHash<int, QVector<int>>::const_iterator it=groupIndexes.constBegin(); it!=groupIndexes.constEnd(); it++)
+    {
+        cv::Mat rows(it->count(), sqrtHists.cols, CV_32F);
+        for(int k=0; k<it->count(); k++)    sqrtHists.row(it->at(k)).copyTo(rows.row(k));
+        groupSqrtHists[it.key()] = rows;
+    }
+    groupsDirty = false;
+}
+
+
+bool HistMatcher::contains(const QString &code) const
+{
+    return codeIndex.contains(code);
+}
+
+
+int HistMatcher::count() const
+{
+    return codes.count();
+}
+
+
+int HistMatcher::index(const QString &code) const
+{
+    return codeIndex.value(code, -1);
+}
+
+
+QString HistMatcher::code(int index) const
+{
+    return codes.at(index);
+}
+
+
+cv::Mat HistMatcher::screenSqrtRows(const cv::MatND screenHists[], int numHists, QVector<double> &screenSums) const
+{
+    cv::Mat screenSqrtHists;
+    for(int i=0; i<numHists; i++)
+    {
+        screenSqrtHists.push_back(sqrtRow(screenHists[i]));
+        screenSums.append(cv::sum(screenHists[i])[0]);
+    }
+    return screenSqrtHists;
+}
+
+
+//matches: CV_64F, numHists filas x count() columnas, con el mismo valor que compareHist(screenHist, hist, 3)
+//d = sqrt(1 - sum(sqrt(h1*h2)) / sqrt(sum(h1)*sum(h2)))
+//Con groups solo se calculan las filas de esos grupos, el resto queda a 1 (distancia maxima).
+void HistMatcher::match(const cv::MatND screenHists[], int numHists, cv::Mat &matches, const QList<int> &groups) const
+{
+    matches.create(numHists, count(), CV_64F);
+    if(count() == 0)    return;
+
+    QVector<double> screenSums;
+    cv::Mat screenSqrtHists = screenSqrtRows(screenHists, numHists, screenSums);
+
+    if(!groups.isEmpty())
+    {
+        if(groupsDirty)     buildGroups();
+        matches.setTo(1);
+
+        for(int group: groups)
+        {
+            if(!groupIndexes.contains(group))   continue;
+            const QVector<int> &indexes = groupIndexes[group];
+
+            cv::Mat dots;
+            cv::gemm(screenSqrtHists, groupSqrtHists[group], 1, cv::noArray(), 0, dots, cv::GEMM_2_T);
+
+            for(int i=0; i<numHists; i++)
+            {
+                const float *dotRow = dots.ptr<float>(i);
+                double *matchRow = matches.ptr<double>(i);
+                for(int k=0; k<indexes.count(); k++)
+                {
+                    int j = indexes[k];
+                    double sums = screenSums[i]*histSums[j];
+                    double scale = (fabs(sums) > FLT_EPSILON)?1./sqrt(sums):1.;
+                    matchRow[j] = sqrt(std::max(1. - dotRow[k]*scale, 0.));
+                }
+            }
+        }
+        return;
+    }
+
+    //Producto escalar de todos los slots contra todas las referencias en una sola pasada (SIMD en OpenCV)
+    cv::Mat dots;
+    cv::gemm(screenSqrtHists, sqrtHists, 1, cv::noArray(), 0, dots, cv::GEMM_2_T);
+
+    for(int i=0; i<numHists; i++)
+    {
+        const float *dotRow = dots.ptr<float>(i);
+        double *matchRow = matches.ptr<double>(i);
+        for(int j=0; j<count(); j++)
+        {
+            double sums = screenSums[i]*histSums[j];
+            double scale = (fabs(sums) > FLT_EPSILON)?1./sqrt(sums):1.;
+            matchRow[j] = sqrt(std::max(1. - dotRow[j]*scale, 0.));
+        }
+    }
+}
+
+
+//Los numCandidates mejores (menor distancia) de la fila, ordenados. Seleccion parcial, no se ordena toda la fila.
+void HistMatcher::bestIndexes(const cv::Mat &matches, int row, int numCandidates, QVector<int> &bestIndexes)
+{
+    const double *matchRow = matches.ptr<double>(row);
+    bestIndexes.resize(matches.cols);
+    for(int j=0; j<matches.cols; j++)   bestIndexes[j] = j;
+
+    numCandidates = std::min(numCandidates, matches.cols);
+    auto lessMatch = [matchRow](int a, int b){return matchRow[a] < matchRow[b];};
+    std::nth_element(bestIndexes.begin(), bestIndexes.begin() + numCandidates, bestIndexes.end(), lessMatch);
+    bestIndexes.resize(numCandidates);
+    std::sort(bestIndexes.begin(), bestIndexes.end(), lessMatch);
+}
@@ -0,0 +1,50 @@
+#ifndef HISTMATCHER_H
+#define HISTMATCHER_H
+
+#include "opencv2/opencv.hpp"
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+
+
+//Histogramas de referencia de las cartas del draft guardados en una sola matriz (una fila por codigo),
+//ya en raiz cuadrada para calcular la distancia de Bhattacharyya (compareHist metodo 3) de los 3 slots
+//con un solo producto de matrices en lugar de un compareHist por carta y slot.
+//Cada fila pertenece a un grupo (p.ej. clase y rareza) para poder comparar solo con los candidatos legales.
+class HistMatcher
+{
+//Constructor
+public:
+    HistMatcher();
+
+//Variables
+private:
+    QHash<QString, int> codeIndex;
+    QStringList codes;
+    cv::Mat sqrtHists;          //CV_32F, una fila por codigo, sqrt de cada bin
+    QVector<double> histSums;   //Suma de los bins de cada histograma
+    QVector<int> rowGroups;     //Grupo de cada fila
+    //Indice por grupo, se reconstruye al hacer match si han cambiado los histogramas
+    mutable bool groupsDirty;
+    mutable QHash<int, QVector<int>> groupIndexes;   //[Group] --> Filas
+    mutable QHash<int, cv::Mat> groupSqrtHists;      //[Group] --> sqrtHists de sus filas, contiguas
+
+//Metodos
+private:
+    static cv::Mat sqrtRow(const cv::MatND &hist);
+    void buildGroups() const;
+    cv::Mat screenSqrtRows(const cv::MatND screenHists[], int numHists, QVector<double> &screenSums) const;
+
+public:
+    void clear();
+    void setHist(const QString &code, const cv::MatND &hist, int group=0);
+    bool contains(const QString &code) const;
+    int count() const;
+    int index(const QString &code) const;
+    QString code(int index) const;
+    void match(const cv::MatND screenHists[], int numHists, cv::Mat &matches, const QList<int> &groups=QList<int>()) const;
+    static void bestIndexes(const cv::Mat &matches, int row, int numCandidates, QVector<int> &bestIndexes);
+};
+
+#endif // HISTMATCHER_H
@@ -0,0 +1,67 @@
+#include "logpatterns.h"
+
+
+QVector<QRegularExpression> LogPatterns::buildPatterns()
+{
+    QVector<QRegularExpression> patterns(LP_NUM_PATTERNS);
+
+    //[LoadingScreen] LoadingScreen.OnSceneLoaded() - prevMode=HUB currMode=DRAFT
+    patterns[LP_LOADING_SCREEN] = QRegularExpression(
+                "LoadingScreen\\.OnSceneLoaded\\(\\) *- *prevMode=(\\w+) *currMode=(\\w+)");
+
+    //[Arena] DraftManager.OnChosen(): hero=HERO_02 premium=STANDARD
+    patterns[LP_ARENA_NEW] = QRegularExpression(
+                "DraftManager\\.OnChosen\\(\\): hero=HERO_(\\d+)");
+    //[Arena] Client chooses: Profesora violeta (NEW1_026)
+    patterns[LP_ARENA_PICK] = QRegularExpression(
+                "Client chooses: .* \\((\\w+)\\)");
+    //[Arena] DraftManager.OnChoicesAndContents - Draft Deck ID: 472720132, Hero Card = HERO_02
+    patterns[LP_ARENA_READ_DECK_START] = QRegularExpression(
+                "DraftManager\\.OnChoicesAndContents - Draft Deck ID: \\d+, Hero Card = HERO_\\d+");
+    //[Arena] DraftManager.OnChoicesAndContents - Draft deck contains card FP1_012
+    patterns[LP_ARENA_READ_DECK_CARD] = QRegularExpression(
+                "DraftManager\\.OnChoicesAndContents - Draft deck contains card (\\w+)");
+    //D 11:27:13.1732560 DraftManager.OnBegin - Got new draft deck with ID: 507495951
+    patterns[LP_ARENA_BEGIN] = QRegularExpression(
+                "DraftManager\\.OnBegin - Got new draft deck with ID: \\d+");
+    //D 11:27:47.0196860 DraftManager.OnChoicesAndContents - Draft Deck ID: 507495951, Hero Card =
+    patterns[LP_ARENA_CHOICES] = QRegularExpression(
+                "DraftManager\\.OnChoicesAndContents - Draft Deck ID: \\d+, Hero Card =");
+
+    patterns[LP_POWER_CREATE_HERO] = QRegularExpression(
+                "Creating ID=\\d+ CardID=HERO_(\\d+)");
+
+    //GameState.DebugPrintEntityChoices() - id=1 Player=fayatime TaskList=3 ChoiceType=MULLIGAN CountMin=0 CountMax=5
+    patterns[LP_MULLIGAN_PLAYER] = QRegularExpression(
+                "GameState\\.DebugPrintEntityChoices\\(\\) - id=(\\d+) Player=(.*) TaskList=\\d+ ChoiceType=MULLIGAN CountMin=0 CountMax=(\\d+)");
+    //GameState.DebugPrintPower() -     TAG_CHANGE Entity=fayatime tag=MULLIGAN_STATE value=DONE
+    patterns[LP_MULLIGAN_DONE] = QRegularExpression(
+                "Entity=(.+) tag=MULLIGAN_STATE value=DONE");
+    //GameState.DebugPrintEntityChoices() -   Entities[4]=[entityName=La moneda id=68 zone=HAND zonePos=5 cardId=GAME_005 player=2]
+    patterns[LP_MULLIGAN_COIN] = QRegularExpression(
+                "GameState\\.DebugPrintEntityChoices\\(\\) - *"
+                "Entities\\[4\\]=\\[entityName=.* id=(\\d+) zone=HAND zonePos=5 cardId=.* player=\\d+\\]");
+
+    //[entityName=UNKNOWN ENTITY [cardType=INVALID] id=69 zone=HAND zonePos=0 cardId= player=2] zone from OPPOSING DECK -> OPPOSING HAND
+    patterns[LP_ZONE_UNKNOWN] = QRegularExpression(
+                "\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=\\d+\\] zone from "
+                "(\\w+ \\w+(?: \\(Weapon\\))?)? -> (\\w+ \\w+(?: \\((?:Weapon|Hero|Hero Power)\\))?)?");
+    //[entityName=Shellshifter id=32 zone=HAND zonePos=0 cardId=UNG_101 player=1] zone from FRIENDLY DECK -> FRIENDLY HAND
+    patterns[LP_ZONE_KNOWN] = QRegularExpression(
+                "\\[entityName=(.*) id=(\\d+) zone=\\w+ zonePos=(\\d+) cardId=(\\w*) player=(\\d+)\\] zone from "
+                "(\\w+ \\w+(?: \\(Weapon\\))?)? -> (\\w+ \\w+(?: \\((?:Weapon|Hero|Hero Power)\\))?)?");
+    //id=7 local=True [entityName=Ingeniera novata id=25 zone=HAND zonePos=5 cardId=EX1_015 player=1] pos from 5 -> 3
+    patterns[LP_ZONE_POS] = QRegularExpression(
+                "\\[entityName=(.*) id=(\\d+) zone=(?:HAND|PLAY) zonePos=\\d+ cardId=\\w+ player=(\\d+)\\] pos from \\d+ -> (\\d+)");
+
+    for(QRegularExpression &pattern: patterns)   pattern.optimize();
+    return patterns;
+}
+
+
+const QRegularExpression &LogPatterns::get(LogPattern logPattern)
+{
+    //Inicializacion thread-safe (C++11) la primera vez que se usa
+    static const QVector<QRegularExpression> patterns = buildPatterns();
+    return patterns.at(logPattern);
+}
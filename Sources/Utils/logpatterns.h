@@ -0,0 +1,35 @@
+#ifndef LOGPATTERNS_H
+#define LOGPATTERNS_H
+
+#include <QRegularExpression>
+#include <QVector>
+
+//Patrones de GameWatcher. Se compilan una sola vez (optimize() --> JIT) en lugar de crear
+//un QRegularExpression nuevo en cada line.contains() de cada linea del log.
+//Las lineas de PowerTaskList en juego no usan patrones, se trocean con PowerTokenizer.
+enum LogPattern {
+    //LoadingScreen
+    LP_LOADING_SCREEN,
+    //Arena
+    LP_ARENA_NEW, LP_ARENA_PICK, LP_ARENA_READ_DECK_START, LP_ARENA_READ_DECK_CARD,
+    LP_ARENA_BEGIN, LP_ARENA_CHOICES,
+    //Power
+    LP_POWER_CREATE_HERO,
+    //Power mulligan
+    LP_MULLIGAN_PLAYER, LP_MULLIGAN_DONE, LP_MULLIGAN_COIN,
+    //Zone
+    LP_ZONE_UNKNOWN, LP_ZONE_KNOWN, LP_ZONE_POS,
+    LP_NUM_PATTERNS
+};
+
+class LogPatterns
+{
+//Metodos
+private:
+    static QVector<QRegularExpression> buildPatterns();
+
+public:
+    static const QRegularExpression &get(LogPattern logPattern);
+};
+
+#endif // LOGPATTERNS_H
@@ -0,0 +1,190 @@
+#include "logsink.h"
+#include <QSet>
+#include <QtWidgets>
+
+
+QAtomicInt LogSink::minLevel(Normal);
+
+
+LogSink::LogSink(QObject *parent) : QThread(parent)
+{
+    stopping = false;
+    urgent = false;
+    flushRequests = flushesDone = 0;
+}
+
+
+LogSink::~LogSink()
+{
+    stop();
+    wait();
+}
+
+
+void LogSink::run()
+{
+    forever
+    {
+        QList<LogSinkEntry> batch;
+        quint64 flushesServed;
+        bool stop;
+        {
+            QMutexLocker locker(&mutex);
+            while(entries.isEmpty() && !stopping && !urgent)    condition.wait(&mutex);
+
+            //El lote se cierra con LOG_SINK_BATCH lineas o LOG_SINK_FLUSH_MS despues de empezarlo
+            QElapsedTimer batchTimer;
+            batchTimer.start();
+            while(!stopping && !urgent && entries.count() < LOG_SINK_BATCH)
+            {
+                qint64 remaining = LOG_SINK_FLUSH_MS - batchTimer.elapsed();
+                if(remaining <= 0)  break;
+                condition.wait(&mutex, static_cast<unsigned long>(remaining));
+            }
+
+            batch.swap(entries);
+            urgent = false;
+            flushesServed = flushRequests;
+            stop = stopping;
+        }
+
+        processBatch(batch);
+
+        {
+            QMutexLocker locker(&mutex);
+            flushesDone = flushesServed;
+            flushedCondition.wakeAll();
+        }
+        if(stop)    break;
+    }
+
+    for(const QString &path: files.keys())  closeFile(path);
+}
+
+
+void LogSink::enqueue(LogSinkOp op, const QString &path, const QString &text)
+{
+    LogSinkEntry entry;
+    entry.op = op;
+    entry.path = path;
+    entry.text = text;
+
+    QMutexLocker locker(&mutex);
+    if(stopping)    return;
+    entries.append(entry);
+    if(op != LogWrite)  urgent = true;
+    if(urgent || entries.count() == 1 || entries.count() >= LOG_SINK_BATCH)     condition.wakeOne();
+}
+
+
+void LogSink::processBatch(const QList<LogSinkEntry> &batch)
+{
+    QSet<QFile *> touchedFiles;
+    for(const LogSinkEntry &entry: batch)
+    {
+        if(entry.op == LogWrite)
+        {
+            QFile *file = getFile(entry.path);
+            if(file == nullptr)     continue;
+            file->write((entry.text + '\n').toLocal8Bit());
+            touchedFiles.insert(file);
+        }
+        else
+        {
+            touchedFiles.remove(files.value(entry.path, nullptr));
+            closeFile(entry.path);
+            if(entry.op == LogRemove)   QFile::remove(entry.path);
+        }
+    }
+
+    for(QFile *file: touchedFiles)  file->flush();
+}
+
+
+//Los ficheros se abren una vez en modo Append y siguen abiertos hasta close/remove/stop
+QFile *LogSink::getFile(const QString &path)
+{
+    QFile *file = files.value(path, nullptr);
+    if(file != nullptr)     return file;
+
+    file = new QFile(path);
+    if(!file->open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+    {
+        qDebug() << "LogSink: Cannot open" << path;
+        delete file;
+        return nullptr;
+    }
+    files[path] = file;
+    return file;
+}
+
+
+void LogSink::closeFile(const QString &path)
+{
+    QFile *file = files.take(path);
+    if(file == nullptr)     return;
+    file->close();
+    delete file;
+}
+
+
+void LogSink::write(const QString &path, const QString &line)
+{
+    enqueue(LogWrite, path, line);
+}
+
+
+void LogSink::close(const QString &path)
+{
+    enqueue(LogClose, path);
+}
+
+
+void LogSink::remove(const QString &path)
+{
+    enqueue(LogRemove, path);
+}
+
+
+//Cierra el lote actual sin esperar a que se escriba (lineas de Error desde el hilo de la GUI)
+void LogSink::requestFlush()
+{
+    QMutexLocker locker(&mutex);
+    if(stopping)    return;
+    urgent = true;
+    condition.wakeOne();
+}
+
+
+//Bloquea hasta que lo ya encolado este escrito en disco (cierre de la app)
+void LogSink::flush()
+{
+    QMutexLocker locker(&mutex);
+    if(stopping || !isRunning())    return;
+    quint64 flushRequest = ++flushRequests;
+    urgent = true;
+    condition.wakeOne();
+    while(flushesDone < flushRequest && isRunning())    flushedCondition.wait(&mutex, LOG_SINK_FLUSH_MS);
+}
+
+
+//Lo ya encolado se escribe antes de que termine el hilo
+void LogSink::stop()
+{
+    QMutexLocker locker(&mutex);
+    stopping = true;
+    condition.wakeOne();
+}
+
+
+void LogSink::setMinLevel(DebugLevel level)
+{
+    minLevel.storeRelease(level);
+}
+
+
+//Se puede consultar desde cualquier hilo antes de formatear la linea
+bool LogSink::isEnabled(DebugLevel level)
+{
+    return level >= minLevel.loadAcquire();
+}
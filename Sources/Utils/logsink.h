@@ -0,0 +1,74 @@
+#ifndef LOGSINK_H
+#define LOGSINK_H
+
+#include "../utility.h"
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInt>
+#include <QFile>
+#include <QHash>
+#include <QList>
+#include <QElapsedTimer>
+
+#define LOG_SINK_FLUSH_MS 500           //Como mucho este tiempo desde la primera linea del lote hasta escribirla a disco
+#define LOG_SINK_BATCH 256              //Lineas encoladas que cierran el lote antes de tiempo
+
+
+enum LogSinkOp {LogWrite, LogClose, LogRemove};
+
+
+class LogSinkEntry
+{
+public:
+    LogSinkOp op;
+    QString path;
+    QString text;
+};
+
+
+//Escritura de logs (ArenaTrackerLog.txt, DRAFT *.arenatracker) en un hilo propio.
+//Los productores solo encolan la linea (el mutex se mantiene lo justo para el append y el swap del lote),
+//el hilo de escritura junta lineas hasta LOG_SINK_BATCH o LOG_SINK_FLUSH_MS, mantiene los ficheros abiertos
+//y hace flush una vez por lote. Cerrar/borrar un fichero, requestFlush(), flush() y stop() cierran el lote en el momento.
+//Las operaciones de un mismo fichero (escribir, cerrar, borrar) se ejecutan en el orden en que se encolan.
+class LogSink : public QThread
+{
+    Q_OBJECT
+public:
+    LogSink(QObject *parent = nullptr);
+    ~LogSink() override;
+
+//Variables
+private:
+    QMutex mutex;
+    QWaitCondition condition;
+    QWaitCondition flushedCondition;
+    QList<LogSinkEntry> entries;
+    bool stopping;
+    bool urgent;                        //Cerrar el lote sin esperar (close/remove/flush)
+    quint64 flushRequests, flushesDone;
+    QHash<QString, QFile *> files;      //Solo se usa desde el hilo de escritura
+    static QAtomicInt minLevel;
+
+//Metodos
+private:
+    void run() override;
+    void enqueue(LogSinkOp op, const QString &path, const QString &text=QString());
+    void processBatch(const QList<LogSinkEntry> &batch);
+    QFile *getFile(const QString &path);
+    void closeFile(const QString &path);
+
+public:
+    void write(const QString &path, const QString &line);
+    void close(const QString &path);
+    void remove(const QString &path);
+    void requestFlush();
+    void flush();
+    void stop();
+
+    static void setMinLevel(DebugLevel level);
+    static bool isEnabled(DebugLevel level);
+};
+
+#endif // LOGSINK_H
@@ -0,0 +1,114 @@
+#include "pixmapcache.h"
+#include "../utility.h"
+#include <QPixmapCache>
+
+
+bool PixmapCache::limitSet = false;
+QHash<QString, QSet<QString>> PixmapCache::cardKeys;
+QSet<QString> PixmapCache::missingPaths;
+
+
+QString PixmapCache::cardPath(const QString &code)
+{
+    return Utility::hscardsPath() + "/" + code + ".png";
+}
+
+
+QString PixmapCache::cropKey(const QString &path, const QRect &crop, const QSize &scale)
+{
+    return path + "|" + QString::number(crop.x()) + "," + QString::number(crop.y()) + "," +
+            QString::number(crop.width()) + "x" + QString::number(crop.height()) + "|" +
+            QString::number(scale.width()) + "x" + QString::number(scale.height());
+}
+
+
+void PixmapCache::checkLimit()
+{
+    if(!limitSet)
+    {
+        QPixmapCache::setCacheLimit(PIXMAP_CACHE_LIMIT_KB);
+        limitSet = true;
+    }
+}
+
+
+QPixmap PixmapCache::get(const QString &path)
+{
+    checkLimit();
+    QPixmap pixmap;
+    if(QPixmapCache::find(path, &pixmap))   return pixmap;
+    if(missingPaths.contains(path))         return pixmap;
+
+    pixmap.load(path);
+    if(pixmap.isNull())     missingPaths.insert(path);
+    else                    QPixmapCache::insert(path, pixmap);
+    return pixmap;
+}
+
+
+//Recorte de la imagen y escalado opcional (Qt::SmoothTransformation), se guarda ya recortado
+QPixmap PixmapCache::get(const QString &path, const QRect &crop, const QSize &scale)
+{
+    QString key = cropKey(path, crop, scale);
+    QPixmap pixmap;
+    if(QPixmapCache::find(key, &pixmap))    return pixmap;
+
+    QPixmap full = get(path);
+    if(full.isNull())   return full;
+
+    pixmap = full.copy(crop);
+    if(scale.isValid())     pixmap = pixmap.scaled(scale, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    QPixmapCache::insert(key, pixmap);
+    return pixmap;
+}
+
+
+QPixmap PixmapCache::card(const QString &code)
+{
+    QString path = cardPath(code);
+    cardKeys[code].insert(path);
+    return get(path);
+}
+
+
+QPixmap PixmapCache::card(const QString &code, const QRect &crop, const QSize &scale)
+{
+    QString path = cardPath(code);
+    cardKeys[code].insert(path);
+    cardKeys[code].insert(cropKey(path, crop, scale));
+    return get(path, crop, scale);
+}
+
+
+bool PixmapCache::findCardRender(const QString &key, QPixmap &pixmap)
+{
+    return QPixmapCache::find(key, &pixmap);
+}
+
+
+void PixmapCache::insertCardRender(const QString &code, const QString &key, const QPixmap &pixmap)
+{
+    if(pixmap.isNull())     return;
+    checkLimit();
+    cardKeys[code].insert(key);
+    QPixmapCache::insert(key, pixmap);
+}
+
+
+//Imagen de carta descargada de nuevo
+void PixmapCache::removeCard(const QString &code)
+{
+    QString path = cardPath(code);
+    missingPaths.remove(path);
+    QPixmapCache::remove(path);
+    for(const QString &key: cardKeys.take(code))    QPixmapCache::remove(key);
+}
+
+
+//Cambio de tema
+void PixmapCache::clear()
+{
+    QPixmapCache::clear();
+    cardKeys.clear();
+    missingPaths.clear();
+}
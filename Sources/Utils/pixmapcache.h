@@ -0,0 +1,44 @@
+#ifndef PIXMAPCACHE_H
+#define PIXMAPCACHE_H
+
+#include <QPixmap>
+#include <QString>
+#include <QHash>
+#include <QSet>
+#include <QRect>
+#include <QSize>
+
+#define PIXMAP_CACHE_LIMIT_KB 65536         //Limite de QPixmapCache, saca lo menos usado al llenarse
+
+
+//Cache de proceso de las imagenes que se pintan (arte de cartas en hscards, imagenes del tema y de recursos).
+//Las imagenes se decodifican una vez y los paint solo las buscan en memoria, sin acceder a disco.
+//Las imagenes que no existen tambien se recuerdan (carta pendiente de descargar) hasta removeCard/clear.
+//Tambien guarda imagenes ya pintadas a partir del arte de una carta (DeckCard::draw), que se invalidan con ella.
+//Solo se usa desde el hilo de GUI (QPixmapCache no es thread-safe).
+class PixmapCache
+{
+//Variables
+private:
+    static bool limitSet;
+    static QHash<QString, QSet<QString>> cardKeys;     //[code] --> Claves de la cache de ese codigo
+    static QSet<QString> missingPaths;
+
+//Metodos
+private:
+    static void checkLimit();
+    static QString cardPath(const QString &code);
+    static QString cropKey(const QString &path, const QRect &crop, const QSize &scale);
+
+public:
+    static QPixmap get(const QString &path);
+    static QPixmap get(const QString &path, const QRect &crop, const QSize &scale=QSize());
+    static QPixmap card(const QString &code);
+    static QPixmap card(const QString &code, const QRect &crop, const QSize &scale=QSize());
+    static bool findCardRender(const QString &key, QPixmap &pixmap);
+    static void insertCardRender(const QString &code, const QString &key, const QPixmap &pixmap);
+    static void removeCard(const QString &code);
+    static void clear();
+};
+
+#endif // PIXMAPCACHE_H
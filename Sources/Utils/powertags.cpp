@@ -0,0 +1,81 @@
+#include "powertags.h"
+#include <QHash>
+
+#define POWER_NAME_TEXT(NAME) QLatin1String(#NAME),
+
+static const QLatin1String powerTagNames[PT_NUM_TAGS] = { POWER_TAG_TABLE(POWER_NAME_TEXT) };
+static const QLatin1String powerZoneNames[PZ_NUM_ZONES] = { POWER_ZONE_TABLE(POWER_NAME_TEXT) };
+
+
+#define POWER_TAG_INSERT(TAG) tags.insert(QStringLiteral(#TAG), PT_##TAG);
+#define POWER_ZONE_INSERT(ZONE) zones.insert(QStringLiteral(#ZONE), PZ_##ZONE);
+
+static QHash<QString, PowerTag> buildTagIndex()
+{
+    QHash<QString, PowerTag> tags;
+    POWER_TAG_TABLE(POWER_TAG_INSERT)
+    return tags;
+}
+
+
+static QHash<QString, PowerZone> buildZoneIndex()
+{
+    QHash<QString, PowerZone> zones;
+    POWER_ZONE_TABLE(POWER_ZONE_INSERT)
+    return zones;
+}
+
+
+PowerTag PowerTags::tag(const QStringRef &text)
+{
+    return tag(text.toString());
+}
+
+
+PowerTag PowerTags::tag(const QString &text)
+{
+    static const QHash<QString, PowerTag> tagIndex = buildTagIndex();
+    return tagIndex.value(text, PT_UNKNOWN);
+}
+
+
+QString PowerTags::tagName(PowerTag tag)
+{
+    if(tag < 0 || tag >= PT_NUM_TAGS)   return "UNKNOWN";
+    return powerTagNames[tag];
+}
+
+
+PowerZone PowerTags::zone(const QStringRef &text)
+{
+    static const QHash<QString, PowerZone> zoneIndex = buildZoneIndex();
+    return zoneIndex.value(text.toString(), PZ_INVALID);
+}
+
+
+QString PowerTags::zoneName(PowerZone zone)
+{
+    if(zone < 0 || zone >= PZ_NUM_ZONES)    return powerZoneNames[PZ_INVALID];
+    return powerZoneNames[zone];
+}
+
+
+//El valor de ZONE se guarda como PowerZone, el resto de tags de tablero/recursos son enteros.
+int PowerTags::value(PowerTag tag, const QStringRef &text)
+{
+    if(tag == PT_ZONE)  return zone(text);
+    return text.toInt();
+}
+
+
+QString PowerTags::valueText(PowerTag tag, int value)
+{
+    if(tag == PT_ZONE)  return zoneName(static_cast<PowerZone>(value));
+    return QString::number(value);
+}
+
+
+bool PowerTags::isBoardTag(PowerTag tag)
+{
+    return tag >= PT_DAMAGE && tag <= PT_COST;
+}
@@ -0,0 +1,41 @@
+#ifndef POWERTAGS_H
+#define POWERTAGS_H
+
+#include <QString>
+#include <QStringRef>
+
+//Tabla unica de tags de Power.log que usa el tracker. Cada X(TAG) genera PT_TAG y su texto "TAG".
+//Los tags de tablero (DAMAGE..COST) deben ir seguidos, GameWatcher solo reenvia esos a PlanHandler.
+#define POWER_TAG_TABLE(X) \
+    X(DAMAGE) X(ATK) X(HEALTH) X(EXHAUSTED) X(DIVINE_SHIELD) X(STEALTH) X(TAUNT) X(CHARGE) \
+    X(ARMOR) X(FROZEN) X(WINDFURY) X(SILENCED) X(CONTROLLER) X(TO_BE_DESTROYED) X(AURA) \
+    X(CANT_BE_DAMAGED) X(SHOULDEXITCOMBAT) X(ZONE) X(LINKED_ENTITY) X(DURABILITY) X(COST) \
+    X(RESOURCES) X(RESOURCES_USED) X(CURRENT_SPELLPOWER) \
+    X(CLASS) X(ARMS_DEALING) X(PLAYSTATE) X(TURN)
+
+//Valores del tag ZONE. PZ_INVALID (0) recoge cualquier zona desconocida.
+#define POWER_ZONE_TABLE(X) \
+    X(INVALID) X(PLAY) X(DECK) X(HAND) X(GRAVEYARD) X(REMOVEDFROMGAME) X(SETASIDE) X(SECRET)
+
+#define POWER_TAG_ENUM(TAG) PT_##TAG,
+#define POWER_ZONE_ENUM(ZONE) PZ_##ZONE,
+
+enum PowerTag { PT_UNKNOWN = -1, POWER_TAG_TABLE(POWER_TAG_ENUM) PT_NUM_TAGS };
+enum PowerZone { POWER_ZONE_TABLE(POWER_ZONE_ENUM) PZ_NUM_ZONES };
+
+
+class PowerTags
+{
+//Metodos
+public:
+    static PowerTag tag(const QStringRef &text);
+    static PowerTag tag(const QString &text);
+    static QString tagName(PowerTag tag);
+    static PowerZone zone(const QStringRef &text);
+    static QString zoneName(PowerZone zone);
+    static int value(PowerTag tag, const QStringRef &text);
+    static QString valueText(PowerTag tag, int value);
+    static bool isBoardTag(PowerTag tag);
+};
+
+#endif // POWERTAGS_H
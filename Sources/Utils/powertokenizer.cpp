@@ -0,0 +1,207 @@
+#include "powertokenizer.h"
+
+
+void PowerEntity::clear()
+{
+    valid = unknown = false;
+    name = zone = cardId = QStringRef();
+    id = zonePos = player = -1;
+}
+
+
+void PowerLine::clear()
+{
+    action = PA_NONE;
+    blockType = entityText = tag = value = newCardId = QStringRef();
+    powerTag = PT_UNKNOWN;
+    entity.clear();
+    target.clear();
+}
+
+
+bool PowerTokenizer::isWordChar(const QChar &c)
+{
+    //Equivalente a \w de QRegularExpression (sin UseUnicodePropertiesOption)
+    ushort u = c.unicode();
+    return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9') || u == '_';
+}
+
+
+void PowerTokenizer::skipSpaces(const QString &line, int &pos)
+{
+    while(pos < line.length() && line.at(pos) == QLatin1Char(' '))     pos++;
+}
+
+
+bool PowerTokenizer::expect(const QString &line, int &pos, const QLatin1String &literal)
+{
+    if(line.midRef(pos, literal.size()) != literal)     return false;
+    pos += literal.size();
+    return true;
+}
+
+
+QStringRef PowerTokenizer::readWord(const QString &line, int &pos)
+{
+    int start = pos;
+    while(pos < line.length() && isWordChar(line.at(pos)))  pos++;
+    return line.midRef(start, pos - start);
+}
+
+
+bool PowerTokenizer::readInt(const QString &line, int &pos, int &value)
+{
+    int start = pos;
+    if(pos < line.length() && line.at(pos) == QLatin1Char('-'))     pos++;
+    int digitsStart = pos;
+    while(pos < line.length() && line.at(pos).unicode() >= '0' && line.at(pos).unicode() <= '9')   pos++;
+
+    if(pos == digitsStart)
+    {
+        pos = start;
+        return false;
+    }
+    value = line.midRef(start, pos - start).toInt();
+    return true;
+}
+
+
+//[entityName=UNKNOWN ENTITY [cardType=INVALID] id=49 zone=HAND zonePos=3 cardId= player=2]
+bool PowerTokenizer::readEntity(const QString &line, int &pos, PowerEntity &entity)
+{
+    entity.clear();
+    if(!expect(line, pos, QLatin1String("[entityName=")))   return false;
+
+    //El nombre puede contener espacios y corchetes, el descriptor acaba en " player=N]"
+    //y el nombre en el ultimo " id=" antes de ese player.
+    int nameStart = pos;
+    int playerPos = line.indexOf(QLatin1String(" player="), pos);
+    if(playerPos == -1)     return false;
+    int idPos = line.lastIndexOf(QLatin1String(" id="), playerPos);
+    if(idPos < nameStart)   return false;
+    entity.name = line.midRef(nameStart, idPos - nameStart);
+
+    pos = idPos;
+    if(!expect(line, pos, QLatin1String(" id=")) || !readInt(line, pos, entity.id))             return false;
+    if(!expect(line, pos, QLatin1String(" zone=")))                                             return false;
+    entity.zone = readWord(line, pos);
+    if(entity.zone.isEmpty())                                                                   return false;
+    if(!expect(line, pos, QLatin1String(" zonePos=")) || !readInt(line, pos, entity.zonePos))   return false;
+    if(!expect(line, pos, QLatin1String(" cardId=")))                                           return false;
+    entity.cardId = readWord(line, pos);
+    if(!expect(line, pos, QLatin1String(" player=")) || !readInt(line, pos, entity.player))     return false;
+    if(!expect(line, pos, QLatin1String("]")))                                                  return false;
+
+    entity.unknown = entity.cardId.isEmpty() && entity.name == QLatin1String("UNKNOWN ENTITY [cardType=INVALID]");
+    entity.valid = true;
+    return true;
+}
+
+
+//[...] CardID=EX1_595
+bool PowerTokenizer::readEntityUpdate(const QString &line, int &pos, PowerLine &powerLine)
+{
+    if(!readEntity(line, pos, powerLine.entity))            return false;
+    if(!expect(line, pos, QLatin1String(" CardID=")))       return false;
+    powerLine.newCardId = readWord(line, pos);
+    return !powerLine.newCardId.isEmpty();
+}
+
+
+//Trocea en una sola pasada las lineas de PowerTaskList que usa GameWatcher en juego.
+//Devuelve false (action = PA_NONE) si la linea no es de PowerTaskList o no tiene un formato conocido.
+bool PowerTokenizer::tokenize(const QString &line, PowerLine &powerLine)
+{
+    powerLine.clear();
+
+    int pos = line.indexOf(QLatin1String(POWER_TASK_LIST_PREFIX));
+    if(pos == -1)   return false;
+    pos += QLatin1String(POWER_TASK_LIST_PREFIX).size();
+    int textPos = pos;
+    skipSpaces(line, pos);
+
+    //SHOW_ENTITY tag
+    //PowerTaskList.DebugPrintPower() -         tag=HEALTH value=1
+    if(expect(line, pos, QLatin1String("tag=")))
+    {
+        powerLine.tag = readWord(line, pos);
+        if(powerLine.tag.isEmpty() || !expect(line, pos, QLatin1String(" value=")))     return false;
+        powerLine.value = readWord(line, pos);
+        if(powerLine.value.isEmpty())   return false;
+
+        powerLine.powerTag = PowerTags::tag(powerLine.tag);
+        powerLine.action = PA_SHOW_TAG;
+        return true;
+    }
+
+    //TAG_CHANGE Entity=SerKolobok tag=RESOURCES value=3
+    //TAG_CHANGE Entity=[entityName=Déspota del templo id=36 zone=PLAY zonePos=1 cardId=EX1_623 player=2] tag=ATK value=3
+    else if(expect(line, pos, QLatin1String("TAG_CHANGE Entity=")))
+    {
+        int entityPos = pos;
+        int tagPos = line.lastIndexOf(QLatin1String(" tag="));
+        if(tagPos <= entityPos)     return false;
+        powerLine.entityText = line.midRef(entityPos, tagPos - entityPos);
+
+        pos = tagPos + QLatin1String(" tag=").size();
+        powerLine.tag = readWord(line, pos);
+        if(powerLine.tag.isEmpty() || !expect(line, pos, QLatin1String(" value=")))     return false;
+        powerLine.value = readWord(line, pos);
+        if(powerLine.value.isEmpty())   return false;
+
+        //El descriptor debe acabar justo antes de " tag="
+        if(line.at(entityPos) == QLatin1Char('['))
+        {
+            if(!readEntity(line, entityPos, powerLine.entity) || entityPos != tagPos)  powerLine.entity.clear();
+        }
+
+        powerLine.powerTag = PowerTags::tag(powerLine.tag);
+        powerLine.action = PA_TAG_CHANGE;
+        return true;
+    }
+
+    //BLOCK_START BlockType=POWER Entity=[entityName=Elemental de Escarcha id=43 zone=PLAY zonePos=1 cardId=EX1_283 player=2]
+    //EffectCardId= EffectIndex=-1 Target=[entityName=Trituradora antigua de Sneed id=23 zone=PLAY zonePos=5 cardId=GVG_114 player=1]
+    //Solo BLOCK_START de primer nivel (sin indentar)
+    else if(pos == textPos + 1 && expect(line, pos, QLatin1String("BLOCK_START BlockType=")))
+    {
+        int effectIndex;
+        powerLine.blockType = readWord(line, pos);
+        if(powerLine.blockType.isEmpty())                                                           return false;
+        if(!expect(line, pos, QLatin1String(" Entity=")) || !readEntity(line, pos, powerLine.entity)) return false;
+        if(!expect(line, pos, QLatin1String(" EffectCardId=")))                                     return false;
+        readWord(line, pos);
+        if(!expect(line, pos, QLatin1String(" EffectIndex=")) || !readInt(line, pos, effectIndex))  return false;
+        if(!expect(line, pos, QLatin1String(" Target=")))                                           return false;
+        if(pos < line.length() && line.at(pos) == QLatin1Char('['))     readEntity(line, pos, powerLine.target);
+
+        powerLine.action = PA_BLOCK_START;
+        return true;
+    }
+
+    //SHOW_ENTITY - Updating Entity=[entityName=Maestra de secta id=50 zone=DECK zonePos=0 cardId= player=2] CardID=EX1_595
+    else if(expect(line, pos, QLatin1String("SHOW_ENTITY - Updating Entity=")))
+    {
+        if(!readEntityUpdate(line, pos, powerLine))     return false;
+        powerLine.action = PA_SHOW_ENTITY;
+        return true;
+    }
+
+    //FULL_ENTITY - Updating [entityName=Recluta Mano de Plata id=95 zone=PLAY zonePos=3 cardId=CS2_101t player=2] CardID=CS2_101t
+    else if(expect(line, pos, QLatin1String("FULL_ENTITY - Updating ")))
+    {
+        if(!readEntityUpdate(line, pos, powerLine))     return false;
+        powerLine.action = PA_FULL_ENTITY;
+        return true;
+    }
+
+    //CHANGE_ENTITY - Updating Entity=[entityName=Aullavísceras id=53 zone=HAND zonePos=3 cardId=EX1_411 player=2] CardID=OG_031
+    else if(expect(line, pos, QLatin1String("CHANGE_ENTITY - Updating Entity=")))
+    {
+        if(!readEntityUpdate(line, pos, powerLine))     return false;
+        powerLine.action = PA_CHANGE_ENTITY;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,61 @@
+#ifndef POWERTOKENIZER_H
+#define POWERTOKENIZER_H
+
+#include <QString>
+#include <QStringRef>
+#include "powertags.h"
+
+#define POWER_TASK_LIST_PREFIX "PowerTaskList.DebugPrintPower() -"
+
+enum PowerAction { PA_NONE, PA_SHOW_TAG, PA_TAG_CHANGE, PA_BLOCK_START, PA_SHOW_ENTITY, PA_FULL_ENTITY, PA_CHANGE_ENTITY };
+
+
+//[entityName=Jinete de lobos id=45 zone=PLAY zonePos=1 cardId=CS2_124 player=2]
+class PowerEntity
+{
+public:
+    PowerEntity(){clear();}
+    void clear();
+
+    bool valid;
+    bool unknown;   //UNKNOWN ENTITY [cardType=INVALID] con cardId vacio
+    QStringRef name, zone, cardId;
+    int id, zonePos, player;
+};
+
+
+//Linea de PowerTaskList ya troceada. Todos los QStringRef apuntan a la linea original,
+//no se crea ningun QString hasta que alguien lo necesite.
+class PowerLine
+{
+public:
+    PowerLine(){clear();}
+    void clear();
+
+    PowerAction action;
+    QStringRef blockType;   //BLOCK_START BlockType=
+    QStringRef entityText;  //TAG_CHANGE Entity=(.*) (nombre de jugador, GameEntity o descriptor)
+    PowerEntity entity, target;
+    QStringRef tag, value;  //TAG_CHANGE/SHOW_ENTITY tag
+    PowerTag powerTag;      //tag ya internado, PT_UNKNOWN si no esta en la tabla
+    QStringRef newCardId;   //SHOW_ENTITY/FULL_ENTITY/CHANGE_ENTITY CardID=
+};
+
+
+class PowerTokenizer
+{
+//Metodos
+private:
+    static bool isWordChar(const QChar &c);
+    static void skipSpaces(const QString &line, int &pos);
+    static bool expect(const QString &line, int &pos, const QLatin1String &literal);
+    static QStringRef readWord(const QString &line, int &pos);
+    static bool readInt(const QString &line, int &pos, int &value);
+    static bool readEntity(const QString &line, int &pos, PowerEntity &entity);
+    static bool readEntityUpdate(const QString &line, int &pos, PowerLine &powerLine);
+
+public:
+    static bool tokenize(const QString &line, PowerLine &powerLine);
+};
+
+#endif // POWERTOKENIZER_H
@@ -0,0 +1,265 @@
+#include "screenlocator.h"
+#include "../utility.h"
+#include "opencv2/features2d/features2d.hpp"
+#include "opencv2/nonfree/features2d.hpp"
+#include <QtWidgets>
+
+
+QMutex ScreenLocator::mutex;
+QHash<QString, TemplateFeatures> ScreenLocator::templateFeatures;
+QHash<QString, cv::Mat> ScreenLocator::homographies;
+
+
+bool ScreenLocator::getTemplateFeatures(const QString &templateImage, LocatorMethod method, TemplateFeatures &features)
+{
+    QString key = templateImage + "/" + QString::number(method);
+
+    QMutexLocker locker(&mutex);
+    if(templateFeatures.contains(key))
+    {
+        features = templateFeatures[key];
+        return true;
+    }
+
+    features.image = cv::imread((Utility::extraPath() + "/" + templateImage).toStdString(), CV_LOAD_IMAGE_GRAYSCALE);
+    if(!features.image.data)    return false;
+    detect(features.image, method, features.keypoints, features.descriptors);
+    templateFeatures[key] = features;
+    return true;
+}
+
+
+void ScreenLocator::detect(const cv::Mat &image, LocatorMethod method, std::vector<cv::KeyPoint> &keypoints, cv::Mat &descriptors)
+{
+    keypoints.clear();
+    if(method == OrbLocator)
+    {
+        cv::ORB orb(LOCATOR_ORB_FEATURES);
+        orb(image, cv::Mat(), keypoints, descriptors);
+    }
+    else
+    {
+        cv::SurfFeatureDetector detector(400);
+        detector.detect(image, keypoints);
+        cv::SurfDescriptorExtractor extractor;
+        extractor.compute(image, keypoints, descriptors);
+    }
+}
+
+
+//Homografia plantilla --> escena. Vacia si no hay suficientes matches buenos.
+cv::Mat ScreenLocator::matchHomography(const TemplateFeatures &features, const std::vector<cv::KeyPoint> &sceneKeypoints,
+                                       const cv::Mat &sceneDescriptors, LocatorMethod method)
+{
+    if(features.descriptors.empty() || sceneDescriptors.empty())    return cv::Mat();
+
+    std::vector<cv::DMatch> goodMatches;
+    if(method == OrbLocator)
+    {
+        //Descriptores binarios: Hamming y ratio test
+        cv::BFMatcher matcher(cv::NORM_HAMMING);
+        std::vector<std::vector<cv::DMatch>> knnMatches;
+        matcher.knnMatch(features.descriptors, sceneDescriptors, knnMatches, 2);
+        for(const std::vector<cv::DMatch> &knnMatch: knnMatches)
+        {
+            if(knnMatch.size() == 2 && knnMatch[0].distance < LOCATOR_ORB_RATIO*knnMatch[1].distance)
+            {
+                goodMatches.push_back(knnMatch[0]);
+            }
+        }
+    }
+    else
+    {
+        cv::FlannBasedMatcher matcher;
+        std::vector<cv::DMatch> matches;
+        matcher.match(features.descriptors, sceneDescriptors, matches);
+        for(const cv::DMatch &match: matches)
+        {
+            if(match.distance < LOCATOR_SURF_MAX_DIST)  goodMatches.push_back(match);
+        }
+    }
+
+    qDebug() << "ScreenLocator:" << (method==OrbLocator?"ORB":"SURF") << "Keypoints buenos:" << goodMatches.size();
+    if(goodMatches.size() < LOCATOR_MIN_MATCHES)    return cv::Mat();
+
+    std::vector<cv::Point2f> obj, scene;
+    for(const cv::DMatch &match: goodMatches)
+    {
+        obj.push_back(features.keypoints[static_cast<ulong>(match.queryIdx)].pt);
+        scene.push_back(sceneKeypoints[static_cast<ulong>(match.trainIdx)].pt);
+    }
+
+    std::vector<uchar> inliers;
+    cv::Mat H = cv::findHomography(obj, scene, CV_RANSAC, 3, inliers);
+    if(H.empty() || cv::countNonZero(inliers) < LOCATOR_MIN_MATCHES)   return cv::Mat();
+    return H;
+}
+
+
+//Busqueda gruesa en la captura reducida y refinado a resolucion completa en la zona de la plantilla
+cv::Mat ScreenLocator::search(const cv::Mat &sceneGray, const QString &templateImage, LocatorMethod method)
+{
+    TemplateFeatures features;
+    if(!getTemplateFeatures(templateImage, method, features))   return cv::Mat();
+
+    double scale = std::min(1.0, LOCATOR_MAX_WIDTH/static_cast<double>(sceneGray.cols));
+    cv::Mat smallScene = sceneGray;
+    if(scale < 1)   cv::resize(sceneGray, smallScene, cv::Size(), scale, scale, cv::INTER_AREA);
+
+    std::vector<cv::KeyPoint> sceneKeypoints;
+    cv::Mat sceneDescriptors;
+    detect(smallScene, method, sceneKeypoints, sceneDescriptors);
+    cv::Mat H = matchHomography(features, sceneKeypoints, sceneDescriptors, method);
+    if(H.empty() || scale >= 1)     return H;
+
+    cv::Mat unscale = (cv::Mat_<double>(3,3) << 1/scale, 0, 0,  0, 1/scale, 0,  0, 0, 1);
+    H = unscale * H;
+
+    cv::Rect roi = projectedBounds(H, features.image.size()) & cv::Rect(0, 0, sceneGray.cols, sceneGray.rows);
+    if(roi.area() == 0)     return H;
+
+    detect(sceneGray(roi), method, sceneKeypoints, sceneDescriptors);
+    for(cv::KeyPoint &keypoint: sceneKeypoints)
+    {
+        keypoint.pt.x += roi.x;
+        keypoint.pt.y += roi.y;
+    }
+    cv::Mat fineH = matchHomography(features, sceneKeypoints, sceneDescriptors, method);
+    return fineH.empty()?H:fineH;
+}
+
+
+//Rectangulo que ocupa la plantilla en la escena, con un 5% de margen
+cv::Rect ScreenLocator::projectedBounds(const cv::Mat &H, const cv::Size &templateSize)
+{
+    std::vector<cv::Point2f> corners(4), sceneCorners;
+    corners[0] = cv::Point2f(0, 0);
+    corners[1] = cv::Point2f(templateSize.width, 0);
+    corners[2] = cv::Point2f(templateSize.width, templateSize.height);
+    corners[3] = cv::Point2f(0, templateSize.height);
+    cv::perspectiveTransform(corners, sceneCorners, H);
+
+    cv::Rect bounds = cv::boundingRect(sceneCorners);
+    int marginX = bounds.width/20;
+    int marginY = bounds.height/20;
+    return cv::Rect(bounds.x - marginX, bounds.y - marginY, bounds.width + 2*marginX, bounds.height + 2*marginY);
+}
+
+
+//Correlacion normalizada de la plantilla con la escena llevada al plano de la plantilla
+double ScreenLocator::verifyHomography(const cv::Mat &sceneGray, const cv::Mat &templateGray, const cv::Mat &H)
+{
+    cv::Mat warped;
+    cv::warpPerspective(sceneGray, warped, H, templateGray.size(), cv::INTER_LINEAR | cv::WARP_INVERSE_MAP);
+
+    cv::Mat result;
+    cv::matchTemplate(warped, templateGray, result, CV_TM_CCOEFF_NORMED);
+    return static_cast<double>(result.at<float>(0,0));
+}
+
+
+cv::Mat ScreenLocator::loadHomography(const QString &key)
+{
+    QMutexLocker locker(&mutex);
+    if(homographies.contains(key))  return homographies[key];
+
+    QSettings settings("Arena Tracker", "Arena Tracker");
+    QVariantList values = settings.value("screenHomographies/" + key).toList();
+    if(values.count() != 9)     return cv::Mat();
+
+    cv::Mat H(3, 3, CV_64F);
+    for(int i=0; i<9; i++)  H.at<double>(i/3, i%3) = values[i].toDouble();
+    homographies[key] = H;
+    return H;
+}
+
+
+void ScreenLocator::saveHomography(const QString &key, const cv::Mat &H)
+{
+    QMutexLocker locker(&mutex);
+    homographies[key] = H.clone();
+
+    QVariantList values;
+    for(int i=0; i<9; i++)  values << H.at<double>(i/3, i%3);
+    QSettings settings("Arena Tracker", "Arena Tracker");
+    settings.setValue("screenHomographies/" + key, values);
+}
+
+
+std::vector<cv::Point2f> ScreenLocator::findTemplateOnScreen(const QString &templateImage, QScreen *screen,
+                                                             const std::vector<cv::Point2f> &templatePoints, QPointF &screenScale)
+{
+    std::vector<cv::Point2f> screenPoints;
+    QRect rect = screen->geometry();
+    QImage image = screen->grabWindow(0,rect.x(),rect.y(),rect.width(),rect.height()).toImage();
+    if(image.isNull())  return screenPoints;
+    if(image.format() != QImage::Format_RGB32 && image.format() != QImage::Format_ARGB32 &&
+        image.format() != QImage::Format_ARGB32_Premultiplied)
+    {
+        image = image.convertToFormat(QImage::Format_RGB32);
+    }
+
+    //Screen scale
+    screenScale.setX(rect.width() / static_cast<qreal>(image.width()));
+    screenScale.setY(rect.height() / static_cast<qreal>(image.height()));
+
+    cv::Mat screenCapture(image.height(),image.width(),CV_8UC4,image.bits(), static_cast<size_t>(image.bytesPerLine()));
+    cv::Mat sceneGray;
+    cv::cvtColor(screenCapture, sceneGray, CV_BGRA2GRAY);
+
+    QString rememberKey = templateImage + "/" + QString::number(image.width()) + "x" + QString::number(image.height()) +
+            "+" + QString::number(rect.x()) + "+" + QString::number(rect.y());
+    return findTemplateOnImage(templateImage, sceneGray, templatePoints, rememberKey);
+}
+
+
+//Con rememberKey vacio no se usa ni se guarda ninguna homografia (capturas guardadas, benchmark)
+std::vector<cv::Point2f> ScreenLocator::findTemplateOnImage(const QString &templateImage, const cv::Mat &sceneGray,
+                                                            const std::vector<cv::Point2f> &templatePoints, const QString &rememberKey)
+{
+    std::vector<cv::Point2f> screenPoints;
+    TemplateFeatures features;
+    if(!getTemplateFeatures(templateImage, OrbLocator, features))
+    {
+        qDebug() << "ScreenLocator: Cannot find" << templateImage;
+        return screenPoints;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    //Homografia recordada de un draft anterior. Si no se verifica (ventana tapada, transicion...) solo se salta
+    //en este intento: se mantiene guardada hasta que se verifique otra que la sustituya.
+    cv::Mat H;
+    if(!rememberKey.isEmpty())  H = loadHomography(rememberKey);
+    if(!H.empty())
+    {
+        double score = verifyHomography(sceneGray, features.image, H);
+        qDebug() << "ScreenLocator: Remembered homography" << rememberKey << "score:" << score;
+        if(score < LOCATOR_VERIFY_THRESHOLD)    H = cv::Mat();
+    }
+
+    //ORB solo se acepta si se verifica; SURF se acepta como antes aunque no se verifique, pero entonces no se recuerda.
+    if(H.empty())
+    {
+        H = search(sceneGray, templateImage, OrbLocator);
+        if(!H.empty() && verifyHomography(sceneGray, features.image, H) < LOCATOR_VERIFY_THRESHOLD)  H = cv::Mat();
+
+        if(H.empty())
+        {
+            H = search(sceneGray, templateImage, SurfLocator);
+        }
+
+        if(!H.empty() && !rememberKey.isEmpty() &&
+            verifyHomography(sceneGray, features.image, H) >= LOCATOR_VERIFY_THRESHOLD)
+        {
+            saveHomography(rememberKey, H);
+        }
+    }
+
+    qDebug() << "ScreenLocator:" << templateImage << (H.empty()?"not found":"found") << "in" << timer.elapsed() << "ms";
+    if(H.empty())   return screenPoints;
+
+    cv::perspectiveTransform(templatePoints, screenPoints, H);
+    return screenPoints;
+}
@@ -0,0 +1,63 @@
+#ifndef SCREENLOCATOR_H
+#define SCREENLOCATOR_H
+
+#include "opencv2/opencv.hpp"
+#include <QString>
+#include <QHash>
+#include <QMutex>
+#include <QScreen>
+#include <QPointF>
+
+#define LOCATOR_MAX_WIDTH 1280              //La busqueda gruesa se hace con la captura reducida a este ancho
+#define LOCATOR_MIN_MATCHES 10
+#define LOCATOR_ORB_FEATURES 2000
+#define LOCATOR_ORB_RATIO 0.75f
+#define LOCATOR_SURF_MAX_DIST 0.04f
+#define LOCATOR_VERIFY_THRESHOLD 0.4        //Correlacion minima de la plantilla con la zona de pantalla que indica la homografia
+
+
+enum LocatorMethod {OrbLocator, SurfLocator};
+
+
+class TemplateFeatures
+{
+public:
+    cv::Mat image;
+    std::vector<cv::KeyPoint> keypoints;
+    cv::Mat descriptors;
+};
+
+
+//Localiza las plantillas de pantalla de draft (arenaTemplate.png/heroesTemplate.png) en una captura.
+//Las features de las plantillas se calculan una sola vez. La busqueda se hace primero con ORB sobre la captura
+//reducida y se refina a resolucion completa en la zona encontrada; SURF queda como alternativa si ORB falla.
+//La homografia encontrada se recuerda por plantilla y geometria de pantalla (tambien en QSettings),
+//en los siguientes drafts solo se comprueba que sigue siendo valida.
+class ScreenLocator
+{
+//Variables
+private:
+    static QMutex mutex;
+    static QHash<QString, TemplateFeatures> templateFeatures;  //[templateImage/method] --> Features
+    static QHash<QString, cv::Mat> homographies;                //[templateImage/geometry] --> Homografia
+
+//Metodos
+private:
+    static bool getTemplateFeatures(const QString &templateImage, LocatorMethod method, TemplateFeatures &features);
+    static void detect(const cv::Mat &image, LocatorMethod method, std::vector<cv::KeyPoint> &keypoints, cv::Mat &descriptors);
+    static cv::Mat matchHomography(const TemplateFeatures &features, const std::vector<cv::KeyPoint> &sceneKeypoints,
+                                   const cv::Mat &sceneDescriptors, LocatorMethod method);
+    static cv::Mat search(const cv::Mat &sceneGray, const QString &templateImage, LocatorMethod method);
+    static cv::Rect projectedBounds(const cv::Mat &H, const cv::Size &templateSize);
+    static double verifyHomography(const cv::Mat &sceneGray, const cv::Mat &templateGray, const cv::Mat &H);
+    static cv::Mat loadHomography(const QString &key);
+    static void saveHomography(const QString &key, const cv::Mat &H);
+
+public:
+    static std::vector<cv::Point2f> findTemplateOnScreen(const QString &templateImage, QScreen *screen,
+                                                         const std::vector<cv::Point2f> &templatePoints, QPointF &screenScale);
+    static std::vector<cv::Point2f> findTemplateOnImage(const QString &templateImage, const cv::Mat &sceneGray,
+                                                        const std::vector<cv::Point2f> &templatePoints, const QString &rememberKey="");
+};
+
+#endif // SCREENLOCATOR_H
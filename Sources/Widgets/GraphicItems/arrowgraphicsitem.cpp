@@ -3,6 +3,7 @@
 #include "herographicsitem.h"
 #include "../../utility.h"
 #include "../../themehandler.h"
+#include "../../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 ArrowGraphicsItem::ArrowGraphicsItem(ArrowType arrowType)
@@ -16,6 +17,21 @@ ArrowGraphicsItem::ArrowGraphicsItem(ArrowType arrowType)
 }
 
 
+ArrowGraphicsItem::ArrowGraphicsItem(const ArrowState &state, MinionGraphicsItem *from, MinionGraphicsItem *to)
+{
+    this->arrowType = state.arrowType;
+    this->numAttacks = state.numAttacks;
+    this->from = from;
+    this->to = to;
+    this->friendly = from->isFriendly();
+    this->setPos(0, 0);
+
+    if(arrowType == reinforcement)      this->setZValue(1);
+    else if(arrowType == heroAttack)    this->setZValue(3);
+    else                                this->setZValue(2);
+}
+
+
 bool ArrowGraphicsItem::isFriendly()
 {
     return this->friendly;
@@ -55,6 +71,12 @@ ArrowGraphicsItem::ArrowType ArrowGraphicsItem::getArrowType()
 }
 
 
+int ArrowGraphicsItem::getNumAttacks()
+{
+    return this->numAttacks;
+}
+
+
 void ArrowGraphicsItem::increaseNumAttacks()
 {
     this->numAttacks++;
@@ -95,13 +117,13 @@ QPixmap ArrowGraphicsItem::getArrowPixmap(int &margen)
     {
         case heroAttack:
             margen = 120;
-            return QPixmap(":Images/arrowHeroAttack.png");
+            return PixmapCache::get(":Images/arrowHeroAttack.png");
         case reinforcement:
             margen = 80;
-            return QPixmap(":Images/arrowReinforce.png");
+            return PixmapCache::get(":Images/arrowReinforce.png");
         default:
             margen = 115;
-            return QPixmap (":Images/arrowAttack.png");
+            return PixmapCache::get(":Images/arrowAttack.png");
     }
 }
 
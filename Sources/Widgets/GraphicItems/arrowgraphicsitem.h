@@ -4,6 +4,7 @@
 #include <QGraphicsItem>
 #include "miniongraphicsitem.h"
 
+class ArrowState;
 
 class ArrowGraphicsItem : public QGraphicsItem
 {
@@ -13,6 +14,7 @@ public:
 //Constructor
 public:
     ArrowGraphicsItem(ArrowType arrowType=minionAttack);
+    ArrowGraphicsItem(const ArrowState &state, MinionGraphicsItem *from, MinionGraphicsItem *to);
 
 //Variables
 private:
@@ -35,6 +37,25 @@ public:
     void increaseNumAttacks();
     MinionGraphicsItem *getEnd(bool isFrom);
     ArrowType getArrowType();
+    int getNumAttacks();
+};
+
+
+//Extremo de la flecha en un turno archivado, pos -1 --> heroe
+class ArrowEnd
+{
+public:
+    bool friendly;
+    int pos;
+};
+
+
+class ArrowState
+{
+public:
+    ArrowGraphicsItem::ArrowType arrowType;
+    int numAttacks;
+    ArrowEnd from, to;
 };
 
 #endif // ARROWGRAPHICSITEM_H
@@ -2,6 +2,7 @@
 #include "herographicsitem.h"
 #include "../../utility.h"
 #include "../../themehandler.h"
+#include "../../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 
@@ -10,9 +11,9 @@ CardGraphicsItem::CardGraphicsItem( int id, QString code, QString createdByCode,
     this->code = code;
     this->createdByCode = createdByCode;
     this->id = id;
-    this->cost = this->origCost = Utility::getCardAttribute(code, "cost").toInt();
-    this->attack = this->origAttack = Utility::getCardAttribute(code, "attack").toInt();
-    this->health = this->origHealth = Utility::getCardAttribute(code, "health").toInt();
+    this->cost = this->origCost = Utility::getCostFromCode(code);
+    this->attack = this->origAttack = Utility::getAttackFromCode(code);
+    this->health = this->origHealth = Utility::getHealthFromCode(code);
     this->buffAttack = this->buffHealth = 0;
     this->played = this->discard = this->draw = false;
     this->heightShow = HEIGHT;
@@ -52,13 +53,41 @@ CardGraphicsItem::CardGraphicsItem(CardGraphicsItem *copy)
 }
 
 
-void CardGraphicsItem::changeCode(QString newCode)
+CardGraphicsItem::CardGraphicsItem(const CardState &state, GraphicsItemSender *graphicsItemSender)
+    :CardData(state.data)
+{
+    this->showTransparent = false;
+    this->graphicsItemSender = graphicsItemSender;
+    this->setPos(state.pos);
+    this->setZValue(state.zValue);
+    setAcceptHoverEvents(true);
+}
+
+
+CardState CardGraphicsItem::getState()
+{
+    CardState state;
+    state.data = *this;
+    state.pos = this->pos();
+    state.zValue = this->zValue();
+    return state;
+}
+
+
+//Tambien se usa sobre los datos de los turnos archivados (revealEnemyCardPrevTurns)
+void CardData::changeCode(QString newCode)
 {
     this->code = newCode;
-    this->cost = this->origCost = Utility::getCardAttribute(code, "cost").toInt();
-    this->attack = this->origAttack = Utility::getCardAttribute(code, "attack").toInt();
-    this->health = this->origHealth = Utility::getCardAttribute(code, "health").toInt();
+    this->cost = this->origCost = Utility::getCostFromCode(code);
+    this->attack = this->origAttack = Utility::getAttackFromCode(code);
+    this->health = this->origHealth = Utility::getHealthFromCode(code);
     this->buffAttack = this->buffHealth = 0;
+}
+
+
+void CardGraphicsItem::changeCode(QString newCode)
+{
+    CardData::changeCode(newCode);
     update();
 }
 
@@ -218,21 +247,21 @@ void CardGraphicsItem::setZonePos(bool friendly, int pos, int cardsZone, int vie
 }
 
 
-void CardGraphicsItem::processTagChange(QString tag, QString value)
+void CardGraphicsItem::processTagChange(PowerTag tag, int value)
 {
-    qDebug()<<"CARD TAG CHANGE -->"<<id<<tag<<value;
+    qDebug()<<"CARD TAG CHANGE -->"<<id<<PowerTags::tagName(tag)<<PowerTags::valueText(tag, value);
 
-    if(tag == "COST")
+    if(tag == PT_COST)
     {
-        this->cost = value.toInt();
+        this->cost = value;
     }
-    else if(tag == "ATK")
+    else if(tag == PT_ATK)
     {
-        this->attack = value.toInt();
+        this->attack = value;
     }
-    else if(tag == "HEALTH")
+    else if(tag == PT_HEALTH)
     {
-        this->health = value.toInt();
+        this->health = value;
     }
     update();
 }
@@ -245,20 +274,20 @@ void CardGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     if(showTransparent) painter->setOpacity(0.2);
 
     bool cardLifted = (played||discard)&&!draw;
-    if(played)          painter->drawPixmap(-WIDTH/2, -heightShow/2-CARD_LIFT, QPixmap(":/Images/bgCardGlow.png"), 0, 0, 190, heightShow+CARD_LIFT);
-    else if(discard)    painter->drawPixmap(-WIDTH/2, -heightShow/2-CARD_LIFT, QPixmap(":/Images/bgCardDiscard.png"), 0, 0, 190, heightShow+CARD_LIFT);
-    if(draw)            painter->drawPixmap(-WIDTH/2, -heightShow/2, QPixmap(":/Images/bgCardDraw.png"), 0, 0, 190, heightShow);
+    if(played)          painter->drawPixmap(-WIDTH/2, -heightShow/2-CARD_LIFT, PixmapCache::get(":/Images/bgCardGlow.png"), 0, 0, 190, heightShow+CARD_LIFT);
+    else if(discard)    painter->drawPixmap(-WIDTH/2, -heightShow/2-CARD_LIFT, PixmapCache::get(":/Images/bgCardDiscard.png"), 0, 0, 190, heightShow+CARD_LIFT);
+    if(draw)            painter->drawPixmap(-WIDTH/2, -heightShow/2, PixmapCache::get(":/Images/bgCardDraw.png"), 0, 0, 190, heightShow);
 
     if(!code.isEmpty())
     {
         painter->drawPixmap(-WIDTH/2, -heightShow/2+(cardLifted?-CARD_LIFT:0),
-                            QPixmap(Utility::hscardsPath() + "/" + code + ".png"), 5, 34, WIDTH,
+                            PixmapCache::card(code), 5, 34, WIDTH,
                             heightShow+(cardLifted?CARD_LIFT:0));
 
         if(cost != origCost)
         {
             painter->drawPixmap(-WIDTH/2 + 4, -heightShow/2+(cardLifted?-CARD_LIFT:0) + 5, 45, 45,
-                            QPixmap(":/Images/bgCrystal.png"),
+                            PixmapCache::get(":/Images/bgCrystal.png"),
                             0, 0, 66, 66);
 
             //Mana cost
@@ -284,7 +313,7 @@ void CardGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
         if(attack != origAttack)
         {
             painter->drawPixmap(-WIDTH/2 - 2, -heightShow/2 + 197 + (cardLifted?-CARD_LIFT:0), 52, 60,
-                            QPixmap(":/Images/bgHeroAttack.png"),
+                            PixmapCache::get(":/Images/bgHeroAttack.png"),
                             0, 0, 85, 98);
 
             QFont font(ThemeHandler::cardsFont());
@@ -309,7 +338,7 @@ void CardGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
         if(health != origHealth)
         {
             painter->drawPixmap(-WIDTH/2 - 5 + 151, -heightShow/2 - 34 + 234+(cardLifted?-CARD_LIFT:0), 39, 55,
-                            QPixmap(":/Images/bgHeroLife.png"),
+                            PixmapCache::get(":/Images/bgHeroLife.png"),
                             0, 0, 70, 98);
 
             QFont font(ThemeHandler::cardsFont());
@@ -335,16 +364,16 @@ void CardGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     else if(!createdByCode.isEmpty())
     {
         painter->drawPixmap(-48, -heightShow/2+24+(cardLifted?-CARD_LIFT:0),
-                            QPixmap(Utility::hscardsPath() + "/" + createdByCode + ".png"), 49, 60, 101, 66);
+                            PixmapCache::card(createdByCode), 49, 60, 101, 66);
         painter->drawPixmap(-81, -heightShow/2+15+(cardLifted?-CARD_LIFT:0),
-                            QPixmap(":/Images/bgCardCreatedBy.png"), 0, 0, 168,
+                            PixmapCache::get(":/Images/bgCardCreatedBy.png"), 0, 0, 168,
                             heightShow-15+(cardLifted?CARD_LIFT:0));
     }
 
     else
     {
         painter->drawPixmap(-81, -heightShow/2+15+(cardLifted?-CARD_LIFT:0),
-                            QPixmap(":/Images/bgCardUnknown.png"), 0, 0, 168,
+                            PixmapCache::get(":/Images/bgCardUnknown.png"), 0, 0, 168,
                             heightShow-15+(cardLifted?CARD_LIFT:0));
 
         //Turn
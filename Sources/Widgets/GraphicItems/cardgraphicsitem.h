@@ -3,22 +3,15 @@
 
 #include <QGraphicsItem>
 #include "graphicsitemsender.h"
+#include "../../Utils/powertags.h"
 #include "miniongraphicsitem.h"
 
 #define CARD_LIFT 10
 
 
-class CardGraphicsItem : public QGraphicsItem
+class CardData
 {
-friend class MinionGraphicsItem;
-
-//Constructor
 public:
-    CardGraphicsItem(int id, QString code, QString createdByCode, int turn, bool friendly, GraphicsItemSender *graphicsItemSender);
-    CardGraphicsItem(CardGraphicsItem *copy);
-
-//Variables
-private:
     QString code, createdByCode;
     int id, turn;
     bool played, discard, draw;
@@ -28,6 +21,32 @@ private:
     int buffAttack, buffHealth;
     int heightShow;
     bool friendly;
+
+    void changeCode(QString newCode);
+};
+
+
+class CardState
+{
+public:
+    CardData data;
+    QPointF pos;
+    qreal zValue = 0;
+};
+
+
+class CardGraphicsItem : public QGraphicsItem, protected CardData
+{
+friend class MinionGraphicsItem;
+
+//Constructor
+public:
+    CardGraphicsItem(int id, QString code, QString createdByCode, int turn, bool friendly, GraphicsItemSender *graphicsItemSender);
+    CardGraphicsItem(CardGraphicsItem *copy);
+    CardGraphicsItem(const CardState &state, GraphicsItemSender *graphicsItemSender);
+
+//Variables
+private:
     bool showTransparent;
     GraphicsItemSender *graphicsItemSender;
 
@@ -55,7 +74,7 @@ public:
     bool isDraw();
     void reduceCost(int cost);
     void togglePlayed();
-    void processTagChange(QString tag, QString value);
+    void processTagChange(PowerTag tag, int value);
     void addBuff(int addAttack, int addHealth);
     QString getCode();
     QString getCreatedByCode();
@@ -64,6 +83,7 @@ public:
     void setShowTransparent(bool value=true);
     bool isTransparent();
     void changeCode(QString newCode);
+    CardState getState();
 };
 
 #endif // CARDGRAPHICSITEM_H
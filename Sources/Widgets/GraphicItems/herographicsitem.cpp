@@ -1,13 +1,14 @@
 #include "herographicsitem.h"
 #include "../../utility.h"
 #include "../../themehandler.h"
+#include "../../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 HeroGraphicsItem::HeroGraphicsItem(QString code, int id, bool friendly, bool playerTurn,
                                    GraphicsItemSender *graphicsItemSender)
     :MinionGraphicsItem(code, id, friendly, playerTurn, graphicsItemSender)
 {
-    this->armor = Utility::getCardAttribute(code, "armor").toInt();
+    this->armor = Utility::getArmorFromCode(code);
     this->exausted = false;
     this->hero = true;
     this->minionsAttack = this->minionsMaxAttack = 0;
@@ -40,25 +41,44 @@ HeroGraphicsItem::HeroGraphicsItem(HeroGraphicsItem *copy, bool copySecretCodes)
     this->showAllInfo = false;
     this->heroWeapon = nullptr; //Al copiar el weapon en copyBoard se lo asignaremos al heroe a traves de setHeroWeapon()
 
-    foreach(SecretIcon secretIcon, copy->secretsList)
+    //Lista compartida (copy-on-write), solo se separa si hay que borrar algun codigo
+    this->secretsList = copy->secretsList;
+    if(!copySecretCodes)
     {
-        if(!copySecretCodes)
+        for(int i=0; i<secretsList.count(); i++)
         {
-            secretIcon.code = ""; //Los secretos pueden estar desvelados en nowBoard si solo tienen una opcion.
+            //Los secretos pueden estar desvelados en nowBoard si solo tienen una opcion.
+            if(!secretsList.at(i).code.isEmpty())   secretsList[i].code = "";
         }
-        this->secretsList.append(secretIcon);
     }
 }
 
 
+HeroGraphicsItem::HeroGraphicsItem(const HeroState &state, GraphicsItemSender *graphicsItemSender)
+    :MinionGraphicsItem(state.minion, graphicsItemSender), HeroData(state.hero)
+{
+    this->heroWeapon = nullptr; //Se lo asignaremos al heroe a traves de setHeroWeapon()
+}
+
+
+HeroState HeroGraphicsItem::getState()
+{
+    HeroState state;
+    state.valid = true;
+    state.minion = MinionGraphicsItem::getState();
+    state.hero = *this;
+    return state;
+}
+
+
 void HeroGraphicsItem::changeHero(QString code, int id)
 {
     this->code = code;
     this->id = id;
     this->attack = this->origAttack = 0;
-    this->health = this->origHealth = Utility::getCardAttribute(code, "health").toInt();
+    this->health = this->origHealth = Utility::getHealthFromCode(code);
     this->damage = 0;
-    this->armor += Utility::getCardAttribute(code, "armor").toInt();
+    this->armor += Utility::getArmorFromCode(code);
 
     initHeroCode();
     update();
@@ -342,19 +362,19 @@ void HeroGraphicsItem::showSecret(int id, QString code)
 }
 
 
-bool HeroGraphicsItem::processTagChange(QString tag, QString value)
+bool HeroGraphicsItem::processTagChange(PowerTag tag, int value)
 {
     bool healing = false;
-    if(tag == "ARMOR")
+    if(tag == PT_ARMOR)
     {
-        int newArmor = value.toInt();
+        int newArmor = value;
         if(newArmor > this->armor)  healing = true;
         this->armor = newArmor;
     }
     else
     {
         bool ret = MinionGraphicsItem::processTagChange(tag, value);
-        if(tag == "ATK" || tag == "EXHAUSTED" || tag == "FROZEN" || tag == "WINDFURY")  sendHeroTotalAttackChange();
+        if(tag == PT_ATK || tag == PT_EXHAUSTED || tag == PT_FROZEN || tag == PT_WINDFURY)  sendHeroTotalAttackChange();
         return ret;
     }
     update();
@@ -396,13 +416,12 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
 {
     Q_UNUSED(option);
 
-    QString heroCodePath = Utility::hscardsPath() + "/" + heroCode + ".png";
-    if(QFileInfo(heroCodePath).exists())
+    QPixmap heroPixmap = PixmapCache::card(heroCode);
+    if(!heroPixmap.isNull())
     {
         QRectF target = QRectF( -80, -92, 160, 184);
         QRectF source(34, 112, 240, 276);
-        QPixmap pixmap(heroCodePath);
-        painter->drawPixmap(target, pixmap, source);
+        painter->drawPixmap(target, heroPixmap, source);
     }
 
 
@@ -410,15 +429,15 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     bool glow = (!exausted && !frozen && (playerTurn==friendly) && attack>0);
     if(glow)
     {
-        painter->drawPixmap(-84, -92, QPixmap(":Images/bgHeroGlow.png"));
+        painter->drawPixmap(-84, -92, PixmapCache::get(":Images/bgHeroGlow.png"));
     }
 
     //Frozen
-    if(this->frozen)    painter->drawPixmap(-104, -104, QPixmap(":Images/bgHeroFrozen.png"));
+    if(this->frozen)    painter->drawPixmap(-104, -104, PixmapCache::get(":Images/bgHeroFrozen.png"));
 
 
     //Health
-    painter->drawPixmap(36, -6, QPixmap(":Images/bgHeroLife.png"));
+    painter->drawPixmap(36, -6, PixmapCache::get(":Images/bgHeroLife.png"));
 
     QFont font(ThemeHandler::cardsFont());
     font.setPixelSize(45);
@@ -442,7 +461,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     //Attack
     if(attack > 0)
     {
-        painter->drawPixmap(-114, -4, QPixmap(":Images/bgHeroAttack.png"));
+        painter->drawPixmap(-114, -4, PixmapCache::get(":Images/bgHeroAttack.png"));
 
         painter->setBrush(WHITE);
         text = QString::number(attack);
@@ -452,7 +471,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     //Armor
     if(armor > 0)
     {
-        painter->drawPixmap(41, -36, QPixmap(":Images/bgHeroArmor.png"));
+        painter->drawPixmap(41, -36, PixmapCache::get(":Images/bgHeroArmor.png"));
 
         painter->setBrush(WHITE);
         text = QString::number(armor);
@@ -462,7 +481,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     //Dead
     if(this->dead)
     {
-        painter->drawPixmap(-87/2, -94/2, QPixmap(":Images/bgHeroDead.png"));
+        painter->drawPixmap(-87/2, -94/2, PixmapCache::get(":Images/bgHeroDead.png"));
     }
 
     //Secrets
@@ -498,19 +517,19 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
         switch(secretHero)
         {
             case PALADIN:
-                pixmap = QPixmap(":Images/secretPaladin.png");
+                pixmap = PixmapCache::get(":Images/secretPaladin.png");
                 break;
             case HUNTER:
-                pixmap = QPixmap(":Images/secretHunter.png");
+                pixmap = PixmapCache::get(":Images/secretHunter.png");
                 break;
             case MAGE:
-                pixmap = QPixmap(":Images/secretMage.png");
+                pixmap = PixmapCache::get(":Images/secretMage.png");
                 break;
             case ROGUE:
-                pixmap = QPixmap(":Images/secretRogue.png");
+                pixmap = PixmapCache::get(":Images/secretRogue.png");
                 break;
             default:
-                pixmap = QPixmap(":Images/secretMage.png");
+                pixmap = PixmapCache::get(":Images/secretMage.png");
                 break;
         }
 
@@ -519,7 +538,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
         QString secretCode = secretsList[i].code;
         if(!secretCode.isEmpty())
         {
-            painter->setBrush(QBrush(QPixmap(Utility::hscardsPath() + "/" + secretCode + ".png")));
+            painter->setBrush(QBrush(PixmapCache::card(secretCode)));
             painter->setBrushOrigin(QPointF(100+moveX,202+moveY));
             painter->drawEllipse(QPointF(moveX,moveY), 16, 16);
         }
@@ -552,11 +571,11 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
 
         if(addonCode == "FATIGUE")
         {
-            painter->drawPixmap(moveX-32, moveY-32, QPixmap(":Images/bgFatigueAddon.png"));
+            painter->drawPixmap(moveX-32, moveY-32, PixmapCache::get(":Images/bgFatigueAddon.png"));
         }
         else
         {
-            painter->setBrush(QBrush(QPixmap(Utility::hscardsPath() + "/" + addonCode + ".png")));
+            painter->setBrush(QBrush(PixmapCache::card(addonCode)));
             painter->setBrushOrigin(QPointF(100+moveX,202+moveY));
             painter->drawEllipse(QPointF(moveX,moveY), 32, 32);
         }
@@ -577,7 +596,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
             addonPng = ":Images/bgMinionAddon.png";
             painter->setBrush(WHITE);
         }
-        painter->drawPixmap(moveX-35, moveY-35, QPixmap(addonPng));
+        painter->drawPixmap(moveX-35, moveY-35, PixmapCache::get(addonPng));
 
         //Numero
         if(addons[i].number > 1)
@@ -589,7 +608,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     //Dead Prob
     if(!FLOATEQ(deadProb, 0))
     {
-        painter->drawPixmap(-87/2, -94/2, QPixmap(":Images/bgHeroDead.png"));
+        painter->drawPixmap(-87/2, -94/2, PixmapCache::get(":Images/bgHeroDead.png"));
 
         //Numero
         painter->setBrush(RED);
@@ -600,7 +619,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
     if(playerTurn == friendly || showAllInfo)
     {
         //Mana
-        painter->drawPixmap(WIDTH/2-50, -HEIGHT/2+13, QPixmap(":Images/bgCrystal.png"));
+        painter->drawPixmap(WIDTH/2-50, -HEIGHT/2+13, PixmapCache::get(":Images/bgCrystal.png"));
 
         if(playerTurn != friendly)      text = QString::number(max(1,resources));
         else if(resourcesUsed == 0)     text = QString::number(max(1,resources));
@@ -610,7 +629,7 @@ void HeroGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *
 
 
         //Total attack
-        painter->drawPixmap(-WIDTH/2-30, -HEIGHT/2-13, QPixmap(":Images/bgTotalAttack.png"));
+        painter->drawPixmap(-WIDTH/2-30, -HEIGHT/2-13, PixmapCache::get(":Images/bgTotalAttack.png"));
         int totalAttack = this->minionsAttack;
         int totalMaxAttack = this->minionsMaxAttack;
         if(windfury)
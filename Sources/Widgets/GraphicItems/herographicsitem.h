@@ -6,8 +6,9 @@
 #include "../../Cards/secretcard.h"
 
 
-class HeroGraphicsItem : public MinionGraphicsItem
+class HeroData
 {
+public:
     class SecretIcon
     {
     public:
@@ -16,17 +17,32 @@ class HeroGraphicsItem : public MinionGraphicsItem
         CardClass secretHero;
     };
 
+    QString heroCode;
+    int armor, minionsAttack, minionsMaxAttack, resources, resourcesUsed, spellDamage;
+    bool showAllInfo;
+    QList<SecretIcon> secretsList;
+};
+
+
+class HeroState
+{
+public:
+    bool valid = false;
+    MinionState minion;
+    HeroData hero;
+};
+
+
+class HeroGraphicsItem : public MinionGraphicsItem, protected HeroData
+{
 //Constructor
 public:
     HeroGraphicsItem(QString code, int id, bool friendly, bool playerTurn, GraphicsItemSender *graphicsItemSender);
     HeroGraphicsItem(HeroGraphicsItem *copy, bool copySecretCodes=false);
+    HeroGraphicsItem(const HeroState &state, GraphicsItemSender *graphicsItemSender);
 
 //Variables:
 private:
-    QString heroCode;
-    int armor, minionsAttack, minionsMaxAttack, resources, resourcesUsed, spellDamage;
-    bool showAllInfo;
-    QList<SecretIcon> secretsList;
     WeaponGraphicsItem * heroWeapon;
 
 public:
@@ -48,7 +64,7 @@ private:
 public:
     QRectF boundingRect() const Q_DECL_OVERRIDE;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) Q_DECL_OVERRIDE;
-    bool processTagChange(QString tag, QString value);
+    bool processTagChange(PowerTag tag, int value);
     void addSecret(int id, CardClass secretHero);
     void removeSecret(int id);
     void showSecret(int id, QString code);
@@ -69,6 +85,7 @@ public:
     int getAvailableResources();
     void damagePlanningMinion(int damage=1);
     void checkDownloadedCode(QString code);
+    HeroState getState();
 };
 
 #endif // HEROGRAPHICSITEM_H
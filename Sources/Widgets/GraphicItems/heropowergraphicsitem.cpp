@@ -1,6 +1,7 @@
 #include "heropowergraphicsitem.h"
 #include "herographicsitem.h"
 #include "../../utility.h"
+#include "../../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 HeroPowerGraphicsItem::HeroPowerGraphicsItem(QString code, int id, bool friendly, bool playerTurn, GraphicsItemSender *graphicsItemSender)
@@ -37,6 +38,27 @@ HeroPowerGraphicsItem::HeroPowerGraphicsItem(HeroPowerGraphicsItem *copy)
 }
 
 
+HeroPowerGraphicsItem::HeroPowerGraphicsItem(const HeroPowerState &state, GraphicsItemSender *graphicsItemSender)
+    :HeroPowerData(state.data)
+{
+    this->showTransparent = false;
+    this->graphicsItemSender = graphicsItemSender;
+    this->setPos(state.pos);
+    this->setZValue(state.zValue);
+}
+
+
+HeroPowerState HeroPowerGraphicsItem::getState()
+{
+    HeroPowerState state;
+    state.valid = true;
+    state.data = *this;
+    state.pos = this->pos();
+    state.zValue = this->zValue();
+    return state;
+}
+
+
 void HeroPowerGraphicsItem::changeHeroPower(QString code, int id)
 {
     this->code = code;
@@ -121,13 +143,13 @@ void HeroPowerGraphicsItem::mousePressEvent(QGraphicsSceneMouseEvent * event)
 }
 
 
-void HeroPowerGraphicsItem::processTagChange(QString tag, QString value)
+void HeroPowerGraphicsItem::processTagChange(PowerTag tag, int value)
 {
-    qDebug()<<"TAG CHANGE -->"<<id<<tag<<value;
+    qDebug()<<"TAG CHANGE -->"<<id<<PowerTags::tagName(tag)<<PowerTags::valueText(tag, value);
 
-    if(tag == "EXHAUSTED")
+    if(tag == PT_EXHAUSTED)
     {
-        this->exausted = (value=="1");
+        this->exausted = (value == 1);
         if(exausted)    this->showTransparent = false;
         update();
     }
@@ -143,18 +165,18 @@ void HeroPowerGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsI
     if(playerTurn == friendly)
     {
         //Card background
-        painter->setBrush(QBrush(QPixmap(Utility::hscardsPath() + "/" + this->code + ".png")));
+        painter->setBrush(QBrush(PixmapCache::card(this->code)));
         painter->setBrushOrigin(QPointF(101,210));//99+2,204+6
         painter->drawEllipse(QPointF(2,6), 40, 40);
 
         //Glow
         if(exausted)
         {
-            painter->drawPixmap(-WIDTH/2, -HEIGHT/2, QPixmap(":/Images/bgHeroPowerGlow.png"));
+            painter->drawPixmap(-WIDTH/2, -HEIGHT/2, PixmapCache::get(":/Images/bgHeroPowerGlow.png"));
         }
 
         //Marco
-        painter->drawPixmap(-WIDTH/2, -HEIGHT/2, QPixmap(":/Images/bgHeroPower.png"));
+        painter->drawPixmap(-WIDTH/2, -HEIGHT/2, PixmapCache::get(":/Images/bgHeroPower.png"));
     }
-    else    painter->drawPixmap(-WIDTH/2, -HEIGHT/2, QPixmap(":/Images/bgHeroPowerClosed.png"));
+    else    painter->drawPixmap(-WIDTH/2, -HEIGHT/2, PixmapCache::get(":/Images/bgHeroPowerClosed.png"));
 }
@@ -3,20 +3,38 @@
 
 #include <QGraphicsItem>
 #include "graphicsitemsender.h"
+#include "../../Utils/powertags.h"
 
-class HeroPowerGraphicsItem : public QGraphicsItem
+class HeroPowerData
+{
+public:
+    QString code;
+    int id;
+    bool exausted;
+    bool friendly, playerTurn;
+};
+
+
+class HeroPowerState
+{
+public:
+    bool valid = false;
+    HeroPowerData data;
+    QPointF pos;
+    qreal zValue = 0;
+};
+
+
+class HeroPowerGraphicsItem : public QGraphicsItem, protected HeroPowerData
 {
 public:
 //Constructor
     HeroPowerGraphicsItem(QString code, int id, bool friendly, bool playerTurn, GraphicsItemSender *graphicsItemSender);
     HeroPowerGraphicsItem(HeroPowerGraphicsItem *copy);
+    HeroPowerGraphicsItem(const HeroPowerState &state, GraphicsItemSender *graphicsItemSender);
 
 //Variables
 private:
-    QString code;
-    int id;
-    bool exausted;
-    bool friendly, playerTurn;
     bool showTransparent;
     GraphicsItemSender *graphicsItemSender;
 
@@ -33,7 +51,7 @@ public:
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) Q_DECL_OVERRIDE;
     void checkDownloadedCode(QString code);
     void changeHeroPower(QString code, int id);
-    void processTagChange(QString tag, QString value);
+    void processTagChange(PowerTag tag, int value);
     int getId();
     void setPlayerTurn(bool playerTurn);
     void toggleExausted();
@@ -42,6 +60,7 @@ public:
     void showManaPlayable(int mana);
     void setShowTransparent(bool value=true);
     bool isTransparent();
+    HeroPowerState getState();
 };
 
 #endif // HEROPOWERGRAPHICSITEM_H
@@ -1,6 +1,7 @@
 #include "miniongraphicsitem.h"
 #include "../../utility.h"
 #include "../../themehandler.h"
+#include "../../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 MinionGraphicsItem::MinionGraphicsItem(QString code, int id, bool friendly, bool playerTurn, GraphicsItemSender *graphicsItemSender)
@@ -41,7 +42,7 @@ MinionGraphicsItem::MinionGraphicsItem(MinionGraphicsItem *copy, bool triggerMin
     this->addonsStacked = copy->addonsStacked;
     this->triggerMinion = triggerMinion;
     this->aura = copy->aura;
-    this->zone = "PLAY";
+    this->zone = PZ_PLAY;
     this->changeAttack = copy->changeAttack;
     this->changeHealth = copy->changeHealth;
     this->deadProb = 0;
@@ -50,10 +51,28 @@ MinionGraphicsItem::MinionGraphicsItem(MinionGraphicsItem *copy, bool triggerMin
     this->setZValue(copy->zValue());
     setAcceptHoverEvents(true);
 
-    foreach(Addon addon, copy->addons)
-    {
-        this->addons.append(addon);
-    }
+    //Lista compartida (copy-on-write) hasta que uno de los dos tableros la modifique
+    this->addons = copy->addons;
+}
+
+
+MinionGraphicsItem::MinionGraphicsItem(const MinionState &state, GraphicsItemSender *graphicsItemSender)
+    :MinionData(state.data)
+{
+    this->graphicsItemSender = graphicsItemSender;
+    this->setPos(state.pos);
+    this->setZValue(state.zValue);
+    setAcceptHoverEvents(true);
+}
+
+
+MinionState MinionGraphicsItem::getState()
+{
+    MinionState state;
+    state.data = *this;
+    state.pos = this->pos();
+    state.zValue = this->zValue();
+    return state;
 }
 
 
@@ -68,9 +87,9 @@ void MinionGraphicsItem::initCode(QString code)
 {
     this->code = code;
     this->hero = false;
-    this->attack = this->origAttack = Utility::getCardAttribute(code, "attack").toInt();
-    this->health = this->origHealth = Utility::getCardAttribute(code, "health").toInt();
-    if(health <= 0) this->health = this->origHealth = Utility::getCardAttribute(code, "durability").toInt();
+    this->attack = this->origAttack = Utility::getAttackFromCode(code);
+    this->health = this->origHealth = Utility::getHealthFromCode(code);
+    if(health <= 0) this->health = this->origHealth = Utility::getDurabilityFromCode(code);
 
     this->damage = 0;
     this->shield = false;
@@ -85,18 +104,18 @@ void MinionGraphicsItem::initCode(QString code)
     this->addonsStacked = false;
     this->triggerMinion = false;
     this->aura = false;
-    this->zone = "PLAY";
+    this->zone = PZ_PLAY;
     this->changeAttack = ChangeNone;
     this->changeHealth = ChangeNone;
     this->deadProb = 0;
 
     foreach(QJsonValue value, Utility::getCardAttribute(code, "mechanics").toArray())
     {
-        processTagChange(value.toString(), "1");
+        processTagChange(PowerTags::tag(value.toString()), 1);
     }
 
     //Leokk AURA
-    if(code == LEOKK || code == GRIMSCALE_ORACLE)   processTagChange("AURA", "1");
+    if(code == LEOKK || code == GRIMSCALE_ORACLE)   processTagChange(PT_AURA, 1);
 }
 
 
@@ -568,9 +587,9 @@ void MinionGraphicsItem::updateStatsFromCard(CardGraphicsItem * card)
 }
 
 
-bool MinionGraphicsItem::processTagChange(QString tag, QString value)
+bool MinionGraphicsItem::processTagChange(PowerTag tag, int value)
 {
-    qDebug()<<"MINION TAG CHANGE -->"<<id<<tag<<value;
+    qDebug()<<"MINION TAG CHANGE -->"<<id<<PowerTags::tagName(tag)<<PowerTags::valueText(tag, value);
 
     //Evita addons provocado por cambios despues de morir(en el log los minion vuelven a damage 0 y estado original justo antes de desaparecer de la zona)
     //Terror de fatalidad envia TO_BE_DESTROYED despues de hacer 2 de damage, para dar tiempo a invocar el demonio.
@@ -578,68 +597,68 @@ bool MinionGraphicsItem::processTagChange(QString tag, QString value)
     //Dark Speaker (minion 3/6 swap stats con otro minion) produce cambia el health a 0 antes del swap
     //lo que hace que el y su objetivo aparezcan muertos, por eso (this->health > 0)
     if((this->damage >= this->health && this->health > 0)
-            || (!this->hero && (this->zone !="PLAY" || this->toBeDestroyed)))
+            || (!this->hero && (this->zone != PZ_PLAY || this->toBeDestroyed)))
     {
         this->dead = true;
     }
 
     bool healing = false;
-    if(tag == "DAMAGE")
+    if(tag == PT_DAMAGE)
     {
-        int newDamage = value.toInt();
+        int newDamage = value;
         if(newDamage < this->damage)    healing = true;
         this->damage = newDamage;
     }
-    else if(tag == "TO_BE_DESTROYED" || tag == "SHOULDEXITCOMBAT")
+    else if(tag == PT_TO_BE_DESTROYED || tag == PT_SHOULDEXITCOMBAT)
     {
         this->toBeDestroyed = true;
         return healing;
     }
-    else if(tag == "ATK")
+    else if(tag == PT_ATK)
     {
-        this->attack = value.toInt();
+        this->attack = value;
     }
-    else if(tag == "HEALTH")
+    else if(tag == PT_HEALTH)
     {
-        this->health = value.toInt();
+        this->health = value;
     }
-    else if(tag == "EXHAUSTED")
+    else if(tag == PT_EXHAUSTED)
     {
-        this->exausted = (value=="1");
+        this->exausted = (value == 1);
     }
-    else if(tag == "DIVINE_SHIELD")
+    else if(tag == PT_DIVINE_SHIELD)
     {
-        this->shield = (value=="1");
+        this->shield = (value == 1);
     }
-    else if(tag == "TAUNT")
+    else if(tag == PT_TAUNT)
     {
-        this->taunt = (value=="1");
+        this->taunt = (value == 1);
     }
-    else if(tag == "CHARGE")
+    else if(tag == PT_CHARGE)
     {
-        this->charge = (value=="1");
+        this->charge = (value == 1);
         if(charge)    this->exausted = false;
     }
-    else if(tag == "STEALTH")
+    else if(tag == PT_STEALTH)
     {
-        this->stealth = (value=="1");
+        this->stealth = (value == 1);
     }
-    else if(tag == "FROZEN")
+    else if(tag == PT_FROZEN)
     {
-        this->frozen = (value=="1");
+        this->frozen = (value == 1);
     }
-    else if(tag == "WINDFURY")
+    else if(tag == PT_WINDFURY)
     {
-        this->windfury = (value=="1");
+        this->windfury = (value == 1);
     }
-    else if(tag == "AURA")
+    else if(tag == PT_AURA)
     {
-        this->aura = (value=="1");
+        this->aura = (value == 1);
         return healing;
     }
-    else if (tag == "ZONE")
+    else if (tag == PT_ZONE)
     {
-        this->zone = value;
+        this->zone = static_cast<PowerZone>(value);
         return healing;
     }
     else
@@ -658,29 +677,29 @@ void MinionGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     if(triggerMinion)   painter->setOpacity(0.6);
 
     //Card background
-    painter->setBrush(QBrush(QPixmap(Utility::hscardsPath() + "/" + this->code + ".png")));
+    painter->setBrush(QBrush(PixmapCache::card(this->code)));
     painter->setBrushOrigin(QPointF(100,191));
     painter->drawEllipse(QPointF(0,0), 50, 68);
 
     //Stealth
     if(this->stealth)
     {
-        painter->drawPixmap(-52, -71, QPixmap(":Images/bgMinionStealth.png"));
+        painter->drawPixmap(-52, -71, PixmapCache::get(":Images/bgMinionStealth.png"));
     }
 
     //Taunt/Frozen/Minion template
     bool glow = (!exausted && !frozen && (playerTurn==friendly) && attack>0);
     if(this->taunt)
     {
-        painter->drawPixmap(-70, -96, QPixmap(":Images/bgMinionTaunt" + QString(glow?"Glow":"Simple") + ".png"));
+        painter->drawPixmap(-70, -96, PixmapCache::get(":Images/bgMinionTaunt" + QString(glow?"Glow":"Simple") + ".png"));
 
-        if(this->frozen)        painter->drawPixmap(-76, -82, QPixmap(":Images/bgMinionFrozen.png"));
-        else                    painter->drawPixmap(-70, -80, QPixmap(":Images/bgMinionSimple.png"));
+        if(this->frozen)        painter->drawPixmap(-76, -82, PixmapCache::get(":Images/bgMinionFrozen.png"));
+        else                    painter->drawPixmap(-70, -80, PixmapCache::get(":Images/bgMinionSimple.png"));
     }
     else
     {
-        if(this->frozen)        painter->drawPixmap(-76, -82, QPixmap(":Images/bgMinionFrozen.png"));
-        else                    painter->drawPixmap(-70, -80, QPixmap(":Images/bgMinion" + QString(glow?"Glow":"Simple") + ".png"));
+        if(this->frozen)        painter->drawPixmap(-76, -82, PixmapCache::get(":Images/bgMinionFrozen.png"));
+        else                    painter->drawPixmap(-70, -80, PixmapCache::get(":Images/bgMinion" + QString(glow?"Glow":"Simple") + ".png"));
     }
 
 
@@ -714,13 +733,13 @@ void MinionGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     //Shield
     if(this->shield)
     {
-        painter->drawPixmap(-71, -92, QPixmap(":Images/bgMinionShield.png"));
+        painter->drawPixmap(-71, -92, PixmapCache::get(":Images/bgMinionShield.png"));
     }
 
     //Dead
     if(this->dead)
     {
-        painter->drawPixmap(-23, 25, QPixmap(":Images/bgMinionDead.png"));
+        painter->drawPixmap(-23, 25, PixmapCache::get(":Images/bgMinionDead.png"));
     }
 
     //Addons
@@ -750,11 +769,11 @@ void MinionGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
 
         if(addonCode == "FATIGUE")
         {
-            painter->drawPixmap(moveX-32, moveY-32, QPixmap(":Images/bgFatigueAddon.png"));
+            painter->drawPixmap(moveX-32, moveY-32, PixmapCache::get(":Images/bgFatigueAddon.png"));
         }
         else
         {
-            painter->setBrush(QBrush(QPixmap(Utility::hscardsPath() + "/" + addonCode + ".png")));
+            painter->setBrush(QBrush(PixmapCache::card(addonCode)));
             painter->setBrushOrigin(QPointF(100+moveX,202+moveY));
             painter->drawEllipse(QPointF(moveX,moveY), 32, 32);
         }
@@ -775,7 +794,7 @@ void MinionGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
             addonPng = ":Images/bgMinionAddon.png";
             painter->setBrush(WHITE);
         }
-        painter->drawPixmap(moveX-35, moveY-35, QPixmap(addonPng));
+        painter->drawPixmap(moveX-35, moveY-35, PixmapCache::get(addonPng));
 
         //Numero
         if(addons[i].number > 1)
@@ -822,7 +841,7 @@ void MinionGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     //Dead Prob
     if(!FLOATEQ(deadProb, 0))
     {
-        painter->drawPixmap(-87/2, -94/2, QPixmap(":Images/bgHeroDead.png"));
+        painter->drawPixmap(-87/2, -94/2, PixmapCache::get(":Images/bgHeroDead.png"));
 
         //Numero
         painter->setBrush(RED);
@@ -3,6 +3,7 @@
 
 #include <QGraphicsItem>
 #include "graphicsitemsender.h"
+#include "../../Utils/powertags.h"
 #include "cardgraphicsitem.h"
 
 
@@ -18,17 +19,13 @@ public:
 };
 
 
-class MinionGraphicsItem : public QGraphicsItem
+//Datos del esbirro sin el QGraphicsItem, es lo que se guarda de los turnos archivados.
+//Las listas y strings son compartidas (copy-on-write) con el item del que salen.
+class MinionData
 {
 public:
     enum ValueChange { ChangePositive, ChangeNegative, ChangeNone };
 
-//Constructor
-    MinionGraphicsItem(QString code, int id, bool friendly, bool playerTurn, GraphicsItemSender *graphicsItemSender);
-    MinionGraphicsItem(MinionGraphicsItem *copy, bool triggerMinion=false);
-
-//Variables
-protected:
     QString code;
     int origAttack, origHealth;
     int attack, health, id;
@@ -39,10 +36,32 @@ protected:
     bool addonsStacked;
     bool triggerMinion;
     bool aura;
-    QString zone;
+    PowerZone zone;
     ValueChange changeAttack, changeHealth;
-    GraphicsItemSender *graphicsItemSender;
     float deadProb;
+};
+
+
+class MinionState
+{
+public:
+    MinionData data;
+    QPointF pos;
+    qreal zValue = 0;
+};
+
+
+class MinionGraphicsItem : public QGraphicsItem, protected MinionData
+{
+//Constructor
+public:
+    MinionGraphicsItem(QString code, int id, bool friendly, bool playerTurn, GraphicsItemSender *graphicsItemSender);
+    MinionGraphicsItem(MinionGraphicsItem *copy, bool triggerMinion=false);
+    MinionGraphicsItem(const MinionState &state, GraphicsItemSender *graphicsItemSender);
+
+//Variables
+protected:
+    GraphicsItemSender *graphicsItemSender;
 
 public:
     static const int WIDTH = 142;
@@ -59,7 +78,7 @@ protected:
 public:
     QRectF boundingRect() const Q_DECL_OVERRIDE;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) Q_DECL_OVERRIDE;
-    bool processTagChange(QString tag, QString value);
+    bool processTagChange(PowerTag tag, int value);
     void setPlayerTurn(bool playerTurn);
     void setDead(bool value);
     void changeZone();
@@ -89,6 +108,7 @@ public:
     void updateStatsFromCard(CardGraphicsItem *card);
     void addPlanningAddon(QString code, Addon::AddonType type);
     void changeCode(QString newCode);
+    MinionState getState();
 
 private:
     void addAddonNeutral(Addon addon);
@@ -2,6 +2,7 @@
 #include "herographicsitem.h"
 #include "../../utility.h"
 #include "../../themehandler.h"
+#include "../../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 WeaponGraphicsItem::WeaponGraphicsItem(QString code, int id, bool friendly, GraphicsItemSender *graphicsItemSender)
@@ -9,7 +10,7 @@ WeaponGraphicsItem::WeaponGraphicsItem(QString code, int id, bool friendly, Grap
 {
     this->durability = this->origDurability =
             this->health = this->origHealth =
-            Utility::getCardAttribute(code, "durability").toInt();
+            Utility::getDurabilityFromCode(code);
 
     const int hMinion = MinionGraphicsItem::HEIGHT-5;
     const int hHero = HeroGraphicsItem::HEIGHT;
@@ -29,18 +30,34 @@ WeaponGraphicsItem::WeaponGraphicsItem(WeaponGraphicsItem *copy)
 }
 
 
+WeaponGraphicsItem::WeaponGraphicsItem(const WeaponState &state, GraphicsItemSender *graphicsItemSender)
+    :MinionGraphicsItem(state.minion, graphicsItemSender), WeaponData(state.weapon)
+{
+}
+
+
+WeaponState WeaponGraphicsItem::getState()
+{
+    WeaponState state;
+    state.valid = true;
+    state.minion = MinionGraphicsItem::getState();
+    state.weapon = *this;
+    return state;
+}
+
+
 QRectF WeaponGraphicsItem::boundingRect() const
 {
     return QRectF( -WIDTH/2, -HEIGHT/2, WIDTH, HEIGHT);
 }
 
 
-bool WeaponGraphicsItem::processTagChange(QString tag, QString value)
+bool WeaponGraphicsItem::processTagChange(PowerTag tag, int value)
 {
     bool healing = false;
-    if(tag == "DURABILITY")
+    if(tag == PT_DURABILITY)
     {
-        int newDurability = value.toInt();
+        int newDurability = value;
         if(newDurability > this->durability)  healing = true;
         this->durability = this->health = newDurability;
     }
@@ -58,12 +75,12 @@ void WeaponGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     Q_UNUSED(option);
 
     //Card background
-    painter->setBrush(QBrush(QPixmap(Utility::hscardsPath() + "/" + this->code + ".png")));
+    painter->setBrush(QBrush(PixmapCache::card(this->code)));
     painter->setBrushOrigin(QPointF(99,193));
     painter->drawEllipse(QPointF(0,0), 56, 56);
 
     //Marco
-    painter->drawPixmap(-WIDTH/2, -HEIGHT/2, QPixmap(":/Images/bgWeaponSimple.png"));
+    painter->drawPixmap(-WIDTH/2, -HEIGHT/2, PixmapCache::get(":/Images/bgWeaponSimple.png"));
 
     //Attack/Durability
     QFont font(ThemeHandler::cardsFont());
@@ -94,6 +111,6 @@ void WeaponGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     //Dead
     if(this->dead)
     {
-        painter->drawPixmap(-23, 17, QPixmap(":Images/bgMinionDead.png"));
+        painter->drawPixmap(-23, 17, PixmapCache::get(":Images/bgMinionDead.png"));
     }
 }
@@ -3,16 +3,29 @@
 
 #include "miniongraphicsitem.h"
 
-class WeaponGraphicsItem : public MinionGraphicsItem
+class WeaponData
+{
+public:
+    int durability, origDurability;
+};
+
+
+class WeaponState
+{
+public:
+    bool valid = false;
+    MinionState minion;
+    WeaponData weapon;
+};
+
+
+class WeaponGraphicsItem : public MinionGraphicsItem, protected WeaponData
 {
 //Constructor
 public:
     WeaponGraphicsItem(QString code, int id, bool friendly, GraphicsItemSender *graphicsItemSender);
     WeaponGraphicsItem(WeaponGraphicsItem *copy);
-
-//Variables:
-private:
-    int durability, origDurability;
+    WeaponGraphicsItem(const WeaponState &state, GraphicsItemSender *graphicsItemSender);
 
 public:
     static const int WIDTH = 162;
@@ -22,7 +35,8 @@ public:
 public:
     QRectF boundingRect() const Q_DECL_OVERRIDE;
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) Q_DECL_OVERRIDE;
-    bool processTagChange(QString tag, QString value);
+    bool processTagChange(PowerTag tag, int value);
+    WeaponState getState();
 };
 
 #endif // WEAPONGRAPHICSITEM_H
@@ -1,5 +1,6 @@
 #include "cardwindow.h"
 #include "../utility.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 CardWindow::CardWindow(QWidget *parent) :
@@ -65,8 +66,7 @@ void CardWindow::loadCard(QString code, QRect rectCard, int maxTop, int maxBotto
     }
 
     move(moveX, moveY);
-    cardLabel->setPixmap(QPixmap(Utility::hscardsPath() + "/" + code + ".png").copy(5,34,WCARD,HCARD)
-                         .scaled(winWidth, winHeight, Qt::IgnoreAspectRatio, Qt::SmoothTransformation));
+    cardLabel->setPixmap(PixmapCache::card(code, QRect(5,34,WCARD,HCARD), QSize(winWidth, winHeight)));
     show();
 }
 
@@ -1,5 +1,6 @@
 #include "draftscorewindow.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 
@@ -275,7 +276,7 @@ QPixmap DraftScoreWindow::createMechanicIconPixmap(const QString &mechanicIcon,
 
         if(count == 1)
         {
-            painter.drawPixmap(0, 0, QPixmap(ThemeHandler::goldenMechanicFile()));
+            painter.drawPixmap(0, 0, PixmapCache::get(ThemeHandler::goldenMechanicFile()));
         }
         else
         {
@@ -1,5 +1,6 @@
 #include "lavabutton.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 LavaButton::LavaButton(QWidget *parent, float min, float max) : QLabel(parent)
@@ -66,14 +67,14 @@ void LavaButton::paintEvent(QPaintEvent *event)
     painter.setRenderHint(QPainter::TextAntialiasing);
 
     QRect targetAll(0, 0, width(), height());
-    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::speedCloseFile()));
+    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::speedCloseFile()));
 
     QRegion r(QRect(static_cast<int>(width()*0.15), static_cast<int>(height()*0.15),
                     static_cast<int>(width()*0.7), static_cast<int>(height()*0.7)), QRegion::Ellipse);
     painter.setClipRegion(r);
     painter.setClipping(true);
         QRect targetLava(0, static_cast<int>((1-value_0_1)*(height()*80/128)), width(), height());
-        painter.drawPixmap(targetLava, QPixmap(ThemeHandler::speedLavaFile()));
+        painter.drawPixmap(targetLava, PixmapCache::get(ThemeHandler::speedLavaFile()));
     painter.setClipping(false);
 
     QFont font(LG_FONT);
@@ -97,8 +98,8 @@ void LavaButton::paintEvent(QPaintEvent *event)
 #endif
     painter.drawPath(path);
 
-    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::speedOpenFile()));
-    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::speedDWTextFile()));
+    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::speedOpenFile()));
+    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::speedDWTextFile()));
 
     QPainter painterObject(this);
     if(isEnabled())
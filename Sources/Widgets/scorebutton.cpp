@@ -1,5 +1,6 @@
 #include "scorebutton.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 ScoreButton::ScoreButton(QWidget *parent, ScoreSource scoreSource, bool normalizedLF) : QLabel(parent)
@@ -141,17 +142,17 @@ void ScoreButton::paintEvent(QPaintEvent *event)
     bool hideScore = learningMode && !learningShow;
     if(hideScore)
     {
-        if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::haCloseFile()));
-        else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::lfCloseFile()));
+        if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::haCloseFile()));
+        else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::lfCloseFile()));
     }
     else
     {
         //Best Score background
         if(isBestScore)
         {
-            if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::haBestFile()));
-            else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::lfBestFile()));
-            else if(scoreSource == Score_Heroes)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::hsrBestFile()));
+            if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::haBestFile()));
+            else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::lfBestFile()));
+            else if(scoreSource == Score_Heroes)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::hsrBestFile()));
         }
 
         //Draw Score
@@ -186,16 +187,16 @@ void ScoreButton::paintEvent(QPaintEvent *event)
             painter.drawPath(path);
         }
 
-        if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::haOpenFile()));
-        else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::lfOpenFile()));
-        else if(scoreSource == Score_Heroes)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::hsrOpenFile()));
+        if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::haOpenFile()));
+        else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::lfOpenFile()));
+        else if(scoreSource == Score_Heroes)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::hsrOpenFile()));
 
         //Best Score text
         if(isBestScore)
         {
-            if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::haTextFile()));
-            else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::lfTextFile()));
-            else if(scoreSource == Score_Heroes)        painter.drawPixmap(targetAll, QPixmap(ThemeHandler::hsrTextFile()));
+            if(scoreSource == Score_HearthArena)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::haTextFile()));
+            else if(scoreSource == Score_LightForge)    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::lfTextFile()));
+            else if(scoreSource == Score_Heroes)        painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::hsrTextFile()));
         }
     }
 
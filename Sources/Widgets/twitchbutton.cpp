@@ -1,5 +1,6 @@
 #include "twitchbutton.h"
 #include "../themehandler.h"
+#include "../Utils/pixmapcache.h"
 #include <QtWidgets>
 
 TwitchButton::TwitchButton(QWidget *parent, float min, float max) : QLabel(parent)
@@ -50,14 +51,14 @@ void TwitchButton::paintEvent(QPaintEvent *event)
     painter.setRenderHint(QPainter::TextAntialiasing);
 
     QRect targetAll(0, 0, width(), height());
-    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::speedCloseFile()));
+    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::speedCloseFile()));
 
     QRegion r(QRect(static_cast<int>(width()*0.15), static_cast<int>(height()*0.15),
                     static_cast<int>(width()*0.7), static_cast<int>(height()*0.7)), QRegion::Ellipse);
     painter.setClipRegion(r);
     painter.setClipping(true);
         QRect targetLava(0, static_cast<int>((1-value_0_1)*(height()*80/128)), width(), height());
-        painter.drawPixmap(targetLava, QPixmap(ThemeHandler::speedLavaFile()));
+        painter.drawPixmap(targetLava, PixmapCache::get(ThemeHandler::speedLavaFile()));
     painter.setClipping(false);
 
     QFont font(LG_FONT);
@@ -84,8 +85,8 @@ void TwitchButton::paintEvent(QPaintEvent *event)
 #endif
     painter.drawPath(path);
 
-    painter.drawPixmap(targetAll, QPixmap(ThemeHandler::speedOpenFile()));
-    if(isBestScore) painter.drawPixmap(targetAll, QPixmap(ThemeHandler::speedTwitchTextFile()));
+    painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::speedOpenFile()));
+    if(isBestScore) painter.drawPixmap(targetAll, PixmapCache::get(ThemeHandler::speedTwitchTextFile()));
 
     QPainter painterObject(this);
     if(isEnabled())
@@ -549,7 +549,7 @@ void DeckHandler::newDeckCard(QString code, int total, bool add, bool outsider,
 //    if(!outsider && (deckCardList[0].total < (uint)total))
 //    {
 //        emit pDebug("Deck is full: Not adding: (" + QString::number(total) + ") " +
-//                    Utility::getCardAttribute(code, "name").toString(), Warning);
+//                    Utility::cardLocalNameFromCode(code), Warning);
 //        return;
 //    }
 
@@ -563,7 +563,7 @@ void DeckHandler::newDeckCard(QString code, int total, bool add, bool outsider,
             {
                 if(!add)
                 {
-                    emit pDebug(Utility::getCardAttribute(code, "name").toString() + " already in deck.");
+                    emit pDebug(Utility::cardLocalNameFromCode(code) + " already in deck.");
                     return;
                 }
 
@@ -620,7 +620,7 @@ void DeckHandler::newDeckCard(QString code, int total, bool add, bool outsider,
     if(!this->inArena && !outsider)   enableDeckButtonSave();
 
     emit pDebug("Add to deck" + (outsider?QString(" (OUTSIDER)"):QString("")) + ": (" + QString::number(total) + ")" +
-                Utility::getCardAttribute(code, "name").toString());
+                Utility::cardLocalNameFromCode(code));
 }
 
 
@@ -818,7 +818,7 @@ void DeckHandler::drawFromDeck(QString code, int id)
         }
 
         emit pDebug("New card: " +
-                          Utility::getCardAttribute(code, "name").toString());
+                          Utility::cardLocalNameFromCode(code));
         newDeckCard(code);
         drawFromDeck(code, id);
     }
@@ -1,5 +1,6 @@
 #include "drafthandler.h"
 #include "themehandler.h"
+#include "Utils/screenlocator.h"
 #include <QtConcurrent/QtConcurrent>
 #include <QtWidgets>
 
@@ -8,6 +9,8 @@ DraftHandler::DraftHandler(QObject *parent, Ui::Extended *ui) : QObject(parent)
     this->ui = ui;
     this->deckRatingHA = this->deckRatingLF = 0;
     this->numCaptured = 0;
+    this->numBuildHists = 0;
+    this->buildHistsGeneration = this->futureBuildHistsGeneration = 0;
     this->extendedCapture = false;
     this->drafting = false;
     this->heroDrafting = false;
@@ -35,6 +38,8 @@ DraftHandler::DraftHandler(QObject *parent, Ui::Extended *ui) : QObject(parent)
     completeUI();
 
     connect(&futureFindScreenRects, SIGNAL(finished()), this, SLOT(finishFindScreenRects()));
+    connect(&futureBuildHists, SIGNAL(progressValueChanged(int)), this, SLOT(advanceBuildHists(int)));
+    connect(&futureBuildHists, SIGNAL(finished()), this, SLOT(finishBuildHists()));
 }
 
 DraftHandler::~DraftHandler()
@@ -246,13 +251,13 @@ void DraftHandler::initHearthArenaTiers(const QString &heroString, const bool mu
 void DraftHandler::addCardHist(QString code, bool premium, bool isHero)
 {
     //Evitamos golden cards de cartas no colleccionables
-    if(premium && !Utility::getCardAttribute(code, "collectible").toBool()) return;
+    if(premium && !Utility::isCollectible(code)) return;
 
     QString fileNameCode = premium?(code + "_premium"): code;
     QFileInfo cardFile(Utility::hscardsPath() + "/" + fileNameCode + ".png");
     if(cardFile.exists())
     {
-        cardsHist[fileNameCode] = getHist(fileNameCode);
+        pendingHistCodes.append(fileNameCode);
     }
     else
     {
@@ -326,6 +331,8 @@ void DraftHandler::initCodesAndHistMaps(QString hero)
 {
     cardsDownloading.clear();
     cardsHist.clear();
+    pendingHistCodes.clear();
+    cancelBuildHists();
 
     if(drafting)
     {
@@ -343,6 +350,113 @@ void DraftHandler::initCodesAndHistMaps(QString hero)
         for(const QString &code: heroCodesList)     addCardHist(code, false, true);
     }
 
+    startBuildHists();
+}
+
+
+//Los histogramas de la cache se cargan aqui, el resto se calculan repartidos en el thread pool.
+//La cache y cardsHist solo se tocan en el thread principal (finishBuildHists).
+void DraftHandler::startBuildHists()
+{
+    buildHistsGeneration++;
+    buildHistsTimer.start();
+    if(!histCache.isLoaded())   histCache.load(Utility::hscardsPath() + "/" + HIST_CACHE_FILE);
+
+    QList<HistJob> histJobs;
+    for(const QString &code: pendingHistCodes)
+    {
+        HistJob histJob;
+        histJob.code = code;
+        histJob.imagePath = Utility::hscardsPath() + "/" + code + ".png";
+        histJob.mtime = QFileInfo(histJob.imagePath).lastModified().toMSecsSinceEpoch();
+        histJob.crop = getHistCrop(code);
+
+        cv::MatND hist;
+        if(histCache.get(code, histJob.mtime, histJob.crop, hist))  cardsHist.setHist(code, hist, getHistGroup(code));
+        else                                                        histJobs.append(histJob);
+    }
+    pendingHistCodes.clear();
+    numBuildHists = histJobs.count();
+
+    emit pDebug("Card histograms: " + QString::number(cardsHist.count()) + " cached, " +
+                QString::number(numBuildHists) + " to build.");
+
+    if(histJobs.isEmpty())
+    {
+        histsBuilt();
+    }
+    else
+    {
+        emit startProgressBar(numBuildHists, "Building card histograms...");
+        futureBuildHistsGeneration = buildHistsGeneration;
+        futureBuildHists.setFuture(QtConcurrent::mapped(histJobs, &DraftHandler::buildHist));
+    }
+}
+
+
+//Cada cancelacion o nuevo build cambia la generacion: un finished() de un build anterior
+//(cancelado o ya sustituido) no llega a finishBuildHists aunque este encolado.
+void DraftHandler::cancelBuildHists()
+{
+    buildHistsGeneration++;
+    if(!futureBuildHists.isRunning())   return;
+
+    futureBuildHists.cancel();
+    futureBuildHists.waitForFinished();
+    numBuildHists = 0;
+}
+
+
+HistJob DraftHandler::buildHist(const HistJob &histJob)
+{
+    HistJob result = histJob;
+    cv::Mat fullCard = cv::imread(histJob.imagePath.toStdString(), CV_LOAD_IMAGE_COLOR);
+    if(fullCard.empty() || (histJob.crop & cv::Rect(0, 0, fullCard.cols, fullCard.rows)) != histJob.crop)  return result;
+    cv::Mat srcBase = fullCard(histJob.crop);
+    result.hist = getHist(srcBase);
+    return result;
+}
+
+
+void DraftHandler::advanceBuildHists(int progress)
+{
+    emit advanceProgressBar(numBuildHists - progress, "");
+}
+
+
+void DraftHandler::finishBuildHists()
+{
+    if(futureBuildHistsGeneration != buildHistsGeneration || futureBuildHists.isCanceled())     return;
+
+    if(numBuildHists > 0)
+    {
+        const QList<HistJob> histJobs = futureBuildHists.future().results();
+        for(const HistJob &histJob: histJobs)
+        {
+            if(histJob.hist.empty())
+            {
+                emit pDebug("Failed to build histogram of " + histJob.code, Warning);
+                continue;
+            }
+            cardsHist.setHist(histJob.code, histJob.hist, getHistGroup(histJob.code));
+            histCache.set(histJob.code, histJob.mtime, histJob.crop, histJob.hist);
+        }
+        numBuildHists = 0;
+        saveHistCache();
+        emit showMessageProgressBar("Card histograms built");
+    }
+
+    histsBuilt();
+}
+
+
+void DraftHandler::histsBuilt()
+{
+    if(!drafting && !heroDrafting)  return;
+
+    emit pDebug("Card histograms: " + QString::number(cardsHist.count()) + " ready in " +
+                QString::number(buildHistsTimer.elapsed()) + " ms.");
+
     //Wait for cards
     if(cardsDownloading.isEmpty())
     {
@@ -356,15 +470,26 @@ void DraftHandler::initCodesAndHistMaps(QString hero)
 }
 
 
+bool DraftHandler::histsReady()
+{
+    return cardsDownloading.isEmpty() && !futureBuildHists.isRunning();
+}
+
+
 void DraftHandler::reHistDownloadedCardImage(const QString &fileNameCode, bool missingOnWeb)
 {
     if(!cardsDownloading.contains(fileNameCode)) return; //No forma parte del drafting
 
-    if(!fileNameCode.isEmpty() && !missingOnWeb)  cardsHist[fileNameCode] = getHist(fileNameCode);
+    if(!fileNameCode.isEmpty() && !missingOnWeb)  cardsHist.setHist(fileNameCode, getHist(fileNameCode), getHistGroup(fileNameCode));
     cardsDownloading.removeOne(fileNameCode);
+
+    //Las descargas que acaban mientras se construyen los histogramas las recoge finishBuildHists
+    if(futureBuildHists.isRunning())    return;
+
     emit advanceProgressBar(cardsDownloading.count(), fileNameCode.split("_premium").first() + " downloaded");
     if(cardsDownloading.isEmpty())
     {
+        saveHistCache();
         emit showMessageProgressBar("All cards downloaded");
         emit downloadEnded();
         newCaptureDraftLoop();
@@ -632,6 +757,8 @@ void DraftHandler::endDraft()
     emit pDebug("End draft.");
     emit pLog(tr("Draft: Draft ended."));
 
+    cancelBuildHists();
+
 
     //SizeDraft
     QMainWindow *mainWindow = static_cast<QMainWindow*>(parent());
@@ -715,7 +842,7 @@ void DraftHandler::deleteDraftMechanicsWindow()
 
 void DraftHandler::newCaptureDraftLoop(bool delayed)
 {
-    if(!capturing && screenFound() && cardsDownloading.isEmpty() &&
+    if(!capturing && screenFound() && histsReady() &&
         ((drafting && !lightForgeTiers.empty() && !hearthArenaTiers.empty()) || heroDrafting))
     {
         capturing = true;
@@ -733,7 +860,7 @@ void DraftHandler::captureDraft()
 
     bool missingTierLists = drafting && (lightForgeTiers.empty() || hearthArenaTiers.empty());
     if((!drafting && !heroDrafting) || missingTierLists ||
-        leavingArena || !screenFound() || !cardsDownloading.isEmpty())
+        leavingArena || !screenFound() || !histsReady())
     {
         leavingArena = false;
         capturing = false;
@@ -848,7 +975,7 @@ CardRarity DraftHandler::getBestRarity()
     {
         QString code = bestMatchesMaps[i].first();
         //No restringimos rarezas si hay cartas unicas de arena (no colleccionables) (que no tienen rareza)
-        if(!Utility::getCardAttribute(code, "collectible").toBool())    return INVALID_RARITY;
+        if(!Utility::isCollectible(code))    return INVALID_RARITY;
         rarity[i] = draftCardMaps[i][code].getRarity();
     }
 
@@ -1222,16 +1349,35 @@ bool DraftHandler::getScreenCardsHist(cv::MatND screenCardsHist[3])
     QScreen *screen = screens[screenIndex];
     if (!screen) return false;
 
+    //Solo se captura el rectangulo que contiene las 3 cartas, no la pantalla entera.
+    //screenRects esta en pixeles de la imagen capturada, grabWindow usa coordenadas logicas.
+    cv::Rect cardsRect = screenRects[0] | screenRects[1] | screenRects[2];
+    const qreal dpr = screen->devicePixelRatio();
+    const int grabX = static_cast<int>(cardsRect.x/dpr);
+    const int grabY = static_cast<int>(cardsRect.y/dpr);
+    const int grabWidth = static_cast<int>(ceil((cardsRect.x + cardsRect.width)/dpr)) - grabX;
+    const int grabHeight = static_cast<int>(ceil((cardsRect.y + cardsRect.height)/dpr)) - grabY;
+
     QRect rect = screen->geometry();
-    QImage image = screen->grabWindow(0,rect.x(),rect.y(),rect.width(),rect.height()).toImage();
-    cv::Mat mat(image.height(),image.width(),CV_8UC4,image.bits(), static_cast<ulong>(image.bytesPerLine()));
+    QImage image = screen->grabWindow(0,rect.x()+grabX,rect.y()+grabY,grabWidth,grabHeight).toImage();
+    if(image.format() != QImage::Format_RGB32 && image.format() != QImage::Format_ARGB32 &&
+        image.format() != QImage::Format_ARGB32_Premultiplied)
+    {
+        image = image.convertToFormat(QImage::Format_RGB32);
+    }
 
-    cv::Mat screenCapture = mat.clone();
+    //Sin copia, la imagen vive hasta el final de la funcion
+    cv::Mat screenCapture(image.height(),image.width(),CV_8UC4,image.bits(), static_cast<ulong>(image.bytesPerLine()));
+    cv::Point grabOrigin(static_cast<int>(round(grabX*dpr)), static_cast<int>(round(grabY*dpr)));
+    cv::Rect captureBounds(0, 0, screenCapture.cols, screenCapture.rows);
 
     cv::Mat bigCards[3];
-    bigCards[0] = screenCapture(screenRects[0]);
-    bigCards[1] = screenCapture(screenRects[1]);
-    bigCards[2] = screenCapture(screenRects[2]);
+    for(int i=0; i<3; i++)
+    {
+        cv::Rect cardRect = screenRects[i] - grabOrigin;
+        if((cardRect & captureBounds) != cardRect)  return false;
+        bigCards[i] = screenCapture(cardRect);
+    }
 
 
 //#ifdef QT_DEBUG
@@ -1264,28 +1410,46 @@ void DraftHandler::mapBestMatchingCodes(cv::MatND screenCardsHist[3])
     bool newCardsFound = false;
     const int numCandidates = (extendedCapture?CAPTURE_EXTENDED_CANDIDATES:CAPTURE_MIN_CANDIDATES);
 
-    for(int i=0; i<3; i++)
+    //Distancias de los 3 slots contra los candidatos legales en una sola pasada.
+    //Si un slot ya ha fijado la rareza (legendaria o no) los otros solo se comparan con esa rareza.
+    cv::Mat matches;
+    int lockedRarityGroup = getLockedRarityGroup();
+    if(lockedRarityGroup == -1)
     {
-        QMap<double, QString> bestMatchesMap;
-        for(QMap<QString, cv::MatND>::const_iterator it=cardsHist.constBegin(); it!=cardsHist.constEnd(); it++)
+        cardsHist.match(screenCardsHist, 3, matches, getCandidateGroups());
+    }
+    else
+    {
+        matches.create(3, cardsHist.count(), CV_64F);
+        for(int i=0; i<3; i++)
         {
-            double match = compareHist(screenCardsHist[i], it.value(), 3);
-            QString code = it.key();
-            bestMatchesMap.insertMulti(match, code);
+            cv::Mat slotMatches;
+            cardsHist.match(&screenCardsHist[i], 1, slotMatches,
+                            cardDetected[i]?getCandidateGroups():getCandidateGroups(lockedRarityGroup));
+            slotMatches.copyTo(matches.row(i));
+        }
+    }
 
-            //Actualizamos DraftCardMaps con los nuevos resultados
-            if((numCaptured != 0) && draftCardMaps[i].contains(code))
+    for(int i=0; i<3; i++)
+    {
+        //Actualizamos DraftCardMaps con los nuevos resultados
+        if(numCaptured != 0)
+        {
+            for(QMap<QString, DraftCard>::iterator it=draftCardMaps[i].begin(); it!=draftCardMaps[i].end(); it++)
             {
-                draftCardMaps[i][code].setBestQualityMatch(match, false);
+                int index = cardsHist.index(it.key());
+                if(index != -1)     it->setBestQualityMatch(matches.at<double>(i, index), false);
             }
         }
 
         //Incluimos en DraftCardMaps los mejores 7 matches, si no han sido ya actualizados por estar en el map.
-        QList<double> bestMatchesList = bestMatchesMap.keys();
-        for(int j=0; j<numCandidates && j<bestMatchesList.count(); j++)
+        QVector<int> bestIndexes;
+        HistMatcher::bestIndexes(matches, i, numCandidates, bestIndexes);
+        for(int index: bestIndexes)
         {
-            double match = bestMatchesList.at(j);
-            QString code = bestMatchesMap[match];
+            double match = matches.at<double>(i, index);
+            if(match >= 1)  break;  //Fuera de los candidatos legales
+            QString code = cardsHist.code(index);
 
             if(!draftCardMaps[i].contains(code))
             {
@@ -1325,23 +1489,116 @@ void DraftHandler::mapBestMatchingCodes(cv::MatND screenCardsHist[3])
 }
 
 
-cv::MatND DraftHandler::getHist(const QString &code)
+int DraftHandler::getRarityGroup(const QString &code)
+{
+    //Cartas unicas de arena (no colleccionables) no tienen rareza
+    if(!Utility::isCollectible(code))                   return NoRarityGroup;
+    else if(Utility::getRarityFromCode(code) == LEGENDARY)  return LegendaryGroup;
+    else                                                return NonLegendaryGroup;
+}
+
+
+int DraftHandler::getHistGroup(const QString &code)
+{
+    QString cardCode = degoldCode(code);
+    return static_cast<int>(Utility::getClassFromCode(cardCode))*NUM_RARITY_GROUPS + getRarityGroup(cardCode);
+}
+
+
+//Rareza de la mejor carta del primer slot detectado, como en getBestRarity. -1 si no hay ninguno.
+int DraftHandler::getLockedRarityGroup()
+{
+    if(!drafting)   return -1;
+
+    for(int i=0; i<3; i++)
+    {
+        if(!cardDetected[i] || draftCardMaps[i].isEmpty())  continue;
+
+        QString bestCode;
+        double bestMatch = 1;
+        for(QMap<QString, DraftCard>::iterator it=draftCardMaps[i].begin(); it!=draftCardMaps[i].end(); it++)
+        {
+            if(it->getBestQualityMatches() < bestMatch)
+            {
+                bestMatch = it->getBestQualityMatches();
+                bestCode = it.key();
+            }
+        }
+        if(bestCode.isEmpty())  continue;
+
+        int rarityGroup = getRarityGroup(degoldCode(bestCode));
+        return (rarityGroup == NoRarityGroup)?-1:rarityGroup;
+    }
+    return -1;
+}
+
+
+//Grupos de cardsHist legales: neutrales y clase del heroe, con la rareza fijada si lockedRarityGroup != -1.
+//Las cartas sin rareza se incluyen siempre. Lista vacia = todos los histogramas.
+QList<int> DraftHandler::getCandidateGroups(int lockedRarityGroup)
+{
+    QList<int> groups;
+    if(!drafting)   return groups;
+
+    CardClass heroClass = Utility::heroFromLogNumber(arenaHero);
+    bool allClasses = MULTICLASS_ARENA || heroClass == INVALID_CLASS;
+    if(allClasses && lockedRarityGroup == -1)   return groups;
+
+    for(int cardClass=DRUID; cardClass<=NEUTRAL; cardClass++)
+    {
+        bool legalClass = allClasses || cardClass == NEUTRAL || cardClass == heroClass;
+        for(int rarityGroup=0; rarityGroup<NUM_RARITY_GROUPS; rarityGroup++)
+        {
+            if(rarityGroup == NoRarityGroup ||
+                (legalClass && (lockedRarityGroup == -1 || rarityGroup == lockedRarityGroup)))
+            {
+                groups.append(cardClass*NUM_RARITY_GROUPS + rarityGroup);
+            }
+        }
+    }
+    return groups;
+}
+
+
+cv::Rect DraftHandler::getHistCrop(const QString &code)
 {
-    cv::Mat fullCard = cv::imread((Utility::hscardsPath() + "/" + code + ".png").toStdString(), CV_LOAD_IMAGE_COLOR);
-    cv::Mat srcBase;
     if(drafting)
     {
-        if(code.endsWith("_premium"))   srcBase = fullCard(cv::Rect(57,71,80,80));
-        else                            srcBase = fullCard(cv::Rect(60,71,80,80));
+        if(code.endsWith("_premium"))   return cv::Rect(57,71,80,80);
+        else                            return cv::Rect(60,71,80,80);
     }
     else //if(heroDrafting)
     {
-        srcBase = fullCard(cv::Rect(75,201,160,160));
+        return cv::Rect(75,201,160,160);
+    }
+}
+
+
+//Solo se decodifica el png si la cache no tiene el histograma de esa imagen (mtime) y ese recorte
+cv::MatND DraftHandler::getHist(const QString &code)
+{
+    QString imagePath = Utility::hscardsPath() + "/" + code + ".png";
+    qint64 mtime = QFileInfo(imagePath).lastModified().toMSecsSinceEpoch();
+    cv::Rect crop = getHistCrop(code);
+
+    if(!histCache.isLoaded())   histCache.load(Utility::hscardsPath() + "/" + HIST_CACHE_FILE);
+    cv::MatND hist;
+    if(histCache.get(code, mtime, crop, hist))  return hist;
+
+    cv::Mat fullCard = cv::imread(imagePath.toStdString(), CV_LOAD_IMAGE_COLOR);
+    cv::Mat srcBase = fullCard(crop);
 //#ifdef QT_DEBUG
-//        cv::imshow(code.toStdString(), srcBase);
+//    if(!drafting)   cv::imshow(code.toStdString(), srcBase);
 //#endif
-    }
-    return getHist(srcBase);
+    hist = getHist(srcBase);
+    histCache.set(code, mtime, crop, hist);
+    return hist;
+}
+
+
+void DraftHandler::saveHistCache()
+{
+    if(!histCache.save())   emit pDebug("Failed to save histogram cache.", Warning);
 }
 
 
@@ -1416,10 +1673,8 @@ void DraftHandler::finishFindScreenRects()
 }
 
 
-ScreenDetection DraftHandler::findScreenRects()
+std::vector<Point2f> DraftHandler::getTemplatePoints()
 {
-    ScreenDetection screenDetection;
-
     std::vector<Point2f> templatePoints(6);
     if(drafting)
     {
@@ -1433,7 +1688,14 @@ ScreenDetection DraftHandler::findScreenRects()
         templatePoints[2] = cvPoint(453,332); templatePoints[3] = cvPoint(453+152,332+152);
         templatePoints[4] = cvPoint(724,332); templatePoints[5] = cvPoint(724+152,332+152);
     }
+    return templatePoints;
+}
+
 
+ScreenDetection DraftHandler::findScreenRects()
+{
+    ScreenDetection screenDetection;
+    std::vector<Point2f> templatePoints = getTemplatePoints();
 
     QList<QScreen *> screens = QGuiApplication::screens();
     for(int screenIndex=0; screenIndex<screens.count(); screenIndex++)
@@ -1460,6 +1722,144 @@ ScreenDetection DraftHandler::findScreenRects()
 }
 
 
+//Reconocimiento offline de capturas guardadas, sin cliente de Hearthstone.
+//dirPath/<pick>/*.png son los frames de cada pick en orden y dirPath/<pick>/pick.txt los 3 codigos correctos
+//(con _premium si son doradas). Se usan los mismos pasos que captureDraft.
+void DraftHandler::benchmarkRecognition(const QString &dirPath, const QString &hero)
+{
+    if(drafting || heroDrafting)
+    {
+        emit pDebug("Benchmark: Cannot run draft recognition while drafting.", Warning);
+        return;
+    }
+
+    //Histogramas del pool de arena de ese heroe, de forma sincrona
+    clearLists(false);
+    this->drafting = true;
+    this->arenaHero = hero;
+    this->lightForgeTiers = initLightForgeTiers(Utility::heroString2FromLogNumber(hero), MULTICLASS_ARENA);
+    for(const QString &code: pendingHistCodes)  cardsHist.setHist(code, getHist(code), getHistGroup(code));
+    pendingHistCodes.clear();
+    if(!cardsDownloading.isEmpty())
+    {
+        emit pDebug("Benchmark: " + QString::number(cardsDownloading.count()) + " card images missing.", Warning);
+        cardsDownloading.clear();
+    }
+    saveHistCache();
+
+    int numPicks = 0, numUnlocked = 0, numFrames = 0, totalFramesToLock = 0;
+    int hitsNormal = 0, totalNormal = 0, hitsGolden = 0, totalGolden = 0;
+    qint64 totalFrameUs = 0, maxFrameUs = 0, totalLocateMs = 0;
+    QElapsedTimer timer;
+
+    const QStringList pickDirs = QDir(dirPath).entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+    for(const QString &pickDir: pickDirs)
+    {
+        QDir dir(dirPath + "/" + pickDir);
+        QFile pickFile(dir.filePath("pick.txt"));
+        if(!pickFile.open(QIODevice::ReadOnly | QIODevice::Text))   continue;
+        QStringList truthCodes = QString(pickFile.readAll()).split(QRegularExpression("\\s+"), QString::SkipEmptyParts);
+        pickFile.close();
+        const QStringList frames = dir.entryList(QStringList() << "*.png", QDir::Files, QDir::Name);
+        if(truthCodes.count() != 3 || frames.isEmpty())
+        {
+            emit pDebug("Benchmark: Skip " + pickDir + " (needs pick.txt with 3 codes and png frames).", Warning);
+            continue;
+        }
+
+        for(int i=0; i<3; i++)
+        {
+            cardDetected[i] = false;
+            draftCardMaps[i].clear();
+            bestMatchesMaps[i].clear();
+        }
+        numCaptured = 0;
+        numPicks++;
+
+        int framesToLock = 0;
+        for(int frame=0; frame<frames.count() && framesToLock==0; frame++)
+        {
+            cv::Mat screenCapture = cv::imread(dir.filePath(frames[frame]).toStdString(), CV_LOAD_IMAGE_COLOR);
+            if(screenCapture.empty())   continue;
+
+            //Localizacion en el primer frame del pick
+            if(frame == 0)
+            {
+                cv::Mat sceneGray;
+                cv::cvtColor(screenCapture, sceneGray, CV_BGR2GRAY);
+                timer.start();
+                std::vector<Point2f> screenPoints = ScreenLocator::findTemplateOnImage("arenaTemplate.png", sceneGray, getTemplatePoints());
+                totalLocateMs += timer.elapsed();
+                if(screenPoints.empty())    break;
+                for(int i=0; i<3; i++)
+                {
+                    screenRects[i] = cv::Rect(screenPoints[static_cast<ulong>(i*2)], screenPoints[static_cast<ulong>(i*2+1)]) &
+                            cv::Rect(0, 0, screenCapture.cols, screenCapture.rows);
+                }
+                if(screenRects[0].area() == 0 || screenRects[1].area() == 0 || screenRects[2].area() == 0)  break;
+            }
+
+            timer.start();
+            cv::MatND screenCardsHist[3];
+            for(int i=0; i<3; i++)
+            {
+                cv::Mat bigCard = screenCapture(screenRects[i]);
+                screenCardsHist[i] = getHist(bigCard);
+            }
+            mapBestMatchingCodes(screenCardsHist);
+            bool detected = areCardsDetected();
+            qint64 frameUs = timer.nsecsElapsed()/1000;
+            totalFrameUs += frameUs;
+            maxFrameUs = std::max(maxFrameUs, frameUs);
+            numFrames++;
+
+            if(detected)    framesToLock = frame + 1;
+        }
+
+        //Un pick sin bloquear cuenta como fallo de las 3 cartas
+        DraftCard bestCards[3];
+        if(framesToLock == 0)
+        {
+            numUnlocked++;
+            emit pDebug("Benchmark: " + pickDir + " not locked after " + QString::number(frames.count()) + " frames.", Warning);
+        }
+        else
+        {
+            totalFramesToLock += framesToLock;
+            buildBestMatchesMaps();
+            getBestCards(bestCards);
+        }
+
+        for(int i=0; i<3; i++)
+        {
+            bool golden = isGoldCode(truthCodes[i]);
+            bool hit = !bestCards[i].getCode().isEmpty() && bestCards[i].getCode() == degoldCode(truthCodes[i]);
+            if(golden)  {totalGolden++; if(hit) hitsGolden++;}
+            else        {totalNormal++; if(hit) hitsNormal++;}
+            if(!hit && framesToLock != 0)
+            {
+                emit pDebug("Benchmark: " + pickDir + "[" + QString::number(i) + "] " + bestCards[i].getCode() +
+                            " instead of " + truthCodes[i] + " (min match " +
+                            QString::number(getMinMatch(draftCardMaps[i]), 'f', 3) + ")", Warning);
+            }
+        }
+    }
+
+    clearLists(false);
+    this->drafting = false;
+    this->arenaHero = "";
+
+    int numLocked = numPicks - numUnlocked;
+    emit pDebug("Benchmark: Draft recognition " + QString::number(numPicks) + " picks, " + QString::number(numFrames) + " frames --> " +
+                "Locate: " + QString::number(numPicks>0?totalLocateMs/numPicks:0) + " ms/pick - " +
+                "Frame: " + QString::number(numFrames>0?totalFrameUs/numFrames:0) + " us avg, " + QString::number(maxFrameUs) + " us max - " +
+                "Frames to lock: " + QString::number(numLocked>0?totalFramesToLock/static_cast<double>(numLocked):0, 'f', 1) +
+                " (" + QString::number(numUnlocked) + " unlocked) - " +
+                "Top-1 normal: " + QString::number(hitsNormal) + "/" + QString::number(totalNormal) +
+                " golden: " + QString::number(hitsGolden) + "/" + QString::number(totalGolden));
+}
+
+
 void DraftHandler::beginHeroDraft()
 {
     emit pDebug("Begin hero draft.");
@@ -1479,6 +1879,7 @@ void DraftHandler::endHeroDraft()
 
     emit pDebug("End hero draft.");
 
+    cancelBuildHists();
     clearLists(false);
 
     this->heroDrafting = false;
@@ -10,8 +10,11 @@
 #include "Widgets/draftmechanicswindow.h"
 #include "synergyhandler.h"
 #include "twitchhandler.h"
+#include "Utils/histmatcher.h"
+#include "Utils/histcache.h"
 #include <QObject>
 #include <QFutureWatcher>
+#include <QElapsedTimer>
 
 
 #define CAPTUREDRAFT_START_TIME         1500
@@ -40,6 +43,19 @@ public:
     QPointF screenScale = QPointF(0,0);
 };
 
+//Grupos de rareza de cardsHist, el grupo de cada histograma es clase*NUM_RARITY_GROUPS + grupo de rareza
+enum HistRarityGroup {NoRarityGroup, LegendaryGroup, NonLegendaryGroup, NUM_RARITY_GROUPS};
+
+class HistJob
+{
+public:
+    QString code;
+    QString imagePath;
+    qint64 mtime;
+    cv::Rect crop;
+    cv::MatND hist;
+};
+
 class DraftHandler : public QObject
 {
     Q_OBJECT
@@ -56,8 +72,14 @@ private:
     ScoreButton *scoreButtonLF, *scoreButtonHA;
     QMap<QString, int> hearthArenaTiers;
     QMap<QString, LFtier> lightForgeTiers;
-    QMap<QString, cv::MatND> cardsHist;
+    HistMatcher cardsHist;
+    HistCache histCache;
     QStringList cardsDownloading;
+    QStringList pendingHistCodes;
+    QFutureWatcher<HistJob> futureBuildHists;
+    int numBuildHists;
+    int buildHistsGeneration, futureBuildHistsGeneration;
+    QElapsedTimer buildHistsTimer;
     DraftCard draftCards[3];
     //Guarda los mejores candidatos de esta iteracion
     QMap<QString, DraftCard> draftCardMaps[3];  //[Code(_premium)] --> DraftCard
@@ -96,7 +118,18 @@ private:
 private:
     void completeUI();
     cv::MatND getHist(const QString &code);
-    cv::MatND getHist(cv::Mat &srcBase);
+    cv::Rect getHistCrop(const QString &code);
+    int getRarityGroup(const QString &code);
+    int getHistGroup(const QString &code);
+    int getLockedRarityGroup();
+    QList<int> getCandidateGroups(int lockedRarityGroup=-1);
+    void saveHistCache();
+    static cv::MatND getHist(cv::Mat &srcBase);
+    static HistJob buildHist(const HistJob &histJob);
+    void startBuildHists();
+    void cancelBuildHists();
+    void histsBuilt();
+    bool histsReady();
     void initCodesAndHistMaps(QString hero="");
     void resetTab(bool alreadyDrafting);
     void clearLists(bool keepCounters);
@@ -105,6 +138,7 @@ private:
     void updateDeckScore(float cardRatingHA=0, float cardRatingLF=0);
     bool screenFound();
     ScreenDetection findScreenRects();
+    std::vector<Point2f> getTemplatePoints();
     void clearScore(QLabel *label, DraftMethod draftMethod, bool clearText=true);
     void highlightScore(QLabel *label, DraftMethod draftMethod);
     void deleteDraftHeroWindow();
@@ -199,10 +233,13 @@ public slots:
     void setPremium(bool premium);
     void setNormalizedLF(bool value);
     void updateMinimumHeight();
+    void benchmarkRecognition(const QString &dirPath, const QString &hero);
 
 private slots:
     void captureDraft();
     void finishFindScreenRects();
+    void advanceBuildHists(int progress);
+    void finishBuildHists();
     void startFindScreenRects();
     void comboBoxChanged();
     void refreshCapturedCards();
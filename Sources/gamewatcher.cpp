@@ -1,4 +1,5 @@
 #include "gamewatcher.h"
+#include "Utils/logpatterns.h"
 #include <QtWidgets>
 
 
@@ -26,8 +27,8 @@ void GameWatcher::reset()
     logSeekCreate = -1;
     logSeekWon = -1;
     tied = true;
-    emit pDebug("Reset (powerState = noGame).", 0);
-    emit pDebug("Reset (LoadingScreen = menu).", 0);
+    GW_DEBUG("Reset (powerState = noGame).", 0, Normal);
+    GW_DEBUG("Reset (LoadingScreen = menu).", 0, Normal);
 }
 
 
@@ -51,7 +52,7 @@ void GameWatcher::processLogLine(LogComponent logComponent, QString line, qint64
             processAsset(line, numLine);
         break;
         case logInvalid:
-            emit pDebug("Unknown log component read.", Warning);
+            GW_DEBUG("Unknown log component read.", 0, Warning);
         break;
     }
 }
@@ -62,7 +63,7 @@ void GameWatcher::startReadingDeck()
     if(arenaState == deckRead) return;
     emit needResetDeck();    //resetDeck
     arenaState = readingDeck;
-    emit pDebug("Start reading deck (arenaState = readingDeck).", 0);
+    GW_DEBUG("Start reading deck (arenaState = readingDeck).", 0, Normal);
 }
 
 
@@ -71,7 +72,7 @@ void GameWatcher::endReadingDeck()
     if(arenaState != readingDeck)    return;
     arenaState = deckRead;
     emit arenaDeckRead();
-    emit pDebug("End reading deck (arenaState = deckRead).", 0);
+    GW_DEBUG("End reading deck (arenaState = deckRead).", 0, Normal);
     emit pLog(tr("Log: Active deck read."));
 }
 
@@ -81,12 +82,12 @@ void GameWatcher::setDeckRead(bool value)
     if(value)
     {
         arenaState = deckRead;
-        emit pDebug("SetDeckRead (arenaState = deckRead).", 0);
+        GW_DEBUG("SetDeckRead (arenaState = deckRead).", 0, Normal);
     }
     else
     {
         arenaState = noDeckRead;
-        emit pDebug("SetDeckRead (arenaState = noDeckRead).", 0);
+        GW_DEBUG("SetDeckRead (arenaState = noDeckRead).", 0, Normal);
     }
 }
 
@@ -94,18 +95,18 @@ void GameWatcher::setDeckRead(bool value)
 void GameWatcher::processLoadingScreen(QString &line, qint64 numLine)
 {
     //[LoadingScreen] LoadingScreen.OnSceneLoaded() - prevMode=HUB currMode=DRAFT
-    if(line.contains(QRegularExpression("LoadingScreen\\.OnSceneLoaded\\(\\) *- *prevMode=(\\w+) *currMode=(\\w+)"), match))
+    if(line.contains(QLatin1String("OnSceneLoaded")) && line.contains(LogPatterns::get(LP_LOADING_SCREEN), match))
     {
         QString prevMode = match->captured(1);
         QString currMode = match->captured(2);
-        emit pDebug("\nLoadingScreen: " + prevMode + " -> " + currMode, numLine);
+        GW_DEBUG("\nLoadingScreen: " + prevMode + " -> " + currMode, numLine, Normal);
 
         //Create result, avoid first run
         if(prevMode == "GAMEPLAY" && logSeekCreate != -1 && logSeekWon != -1)
         {
             if(spectating || loadingScreenState == menu || tied)
             {
-                emit pDebug("CreateGameResult: Avoid spectator/tied game result.", 0);
+                GW_DEBUG("CreateGameResult: Avoid spectator/tied game result.", 0, Normal);
             }
             else
             {
@@ -118,7 +119,7 @@ void GameWatcher::processLoadingScreen(QString &line, qint64 numLine)
         if(currMode == "DRAFT")
         {
             loadingScreenState = arena;
-            emit pDebug("Entering ARENA (loadingScreenState = arena).", numLine);
+            GW_DEBUG("Entering ARENA (loadingScreenState = arena).", numLine, Normal);
 
             if(prevMode == "HUB" || prevMode == "FRIENDLY")
             {
@@ -128,7 +129,7 @@ void GameWatcher::processLoadingScreen(QString &line, qint64 numLine)
         else if(currMode == "HUB")
         {
             loadingScreenState = menu;
-            emit pDebug("Entering MENU (loadingScreenState = menu).", numLine);
+            GW_DEBUG("Entering MENU (loadingScreenState = menu).", numLine, Normal);
 
             if(prevMode == "DRAFT")
             {
@@ -139,22 +140,22 @@ void GameWatcher::processLoadingScreen(QString &line, qint64 numLine)
         else if(currMode == "TOURNAMENT")
         {
             loadingScreenState = casual;
-            emit pDebug("Entering CASUAL/RANKED (loadingScreenState = casual).", numLine);
+            GW_DEBUG("Entering CASUAL/RANKED (loadingScreenState = casual).", numLine, Normal);
         }
         else if(currMode == "ADVENTURE")
         {
             loadingScreenState = adventure;
-            emit pDebug("Entering ADVENTURE (loadingScreenState = adventure).", numLine);
+            GW_DEBUG("Entering ADVENTURE (loadingScreenState = adventure).", numLine, Normal);
         }
         else if(currMode == "TAVERN_BRAWL")
         {
             loadingScreenState = tavernBrawl;
-            emit pDebug("Entering TAVERN (loadingScreenState = tavernBrawl).", numLine);
+            GW_DEBUG("Entering TAVERN (loadingScreenState = tavernBrawl).", numLine, Normal);
         }
         else if(currMode == "FRIENDLY")
         {
             loadingScreenState = friendly;
-            emit pDebug("Entering FRIENDLY (loadingScreenState = friendly).", numLine);
+            GW_DEBUG("Entering FRIENDLY (loadingScreenState = friendly).", numLine, Normal);
 
             if(prevMode == "DRAFT")
             {
@@ -175,7 +176,7 @@ void GameWatcher::processAsset(QString &line, qint64 numLine)
     if(loadingScreenState == casual && logSeekWon != -1 && line.contains("assetPath=rank_window"))
     {
         loadingScreenState = ranked;
-        emit pDebug("On RANKED (loadingScreenState = ranked).", numLine);
+        GW_DEBUG("On RANKED (loadingScreenState = ranked).", numLine, Normal);
     }
 }
 
@@ -188,58 +189,59 @@ void GameWatcher::processAsset(QString &line, qint64 numLine)
 //D 11:27:47.0197460 SetDraftMode - DRAFTING
 void GameWatcher::processArena(QString &line, qint64 numLine)
 {
+    //Prefiltro literal, la mayoria de lineas no necesitan probar ningun patron
+    if(!line.contains(QLatin1String("DraftManager")) && !line.contains(QLatin1String("Client chooses")) &&
+            !line.contains(QLatin1String("SetDraftMode")))     return;
+
     //NEW ARENA - START DRAFT
     //[Arena] DraftManager.OnChosen(): hero=HERO_02 premium=STANDARD
-    if(line.contains(QRegularExpression("DraftManager\\.OnChosen\\(\\): hero=HERO_(\\d+)"), match))
+    if(line.contains(LogPatterns::get(LP_ARENA_NEW), match))
     {
         QString hero = match->captured(1);
-        emit pDebug("New arena. Heroe: " + hero, numLine);
+        GW_DEBUG("New arena. Heroe: " + hero, numLine, Normal);
         emit pLog(tr("Log: New arena."));
-        emit newArena(hero); //(sync)Begin draft //(sync)resetDeckDontRead (arenaState = deckRead)
+        emit newArena(hero); //Begin draft //resetDeck
+        setDeckRead();
     }
     //DRAFTING PICK CARD
     //[Arena] Client chooses: Profesora violeta (NEW1_026)
-    else if(line.contains(QRegularExpression("Client chooses: .* \\((\\w+)\\)"), match))
+    else if(line.contains(LogPatterns::get(LP_ARENA_PICK), match))
     {
         QString code = match->captured(1);
         if(!code.contains("HERO"))
         {
-            emit pDebug("Pick card: " + code, numLine);
+            GW_DEBUG("Pick card: " + code, numLine, Normal);
             emit pickCard(code);
         }
     }
     //START READING DECK
     //[Arena] DraftManager.OnChoicesAndContents - Draft Deck ID: 472720132, Hero Card = HERO_02
-    else if(line.contains(QRegularExpression(
-                "DraftManager\\.OnChoicesAndContents - Draft Deck ID: \\d+, Hero Card = HERO_\\d+"), match))
+    else if(line.contains(LogPatterns::get(LP_ARENA_READ_DECK_START), match))
     {
-        emit pDebug("Found DraftManager.OnChoicesAndContents", numLine);
+        GW_DEBUG("Found DraftManager.OnChoicesAndContents", numLine, Normal);
         startReadingDeck();
     }
     //END READING DECK
     //[Arena] SetDraftMode - ACTIVE_DRAFT_DECK
     else if(line.contains("SetDraftMode - ACTIVE_DRAFT_DECK"))
     {
-        emit pDebug("Found ACTIVE_DRAFT_DECK.", numLine);
+        GW_DEBUG("Found ACTIVE_DRAFT_DECK.", numLine, Normal);
         emit activeDraftDeck(); //End draft
         endReadingDeck();
     }
     //READ DECK CARD
     //[Arena] DraftManager.OnChoicesAndContents - Draft deck contains card FP1_012
-    else if((arenaState == readingDeck) && line.contains(QRegularExpression(
-            "DraftManager\\.OnChoicesAndContents - Draft deck contains card (\\w+)"), match))
+    else if((arenaState == readingDeck) && line.contains(LogPatterns::get(LP_ARENA_READ_DECK_CARD), match))
     {
         QString code = match->captured(1);
-        emit pDebug("Reading deck: " + code, numLine);
+        GW_DEBUG("Reading deck: " + code, numLine, Normal);
         emit newDeckCard(code);
     }
     //COMPRAR ARENA -- VUELTA A SELECCION HEROE
-    else if(line.contains(QRegularExpression(
-                "DraftManager\\.OnBegin - Got new draft deck with ID: \\d+"), match) ||
-            line.contains(QRegularExpression(
-                            "DraftManager\\.OnChoicesAndContents - Draft Deck ID: \\d+, Hero Card ="), match))
+    else if(line.contains(LogPatterns::get(LP_ARENA_BEGIN), match) ||
+            line.contains(LogPatterns::get(LP_ARENA_CHOICES), match))
     {
-        emit pDebug("New arena: choosing heroe.", numLine);
+        GW_DEBUG("New arena: choosing heroe.", numLine, Normal);
         emit arenaChoosingHeroe();
     }
     //IN REWARDS
@@ -272,12 +274,12 @@ void GameWatcher::processPower(QString &line, qint64 numLine, qint64 logSeek)
     //================== End Spectator Game ==================
     if(line.contains("End Spectator Game"))
     {
-        emit pDebug("End Spectator Game.", numLine);
+        GW_DEBUG("End Spectator Game.", numLine, Normal);
 //        spectating = false;//Se pondra a false despues de haberse creado el resultado en LoadingScreen: GAMEPLAY -> HUB
 
         if(powerState != noGame)
         {
-            emit pDebug("WON not found (PowerState = noGame)", 0);
+            GW_DEBUG("WON not found (PowerState = noGame)", 0, Normal);
             powerState = noGame;
             emit endGame();
         }
@@ -287,7 +289,7 @@ void GameWatcher::processPower(QString &line, qint64 numLine, qint64 logSeek)
     //================== Start Spectator Game ==================
     else if(line.contains("Begin Spectating") || line.contains("Start Spectator Game"))
     {
-        emit pDebug("Start Spectator Game.", numLine);
+        GW_DEBUG("Start Spectator Game.", numLine, Normal);
         spectating = true;
     }
     //Create game
@@ -296,12 +298,12 @@ void GameWatcher::processPower(QString &line, qint64 numLine, qint64 logSeek)
     {
         if(powerState != noGame)
         {
-            emit pDebug("WON not found (PowerState = noGame)", 0);
+            GW_DEBUG("WON not found (PowerState = noGame)", 0, Normal);
             powerState = noGame;
             emit endGame();
         }
 
-        emit pDebug("\nFound CREATE_GAME (powerState = heroType1State)", numLine);
+        GW_DEBUG("\nFound CREATE_GAME (powerState = heroType1State)", numLine, Normal);
         logSeekCreate = logSeek;
         powerState = heroType1State;
 
@@ -329,41 +331,46 @@ void GameWatcher::processPower(QString &line, qint64 numLine, qint64 logSeek)
         emit startGame();
     }
 
-    if(powerState != noGame)
+    //Las lineas de PowerTaskList se trocean una sola vez y se comparten con processPowerInGame
+    PowerLine powerLine;
+    if(powerState != noGame)    PowerTokenizer::tokenize(line, powerLine);
+
+    if(powerLine.action == PA_TAG_CHANGE)
     {
         //Win state
         //PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=El tabernero tag=PLAYSTATE value=WON
-        if(line.contains(QRegularExpression(
-                            "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE "
-                            "Entity=(.+) tag=PLAYSTATE value=(WON|TIED)"), match))
+        if(powerLine.powerTag == PT_PLAYSTATE &&
+                (powerLine.value == QLatin1String("WON") || powerLine.value == QLatin1String("TIED")))
         {
-            winnerPlayer = match->captured(1);
-            tied = (match->captured(2) == "TIED");
+            winnerPlayer = powerLine.entityText.toString();
+            tied = (powerLine.value == QLatin1String("TIED"));
             powerState = noGame;
             logSeekWon = logSeek;
-            if(tied)    emit pDebug("Found TIED (powerState = noGame)", numLine);
-            else        emit pDebug("Found WON (powerState = noGame): " + winnerPlayer + (playerTag.isEmpty()?" - Unknown winner":""), numLine);
+            if(tied)    GW_DEBUG("Found TIED (powerState = noGame)", numLine, Normal);
+            else        GW_DEBUG("Found WON (powerState = noGame): " + winnerPlayer + (playerTag.isEmpty()?" - Unknown winner":""), numLine, Normal);
 
             bool playerWon = !tied && (winnerPlayer == playerTag);
             emit endGame(playerWon, playerTag.isEmpty());
         }
         //Turn
         //PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=GameEntity tag=TURN value=12
-        else if(line.contains(QRegularExpression(
-                            "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE "
-                            "Entity=GameEntity tag=TURN value=(\\d+)"
-                ), match))
+        else if(powerLine.powerTag == PT_TURN && powerLine.entityText == QLatin1String("GameEntity"))
         {
-            turn = match->captured(1).toInt();
-            emit logTurn();
-            emit pDebug("Found TURN: " + match->captured(1), numLine);
-
-            if(powerState != inGameState && turn > 1)
+            bool ok;
+            int turnValue = powerLine.value.toInt(&ok);
+            if(ok)
             {
-                powerState = inGameState;
-                mulliganEnemyDone = mulliganPlayerDone = true;
-                emit clearDrawList(true);
-                emit pDebug("WARNING: Heroes/Players info missing (powerState = inGameState, mulliganDone = true)", 0, Warning);
+                turn = turnValue;
+                emit logTurn();
+                GW_DEBUG("Found TURN: " + powerLine.value.toString(), numLine, Normal);
+
+                if(powerState != inGameState && turn > 1)
+                {
+                    powerState = inGameState;
+                    mulliganEnemyDone = mulliganPlayerDone = true;
+                    emit clearDrawList(true);
+                    GW_DEBUG("WARNING: Heroes/Players info missing (powerState = inGameState, mulliganDone = true)", 0, Warning);
+                }
             }
         }
     }
@@ -373,23 +380,23 @@ void GameWatcher::processPower(QString &line, qint64 numLine, qint64 logSeek)
             break;
         case heroType1State:
         case heroType2State:
-            if(powerState == heroType1State && line.contains(QRegularExpression("Creating ID=\\d+ CardID=HERO_(\\d+)"), match))
+            if(powerState == heroType1State && line.contains(QLatin1String("Creating ID=")) && line.contains(LogPatterns::get(LP_POWER_CREATE_HERO), match))
             {
                 hero1 = match->captured(1);
                 powerState = heroType2State;
-                emit pDebug("Found hero 1: " + hero1 + " (powerState = heroType2State)", numLine);
+                GW_DEBUG("Found hero 1: " + hero1 + " (powerState = heroType2State)", numLine, Normal);
             }
-            else if(powerState == heroType2State && line.contains(QRegularExpression("Creating ID=\\d+ CardID=HERO_(\\d+)"), match))
+            else if(powerState == heroType2State && line.contains(QLatin1String("Creating ID=")) && line.contains(LogPatterns::get(LP_POWER_CREATE_HERO), match))
             {
                 hero2 = match->captured(1);
                 powerState = mulliganState;
-                emit pDebug("Found hero 2: " + hero2 + " (powerState = mulliganState)", numLine);
+                GW_DEBUG("Found hero 2: " + hero2 + " (powerState = mulliganState)", numLine, Normal);
             }
         case mulliganState:
             processPowerMulligan(line, numLine);
             break;
         case inGameState:
-            processPowerInGame(line, numLine);
+            processPowerInGame(powerLine, numLine);
             break;
     }
 }
@@ -400,9 +407,8 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
     //Jugador/Enemigo names, playerTag y firstPlayer
     //GameState.DebugPrintEntityChoices() - id=1 Player=fayatime TaskList=3 ChoiceType=MULLIGAN CountMin=0 CountMax=5
     //GameState.DebugPrintEntityChoices() - id=2 Player=Винсент TaskList=4 ChoiceType=MULLIGAN CountMin=0 CountMax=3
-    if(line.contains(QRegularExpression(
-                "GameState\\.DebugPrintEntityChoices\\(\\) - id=(\\d+) Player=(.*) TaskList=\\d+ ChoiceType=MULLIGAN CountMin=0 CountMax=(\\d+)"
-                  ), match))
+    bool isEntityChoices = line.contains(QLatin1String("DebugPrintEntityChoices"));
+    if(isEntityChoices && line.contains(LogPatterns::get(LP_MULLIGAN_PLAYER), match))
     {
         QString player = match->captured(1);
         QString playerName = match->captured(2);
@@ -411,12 +417,12 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
         if(player.toInt() == 1)
         {
             name1 = playerName;
-            emit pDebug("Found player 1: " + name1, numLine);
+            GW_DEBUG("Found player 1: " + name1, numLine, Normal);
         }
         else if(player.toInt() == 2)
         {
             name2 = playerName;
-            emit pDebug("Found player 2: " + name2, numLine);
+            GW_DEBUG("Found player 2: " + name2, numLine, Normal);
         }
         else    emit pDebug("Read invalid PlayerID value: " + player, numLine, DebugLevel::Error);
 
@@ -424,13 +430,13 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
         if(playerTag.isEmpty() && playerID == player.toInt())
         {
             playerTag = (playerID == 1)?name1:name2;
-            emit pDebug("Found playerTag: " + playerTag, numLine);
+            GW_DEBUG("Found playerTag: " + playerTag, numLine, Normal);
         }
 
         if(numCards == "3")
         {
             firstPlayer = playerName;
-            emit pDebug("Found First Player: " + firstPlayer, numLine);
+            GW_DEBUG("Found First Player: " + firstPlayer, numLine, Normal);
         }
     }
 
@@ -438,15 +444,14 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
     //MULLIGAN DONE
     //GameState.DebugPrintPower() -     TAG_CHANGE Entity=fayatime tag=MULLIGAN_STATE value=DONE
     //GameState.DebugPrintPower() -     TAG_CHANGE Entity=Винсент tag=MULLIGAN_STATE value=DONE
-    else if(line.contains(QRegularExpression("Entity=(.+) tag=MULLIGAN_STATE value=DONE"
-            ), match))
+    else if(line.contains(QLatin1String("MULLIGAN_STATE")) && line.contains(LogPatterns::get(LP_MULLIGAN_DONE), match))
     {
         //Player mulligan
         if(match->captured(1) == playerTag)
         {
             if(!mulliganPlayerDone)
             {
-                emit pDebug("Player mulligan end.", numLine);
+                GW_DEBUG("Player mulligan end.", numLine, Normal);
                 mulliganPlayerDone = true;
                 turn = 1;
                 emit clearDrawList(true);
@@ -455,7 +460,7 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
                 {
                     //turn = 1;
                     powerState = inGameState;
-                    emit pDebug("Mulligan phase end (powerState = inGameState)", numLine);
+                    GW_DEBUG("Mulligan phase end (powerState = inGameState)", numLine, Normal);
                 }
             }
         }
@@ -467,10 +472,10 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
                 if(firstPlayer == playerTag)
                 {
                     //Convertir ultima carta en moneda enemiga
-                    emit pDebug("Enemy: Coin created.", 0);
+                    GW_DEBUG("Enemy: Coin created.", 0, Normal);
                     emit lastHandCardIsCoin();
                 }
-                emit pDebug("Enemy mulligan end.", numLine);
+                GW_DEBUG("Enemy mulligan end.", numLine, Normal);
                 mulliganEnemyDone = true;
                 turn = 1;
 
@@ -478,7 +483,7 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
                 {
                     //turn = 1;
                     powerState = inGameState;
-                    emit pDebug("Mulligan phase end (powerState = inGameState)", numLine);
+                    GW_DEBUG("Mulligan phase end (powerState = inGameState)", numLine, Normal);
                 }
             }
         }
@@ -487,401 +492,321 @@ void GameWatcher::processPowerMulligan(QString &line, qint64 numLine)
 
     //GameState.DebugPrintEntityChoices() -   Entities[4]=[entityName=La moneda id=68 zone=HAND zonePos=5 cardId=GAME_005 player=2]
     //GameState.DebugPrintEntityChoices() -   Entities[4]=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=68 zone=HAND zonePos=5 cardId= player=1]
-    else if(line.contains(QRegularExpression(
-                "GameState\\.DebugPrintEntityChoices\\(\\) - *"
-                "Entities\\[4\\]=\\[entityName=.* id=(\\d+) zone=HAND zonePos=5 cardId=.* player=\\d+\\]"
-                  ), match))
+    else if(isEntityChoices && line.contains(LogPatterns::get(LP_MULLIGAN_COIN), match))
     {
         QString id = match->captured(1);
-        emit pDebug("Coin ID: " + id, numLine);
+        GW_DEBUG("Coin ID: " + id, numLine, Normal);
         emit coinIdFound(id.toInt());
     }
 }
 
 
-void GameWatcher::processPowerInGame(QString &line, qint64 numLine)
+void GameWatcher::processPowerInGame(const PowerLine &powerLine, qint64 numLine)
 {
-    //SHOW_ENTITY tag
-    //tag=HEALTH value=1
-    if(line.contains(QRegularExpression(
-        "PowerTaskList\\.DebugPrintPower\\(\\) - *"
-        "tag=(\\w+) value=(\\w+)"
-        ), match))
-    {
-        QString tag = match->captured(1);
-        QString value = match->captured(2);
+    //Reiniciamos lastShowEntity
+    if(powerLine.action != PA_SHOW_TAG)     lastShowEntity.id = -1;
 
-        if(tag == "ATK" || tag == "HEALTH")
-        {
-            emit pDebug((lastShowEntity.isPlayer?QString("Player"):QString("Enemy")) + ": SHOW_TAG(" + tag + ")= " + value, numLine);
-            if(lastShowEntity.id == -1)         emit pDebug("Show entity id missing.", numLine, DebugLevel::Error);
-            else if(lastShowEntity.isPlayer)    emit playerBoardTagChange(lastShowEntity.id, "", tag, value);
-            else                                emit enemyBoardTagChange(lastShowEntity.id, "", tag, value);
-        }
-        //En un futuro quizas haya que distinguir entre cambios en zone HAND o PLAY, por ahora son siempre cambios en PLAY
+    switch(powerLine.action)
+    {
+        //SHOW_ENTITY tag
+        //tag=HEALTH value=1
+        case PA_SHOW_TAG:
+            if(powerLine.powerTag == PT_ATK || powerLine.powerTag == PT_HEALTH)
+            {
+                PowerTag tag = powerLine.powerTag;
+                int value = powerLine.value.toInt();
+                GW_DEBUG((lastShowEntity.isPlayer?QString("Player"):QString("Enemy")) + ": SHOW_TAG(" + powerLine.tag.toString() +
+                         ")= " + powerLine.value.toString(), numLine, Normal);
+                if(lastShowEntity.id == -1)         emit pDebug("Show entity id missing.", numLine, DebugLevel::Error);
+                else if(lastShowEntity.isPlayer)    emit playerBoardTagChange(lastShowEntity.id, "", tag, value);
+                else                                emit enemyBoardTagChange(lastShowEntity.id, "", tag, value);
+            }
+            //En un futuro quizas haya que distinguir entre cambios en zone HAND o PLAY, por ahora son siempre cambios en PLAY
 
-        //Tag avanzados para CHANGE_ENTITY - Updating Entity=
-        //No son necesarios ya que al hacer el update entity emit minionCodeChange que cambiara
-        //el codigo del minion leyendo del json todos sus atributos correctos.
+            //Tag avanzados para CHANGE_ENTITY - Updating Entity=
+            //No son necesarios ya que al hacer el update entity emit minionCodeChange que cambiara
+            //el codigo del minion leyendo del json todos sus atributos correctos.
 //                    || (lastShowEntity.trackAllTags && (tag == "DAMAGE" || /*tag == "EXHAUSTED" ||*/
 //                     tag == "DIVINE_SHIELD" || tag == "STEALTH" || tag == "TAUNT" || tag == "CHARGE" ||
 //                     tag == "FROZEN" || tag == "WINDFURY" || tag == "AURA"))
-    }
-    else
-    {
-        //Reiniciamos lastShowEntity
-        lastShowEntity.id = -1;
-
-        //TAG_CHANGE jugadores conocido
-        //D 10:48:46.1127070 PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=SerKolobok tag=RESOURCES value=3
-        if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE "
-            "Entity=(.*) tag=(\\w+) value=(\\w+)"
-            ), match))
+            break;
+
+        case PA_TAG_CHANGE:
+            processPowerTagChange(powerLine, numLine);
+            break;
+
+        case PA_BLOCK_START:
+            processPowerBlockStart(powerLine, numLine);
+            break;
+
+        //SHOW_ENTITY conocido/desconocido
+        //SHOW_ENTITY - Updating Entity=[entityName=Maestra de secta id=50 zone=DECK zonePos=0 cardId= player=2] CardID=EX1_595
+        //SHOW_ENTITY - Updating Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=58 zone=HAND zonePos=3 cardId= player=2] CardID=EX1_011
+        //FULL_ENTITY conocido
+        //FULL_ENTITY - Updating [entityName=Recluta Mano de Plata id=95 zone=PLAY zonePos=3 cardId=CS2_101t player=2] CardID=CS2_101t
+        case PA_SHOW_ENTITY:
+        case PA_FULL_ENTITY:
         {
-            QString name = match->captured(1);
-            QString tag = match->captured(2);
-            QString value = match->captured(3);
-            bool isPlayer = (name == playerTag);
+            const PowerEntity &entity = powerLine.entity;
+            bool isPlayer = (entity.player == playerID);
 
-            if(tag == "RESOURCES" || tag == "RESOURCES_USED" || tag == "CURRENT_SPELLPOWER")
-            {
-                emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": TAG_CHANGE(" + tag + ")= " + value +
-                            " -- Name: " + name, numLine);
-                if(!playerTag.isEmpty())
-                {
-                    if(isPlayer)    emit playerTagChange(tag, value);
-                    else            emit enemyTagChange(tag, value);
-                }
-                else
-                {
-                    emit unknownTagChange(tag, value);
-                }
-            }
+            GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) +
+                     (powerLine.action == PA_SHOW_ENTITY?QString(": SHOW_ENTITY -- Id: "):QString(": FULL_ENTITY -- Id: ")) +
+                     QString::number(entity.id), numLine, Normal);
+            lastShowEntity.id = entity.id;
+            lastShowEntity.isPlayer = isPlayer;
+            lastShowEntity.trackAllTags = false;
         }
+            break;
 
-
-        //TAG_CHANGE desconocido
-        //TAG_CHANGE Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=49 zone=HAND zonePos=3 cardId= player=2] tag=CLASS value=MAGE
-        //TAG_CHANGE Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=37 zone=HAND zonePos=2 cardId= player=2] tag=CLASS value=MAGE
-        if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE "
-            "Entity=\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=(\\d+)\\] "
-            "tag=(\\w+) value=(\\w+)"
-            ), match))
+        //CHANGE_ENTITY conocido
+        //CHANGE_ENTITY - Updating Entity=[entityName=Aullavísceras id=53 zone=HAND zonePos=3 cardId=EX1_411 player=2] CardID=OG_031
+        case PA_CHANGE_ENTITY:
         {
-            QString id = match->captured(1);
-            QString player = match->captured(2);
-            QString tag = match->captured(3);
-            QString value = match->captured(4);
-            bool isPlayer = (player.toInt() == playerID);
+            const PowerEntity &entity = powerLine.entity;
+            QString newCardId = powerLine.newCardId.toString();
+            bool isPlayer = (entity.player == playerID);
 
+            GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": CHANGE_ENTITY -- Id: " + QString::number(entity.id) +
+                     " to Code: " + newCardId + " in Zone: " + entity.zone.toString(), numLine, Normal);
+            lastShowEntity.id = entity.id;
+            lastShowEntity.isPlayer = isPlayer;
+            lastShowEntity.trackAllTags = true;
 
-            if(tag == "CLASS")
-            {
-                emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Secret hero = " + value +
-                            " -- Id: " + id, numLine);
-                if(value == "MAGE")         secretHero = MAGE;
-                else if(value == "HUNTER")  secretHero = HUNTER;
-                else if(value == "PALADIN") secretHero = PALADIN;
-                else if(value == "ROGUE")   secretHero = ROGUE;
-            }
-            //Justo antes de jugarse ARMS_DEALING se pone a 0, si no lo evitamos el minion no se actualizara desde la carta
-            else if(tag == "ARMS_DEALING" && value.toInt() != 0)
-            {
-                emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": TAG_CHANGE(" + tag + ")= " + value +
-                            " -- Id: " + id, numLine);
-                emit buffHandCard(id.toInt());
-            }
-            else if(tag == "DAMAGE" || tag == "ATK" || tag == "HEALTH" || tag == "EXHAUSTED" ||
-                    tag == "DIVINE_SHIELD" || tag == "STEALTH" || tag == "TAUNT" || tag == "CHARGE" ||
-                    tag == "ARMOR" || tag == "FROZEN" || tag == "WINDFURY" || tag == "SILENCED" ||
-                    tag == "CONTROLLER" || tag == "TO_BE_DESTROYED" || tag == "AURA" ||
-                    tag == "CANT_BE_DAMAGED" || tag == "SHOULDEXITCOMBAT" || tag == "ZONE" ||
-                    tag == "LINKED_ENTITY" || tag == "DURABILITY" ||
-                    tag == "COST")
+            if(entity.zone == QLatin1String("HAND"))
             {
-                emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": MINION/CARD TAG_CHANGE(" + tag + ")= " + value +
-                            " -- Id: " + id, numLine);
-                if(isPlayer)    emit playerBoardTagChange(id.toInt(), "", tag, value);
-                else            emit enemyBoardTagChange(id.toInt(), "", tag, value);
+                if(isPlayer)    emit playerCardCodeChange(entity.id, newCardId);
             }
-        }
-
-        //TAG_CHANGE conocido
-        //PowerTaskList aparece segundo pero hay acciones que no tienen GameState, como el damage del maestro del acero herido
-        //GameState.DebugPrintPower() -         TAG_CHANGE Entity=[entityName=Déspota del templo id=36 zone=PLAY zonePos=1 cardId=EX1_623 player=2] tag=DAMAGE value=0
-        //GameState.DebugPrintPower() -     TAG_CHANGE Entity=[entityName=Déspota del templo id=36 zone=PLAY zonePos=1 cardId=EX1_623 player=2] tag=ATK value=3
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE "
-            "Entity=\\[entityName=(.*) id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=(\\w*) player=(\\d+)\\] "
-            "tag=(\\w+) value=(\\w+)"
-            ), match))
-        {
-            QString name = match->captured(1);
-            QString id = match->captured(2);
-            QString zone = match->captured(3);
-            QString cardId = match->captured(4);
-            QString player = match->captured(5);
-            QString tag = match->captured(6);
-            QString value = match->captured(7);
-            bool isPlayer = (player.toInt() == playerID);
-            Q_UNUSED(zone);
-
-
-            if(tag == "DAMAGE" || tag == "ATK" || tag == "HEALTH" || tag == "EXHAUSTED" ||
-                    tag == "DIVINE_SHIELD" || tag == "STEALTH" || tag == "TAUNT" || tag == "CHARGE" ||
-                    tag == "ARMOR" || tag == "FROZEN" || tag == "WINDFURY" || tag == "SILENCED" ||
-                    tag == "CONTROLLER" || tag == "TO_BE_DESTROYED" || tag == "AURA" ||
-                    tag == "CANT_BE_DAMAGED" || tag == "SHOULDEXITCOMBAT" || tag == "ZONE" ||
-                    tag == "LINKED_ENTITY" || tag == "DURABILITY" ||
-                    tag == "COST")
+            else if(entity.zone == QLatin1String("PLAY"))
             {
-                emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": MINION/CARD TAG_CHANGE(" + tag + ")=" + value +
-                            " -- " + name + " -- Id: " + id, numLine);
-                if(isPlayer)    emit playerBoardTagChange(id.toInt(), cardId, tag, value);
-                else            emit enemyBoardTagChange(id.toInt(), cardId, tag, value);
+                emit minionCodeChange(isPlayer, entity.id, newCardId);
             }
         }
+            break;
 
+        case PA_NONE:
+            break;
+    }
+}
 
-        //Enemigo accion desconocida
-        //BLOCK_START BlockType=PLAY Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=49 zone=HAND zonePos=3 cardId= player=2]
-        //EffectCardId= EffectIndex=0 Target=0
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - BLOCK_START BlockType=(\\w+) "
-            "Entity=\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=\\d+\\] "
-            "EffectCardId=\\w* EffectIndex=-?\\d+ "
-            "Target="
-            ), match))
-        {
-            QString blockType = match->captured(1);
-            QString id = match->captured(2);
 
-            //ULTIMO TRIGGER SPECIAL CARDS, con o sin objetivo
-            emit pDebug("Trigger(" + blockType + ") desconocido. Id: " + id, numLine);
-            emit specialCardTrigger("", blockType, id.toInt(), -1);
-        }
+void GameWatcher::processPowerTagChange(const PowerLine &powerLine, qint64 numLine)
+{
+    const PowerEntity &entity = powerLine.entity;
+    PowerTag tag = powerLine.powerTag;
+    if(tag == PT_UNKNOWN)   return;
 
+    //TAG_CHANGE jugadores conocido
+    //D 10:48:46.1127070 PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=SerKolobok tag=RESOURCES value=3
+    if(tag == PT_RESOURCES || tag == PT_RESOURCES_USED || tag == PT_CURRENT_SPELLPOWER)
+    {
+        QString name = powerLine.entityText.toString();
+        int value = powerLine.value.toInt();
+        bool isPlayer = (name == playerTag);
 
-        //SHOW_ENTITY conocido
-        //SHOW_ENTITY - Updating Entity=[entityName=Maestra de secta id=50 zone=DECK zonePos=0 cardId= player=2] CardID=EX1_595
-        //SHOW_ENTITY - Updating Entity=[entityName=Turbocerdo con pinchos id=18 zone=DECK zonePos=0 cardId=CFM_688 player=1] CardID=CFM_688
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *SHOW_ENTITY - Updating "
-            "Entity=\\[entityName=.* id=(\\d+) zone=\\w+ zonePos=\\d+ cardId=\\w* player=(\\d+)\\] "
-            "CardID=\\w+"
-            ), match))
+        GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": TAG_CHANGE(" + powerLine.tag.toString() + ")= " +
+                 powerLine.value.toString() + " -- Name: " + name, numLine, Normal);
+        if(!playerTag.isEmpty())
         {
-            QString id = match->captured(1);
-            QString player = match->captured(2);
-            bool isPlayer = (player.toInt() == playerID);
-
-            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": SHOW_ENTITY -- Id: " + id, numLine);
-            lastShowEntity.id = id.toInt();
-            lastShowEntity.isPlayer = isPlayer;
-            lastShowEntity.trackAllTags = false;
+            if(isPlayer)    emit playerTagChange(tag, value);
+            else            emit enemyTagChange(tag, value);
         }
-
-
-        //SHOW_ENTITY desconocido
-        //SHOW_ENTITY - Updating Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=58 zone=HAND zonePos=3 cardId= player=2] CardID=EX1_011
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *SHOW_ENTITY - Updating "
-            "Entity=\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=(\\d+)\\] "
-            "CardID=\\w+"
-            ), match))
+        else
         {
-            QString id = match->captured(1);
-            QString player = match->captured(2);
-            bool isPlayer = (player.toInt() == playerID);
-
-            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": SHOW_ENTITY -- Id: " + id, numLine);
-            lastShowEntity.id = id.toInt();
-            lastShowEntity.isPlayer = isPlayer;
-            lastShowEntity.trackAllTags = false;
+            emit unknownTagChange(tag, value);
         }
+    }
 
+    if(!entity.valid)   return;
 
-        //FULL_ENTITY conocido
-        //FULL_ENTITY - Updating [entityName=Recluta Mano de Plata id=95 zone=PLAY zonePos=3 cardId=CS2_101t player=2] CardID=CS2_101t
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *FULL_ENTITY - Updating "
-            "\\[entityName=.* id=(\\d+) zone=\\w+ zonePos=\\d+ cardId=\\w* player=(\\d+)\\] "
-            "CardID=\\w+"
-            ), match))
-        {
-            QString id = match->captured(1);
-            QString player = match->captured(2);
-            bool isPlayer = (player.toInt() == playerID);
 
-            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": FULL_ENTITY -- Id: " + id, numLine);
-            lastShowEntity.id = id.toInt();
-            lastShowEntity.isPlayer = isPlayer;
-            lastShowEntity.trackAllTags = false;
+    //TAG_CHANGE desconocido
+    //TAG_CHANGE Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=49 zone=HAND zonePos=3 cardId= player=2] tag=CLASS value=MAGE
+    //TAG_CHANGE Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=37 zone=HAND zonePos=2 cardId= player=2] tag=CLASS value=MAGE
+    if(entity.unknown)
+    {
+        bool isPlayer = (entity.player == playerID);
+        const QStringRef &value = powerLine.value;
+
+        if(tag == PT_CLASS)
+        {
+            GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Secret hero = " + value.toString() +
+                     " -- Id: " + QString::number(entity.id), numLine, Normal);
+            if(value == QLatin1String("MAGE"))          secretHero = MAGE;
+            else if(value == QLatin1String("HUNTER"))   secretHero = HUNTER;
+            else if(value == QLatin1String("PALADIN"))  secretHero = PALADIN;
+            else if(value == QLatin1String("ROGUE"))    secretHero = ROGUE;
+        }
+        //Justo antes de jugarse ARMS_DEALING se pone a 0, si no lo evitamos el minion no se actualizara desde la carta
+        else if(tag == PT_ARMS_DEALING && value.toInt() != 0)
+        {
+            GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": TAG_CHANGE(" + powerLine.tag.toString() + ")= " + value.toString() +
+                     " -- Id: " + QString::number(entity.id), numLine, Normal);
+            emit buffHandCard(entity.id);
+        }
+        else if(PowerTags::isBoardTag(tag))
+        {
+            GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": MINION/CARD TAG_CHANGE(" + powerLine.tag.toString() + ")= " + value.toString() +
+                     " -- Id: " + QString::number(entity.id), numLine, Normal);
+            if(isPlayer)    emit playerBoardTagChange(entity.id, "", tag, PowerTags::value(tag, value));
+            else            emit enemyBoardTagChange(entity.id, "", tag, PowerTags::value(tag, value));
         }
+    }
 
+    //TAG_CHANGE conocido
+    //PowerTaskList aparece segundo pero hay acciones que no tienen GameState, como el damage del maestro del acero herido
+    //GameState.DebugPrintPower() -         TAG_CHANGE Entity=[entityName=Déspota del templo id=36 zone=PLAY zonePos=1 cardId=EX1_623 player=2] tag=DAMAGE value=0
+    //GameState.DebugPrintPower() -     TAG_CHANGE Entity=[entityName=Déspota del templo id=36 zone=PLAY zonePos=1 cardId=EX1_623 player=2] tag=ATK value=3
+    else if(PowerTags::isBoardTag(tag))
+    {
+        bool isPlayer = (entity.player == playerID);
+        int value = PowerTags::value(tag, powerLine.value);
+        QString cardId = entity.cardId.toString();
+
+        GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": MINION/CARD TAG_CHANGE(" + powerLine.tag.toString() + ")=" +
+                 powerLine.value.toString() + " -- " + entity.name.toString() + " -- Id: " + QString::number(entity.id), numLine, Normal);
+        if(isPlayer)    emit playerBoardTagChange(entity.id, cardId, tag, value);
+        else            emit enemyBoardTagChange(entity.id, cardId, tag, value);
+    }
+}
 
-        //CHANGE_ENTITY conocido
-        //CHANGE_ENTITY - Updating Entity=[entityName=Aullavísceras id=53 zone=HAND zonePos=3 cardId=EX1_411 player=2] CardID=OG_031
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - *CHANGE_ENTITY - Updating Entity="
-            "\\[entityName=.* id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=\\w* player=(\\d+)\\] "
-            "CardID=(\\w+)"
-            ), match))
+
+void GameWatcher::processPowerBlockStart(const PowerLine &powerLine, qint64 numLine)
+{
+    const PowerEntity &entity = powerLine.entity;
+    QString blockType = powerLine.blockType.toString();
+
+    //Enemigo accion desconocida
+    //BLOCK_START BlockType=PLAY Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=49 zone=HAND zonePos=3 cardId= player=2]
+    //EffectCardId= EffectIndex=0 Target=0
+    if(entity.unknown)
+    {
+        //ULTIMO TRIGGER SPECIAL CARDS, con o sin objetivo
+        GW_DEBUG("Trigger(" + blockType + ") desconocido. Id: " + QString::number(entity.id), numLine, Normal);
+        emit specialCardTrigger("", blockType, entity.id, -1);
+        return;
+    }
+    if(entity.cardId.isEmpty())     return;
+
+
+    //Jugador/Enemigo accion con/sin objetivo
+    //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=ATTACK Entity=[entityName=Jinete de lobos id=45 zone=PLAY zonePos=1 cardId=CS2_124 player=2]
+    //EffectCardId= EffectIndex=-1 Target=[entityName=Jaina Valiente id=64 zone=PLAY zonePos=0 cardId=HERO_08 player=1]
+    //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=TRIGGER Entity=[entityName=Trepadora embrujada id=12 zone=GRAVEYARD zonePos=0 cardId=FP1_002 player=1]
+    //EffectCardId= EffectIndex=0 Target=0
+    //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=POWER Entity=[entityName=Elemental de Escarcha id=43 zone=PLAY zonePos=1 cardId=EX1_283 player=2]
+    //EffectCardId= EffectIndex=-1 Target=[entityName=Trituradora antigua de Sneed id=23 zone=PLAY zonePos=5 cardId=GVG_114 player=1]
+    //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=FATIGUE Entity=[entityName=Malfurion Tempestira id=76 zone=PLAY zonePos=0 cardId=HERO_06 player=1]
+    //EffectCardId= EffectIndex=0 Target=0
+    bool hasTarget = powerLine.target.valid && !powerLine.target.cardId.isEmpty();
+    QString name1 = entity.name.toString();
+    int id1 = entity.id;
+    const QStringRef &zone = entity.zone;
+    QString cardId1 = entity.cardId.toString();
+    QString name2 = hasTarget?powerLine.target.name.toString():QString();
+    int id2 = hasTarget?powerLine.target.id:-1;
+    QString cardId2 = hasTarget?powerLine.target.cardId.toString():QString();
+    bool isPlayer = (entity.player == playerID);
+
+
+    //ULTIMO TRIGGER SPECIAL CARDS, con o sin objetivo
+    GW_DEBUG("Trigger(" + blockType + "): " + name1 + " (" + cardId1 + ")" +
+             (name2.isEmpty()?"":" --> " + name2 + " (" + cardId2 + ")"), numLine, Normal);
+    emit specialCardTrigger(cardId1, blockType, id1, id2);
+    if(isHeroPower(cardId1) && isPlayerTurn && entity.player==playerID)     emit playerHeroPower();
+
+
+    //Accion sin objetivo
+    if(!hasTarget)
+    {
+        if(blockType == "FATIGUE" && zone == QLatin1String("PLAY"))
         {
-            QString id = match->captured(1);
-            QString zone = match->captured(2);
-            QString player = match->captured(3);
-            QString newCardId = match->captured(4);
-            bool isPlayer = (player.toInt() == playerID);
-
-            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": CHANGE_ENTITY -- Id: " + id +
-                        " to Code: " + newCardId + " in Zone: " + zone, numLine);
-            lastShowEntity.id = id.toInt();
-            lastShowEntity.isPlayer = isPlayer;
-            lastShowEntity.trackAllTags = true;
+            GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Fatigue damage.", numLine, Normal);
+            if(advanceTurn(isPlayer))       emit newTurn(isPlayerTurn, turnReal);
+        }
+    }
 
-            if(zone == "HAND")
+    //Accion con objetivo en PLAY
+    else if(powerLine.target.zone == QLatin1String("PLAY"))
+    {
+        //Jugador juega carta con objetivo en PLAY, No enemigo pq BlockType=PLAY es de entity desconocida para el enemigo
+        if(blockType == "PLAY" && zone == QLatin1String("HAND"))
+        {
+            DeckCard deckCard(cardId1);
+            if(deckCard.getType() == SPELL)
             {
-                if(isPlayer)    emit playerCardCodeChange(id.toInt(), newCardId);
+                GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Spell obj played: " +
+                         name1 + " on target " + name2, numLine, Normal);
+                if(cardId2 == MAD_SCIENTIST)
+                {
+                    GW_DEBUG("Skip spell obj testing (Mad Scientist died).", 0, Normal);
+                }
+                else if(isPlayer && isPlayerTurn)
+                {
+                    if(cardId2.startsWith("HERO"))  emit playerSpellObjHeroPlayed();
+                    else                            emit playerSpellObjMinionPlayed();
+                }
             }
-            else if(zone == "PLAY")
+            else
             {
-                emit minionCodeChange(isPlayer, id.toInt(), newCardId);
+                GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Minion/weapon obj played: " +
+                         name1 + " target " + name2, numLine, Normal);
+                if(isPlayer && isPlayerTurn)
+                {
+                    if(cardId2.startsWith("HERO"))  emit playerBattlecryObjHeroPlayed();//Secreto Evasion
+//                    else                            emit playerBattlecryObjMinionPlayed();//No se usa aun
+                }
             }
         }
 
+        //Jugador/enemigo causa accion con objetivo en PLAY
+        else if(blockType == "POWER")
+        {
+            if(isPlayer)    emit playerCardObjPlayed(cardId1, id1, id2);
+            else            emit enemyCardObjPlayed(cardId1, id1, id2);
+        }
 
-        //Jugador/Enemigo accion con/sin objetivo
-        //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=ATTACK Entity=[entityName=Jinete de lobos id=45 zone=PLAY zonePos=1 cardId=CS2_124 player=2]
-        //EffectCardId= EffectIndex=-1 Target=[entityName=Jaina Valiente id=64 zone=PLAY zonePos=0 cardId=HERO_08 player=1]
-        //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=TRIGGER Entity=[entityName=Trepadora embrujada id=12 zone=GRAVEYARD zonePos=0 cardId=FP1_002 player=1]
-        //EffectCardId= EffectIndex=0 Target=0
-        //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=POWER Entity=[entityName=Elemental de Escarcha id=43 zone=PLAY zonePos=1 cardId=EX1_283 player=2]
-        //EffectCardId= EffectIndex=-1 Target=[entityName=Trituradora antigua de Sneed id=23 zone=PLAY zonePos=5 cardId=GVG_114 player=1]
-        //PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=FATIGUE Entity=[entityName=Malfurion Tempestira id=76 zone=PLAY zonePos=0 cardId=HERO_06 player=1]
-        //EffectCardId= EffectIndex=0 Target=0
-        else if(line.contains(QRegularExpression(
-            "PowerTaskList\\.DebugPrintPower\\(\\) - BLOCK_START BlockType=(\\w+) "
-            "Entity=\\[entityName=(.*) id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=(\\w+) player=(\\d+)\\] "
-            "EffectCardId=\\w* EffectIndex=-?\\d+ "
-            "Target=(?:\\[entityName=(.*) id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=(\\w+) player=\\d+\\])?"
-            ), match))
+        //Jugador/Enemigo ataca (esbirro/heroe VS esbirro/heroe)
+        else if(blockType == "ATTACK" && zone == QLatin1String("PLAY"))
         {
-            QString blockType = match->captured(1);
-            QString name1 = match->captured(2);
-            QString id1 = match->captured(3);
-            QString zone = match->captured(4);
-            QString cardId1 = match->captured(5);
-            QString player1 = match->captured(6);
-            QString name2 = match->captured(7);
-            QString id2 = match->captured(8);
-            QString zone2 = match->captured(9);
-            QString cardId2 = match->captured(10);
-            bool isPlayer = (player1.toInt() == playerID);
-
-
-            //ULTIMO TRIGGER SPECIAL CARDS, con o sin objetivo
-            emit pDebug("Trigger(" + blockType + "): " + name1 + " (" + cardId1 + ")" +
-                        (name2.isEmpty()?"":" --> " + name2 + " (" + cardId2 + ")"), numLine);
-            emit specialCardTrigger(cardId1, blockType, id1.toInt(), id2.isEmpty()?-1:id2.toInt());
-            if(isHeroPower(cardId1) && isPlayerTurn && player1.toInt()==playerID)     emit playerHeroPower();
-
-
-            //Accion sin objetivo
-            if(zone2.isEmpty())
+            emit zonePlayAttack(cardId1, id1, id2);
+
+            if(cardId1.contains("HERO"))
             {
-                if(blockType == "FATIGUE" && zone == "PLAY")
+                if(cardId2.contains("HERO"))
                 {
-                    emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Fatigue damage.", numLine);
-                    if(advanceTurn(isPlayer))       emit newTurn(isPlayerTurn, turnReal);
+                    GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
+                             name1 + " (heroe)vs(heroe) " + name2, numLine, Normal);
+                    if(isPlayer && isPlayerTurn)    emit playerAttack(true, true, playerMinions);
                 }
-            }
-
-            //Accion con objetivo en PLAY
-            else if(zone2 == "PLAY")
-            {
-                //Jugador juega carta con objetivo en PLAY, No enemigo pq BlockType=PLAY es de entity desconocida para el enemigo
-                if(blockType == "PLAY" && zone == "HAND")
+                else
                 {
-                    DeckCard deckCard(cardId1);
-                    if(deckCard.getType() == SPELL)
-                    {
-                        emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Spell obj played: " +
-                                    name1 + " on target " + name2, numLine);
-                        if(cardId2 == MAD_SCIENTIST)
-                        {
-                            emit pDebug("Skip spell obj testing (Mad Scientist died).", 0);
-                        }
-                        else if(isPlayer && isPlayerTurn)
-                        {
-                            if(cardId2.startsWith("HERO"))  emit playerSpellObjHeroPlayed();
-                            else                            emit playerSpellObjMinionPlayed();
-                        }
-                    }
-                    else
+                    GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
+                             name1 + " (heroe)vs(minion) " + name2, numLine, Normal);
+                    /*if(match->captured(5) == MAD_SCIENTIST) //Son comprobaciones now de secretos
                     {
-                        emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Minion/weapon obj played: " +
-                                    name1 + " target " + name2, numLine);
-                        if(isPlayer && isPlayerTurn)
-                        {
-                            if(cardId2.startsWith("HERO"))  emit playerBattlecryObjHeroPlayed();//Secreto Evasion
-//                            else                            emit playerBattlecryObjMinionPlayed();//No se usa aun
-                        }
+                        emit pDebug("Saltamos comprobacion de secretos";
                     }
+                    else */if(isPlayer && isPlayerTurn)    emit playerAttack(true, false, playerMinions);
                 }
-
-                //Jugador/enemigo causa accion con objetivo en PLAY
-                else if(blockType == "POWER")
+            }
+            else
+            {
+                if(cardId2.contains("HERO"))
                 {
-                    if(isPlayer)    emit playerCardObjPlayed(cardId1, id1.toInt(), id2.toInt());
-                    else            emit enemyCardObjPlayed(cardId1, id1.toInt(), id2.toInt());
+                    GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
+                             name1 + " (minion)vs(heroe) " + name2, numLine, Normal);
+                    if(isPlayer && isPlayerTurn)    emit playerAttack(false, true, playerMinions);
                 }
-
-                //Jugador/Enemigo ataca (esbirro/heroe VS esbirro/heroe)
-                else if(blockType == "ATTACK" && zone == "PLAY")
+                else
                 {
-                    emit zonePlayAttack(cardId1, id1.toInt(), id2.toInt());
-
-                    if(cardId1.contains("HERO"))
+                    GW_DEBUG((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
+                             name1 + " (minion)vs(minion) " + name2, numLine, Normal);
+                    /*if(match->captured(5) == MAD_SCIENTIST) //Son comprobaciones now de secretos
                     {
-                        if(cardId2.contains("HERO"))
-                        {
-                            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
-                                        name1 + " (heroe)vs(heroe) " + name2, numLine);
-                            if(isPlayer && isPlayerTurn)    emit playerAttack(true, true, playerMinions);
-                        }
-                        else
-                        {
-                            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
-                                        name1 + " (heroe)vs(minion) " + name2, numLine);
-                            /*if(match->captured(5) == MAD_SCIENTIST) //Son comprobaciones now de secretos
-                            {
-                                emit pDebug("Saltamos comprobacion de secretos";
-                            }
-                            else */if(isPlayer && isPlayerTurn)    emit playerAttack(true, false, playerMinions);
-                        }
-                    }
-                    else
-                    {
-                        if(cardId2.contains("HERO"))
-                        {
-                            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
-                                        name1 + " (minion)vs(heroe) " + name2, numLine);
-                            if(isPlayer && isPlayerTurn)    emit playerAttack(false, true, playerMinions);
-                        }
-                        else
-                        {
-                            emit pDebug((isPlayer?QString("Player"):QString("Enemy")) + ": Attack: " +
-                                        name1 + " (minion)vs(minion) " + name2, numLine);
-                            /*if(match->captured(5) == MAD_SCIENTIST) //Son comprobaciones now de secretos
-                            {
-                                emit pDebug("Saltamos comprobacion de secretos";
-                            }
-                            else */if(isPlayer && isPlayerTurn)    emit playerAttack(false, false, playerMinions);
-                        }
+                        emit pDebug("Saltamos comprobacion de secretos";
                     }
+                    else */if(isPlayer && isPlayerTurn)    emit playerAttack(false, false, playerMinions);
                 }
             }
         }
@@ -893,12 +818,14 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
 {
     if(powerState == noGame)   return;
 
+    //Prefiltros literales
+    bool isZoneFrom = line.contains(QLatin1String("] zone from "));
+    bool isPosFrom = !isZoneFrom && line.contains(QLatin1String("] pos from "));
+    if(!isZoneFrom && !isPosFrom)   return;
+
     //Carta desconocida
     //[entityName=UNKNOWN ENTITY [cardType=INVALID] id=69 zone=HAND zonePos=0 cardId= player=2] zone from OPPOSING DECK -> OPPOSING HAND
-    if(line.contains(QRegularExpression(
-        "\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=\\d+\\] zone from "
-        "(\\w+ \\w+(?: \\(Weapon\\))?)? -> (\\w+ \\w+(?: \\((?:Weapon|Hero|Hero Power)\\))?)?"
-        ), match))
+    if(isZoneFrom && line.contains(LogPatterns::get(LP_ZONE_UNKNOWN), match))
     {
         QString id = match->captured(1);
         QString zoneFrom = match->captured(2);
@@ -908,7 +835,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Enemigo juega secreto
         if(zoneTo == "OPPOSING SECRET")
         {
-            emit pDebug("Enemy: Secret played. ID: " + id, numLine);
+            GW_DEBUG("Enemy: Secret played. ID: " + id, numLine, Normal);
             emit enemySecretPlayed(id.toInt(), secretHero, loadingScreenState);
         }
 
@@ -921,7 +848,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
                 if(zoneFrom == "OPPOSING DECK")
                 {
                     bool advance = advanceTurn(false);
-                    emit pDebug("Enemy: Card drawn. ID: " + id, numLine);
+                    GW_DEBUG("Enemy: Card drawn. ID: " + id, numLine, Normal);
                     if(advance && turnReal==1)      emit newTurn(isPlayerTurn, turnReal);
                     emit enemyCardDraw(id.toInt(), turnReal);
                     if(advance && turnReal!=1)      emit newTurn(isPlayerTurn, turnReal);
@@ -929,14 +856,14 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
                 //Enemigo roba carta especial del vacio
                 else if(zoneFrom.isEmpty())
                 {
-                    emit pDebug("Enemy: Special card drawn. ID: " + id, numLine);
+                    GW_DEBUG("Enemy: Special card drawn. ID: " + id, numLine, Normal);
                     emit enemyCardDraw(id.toInt(), turnReal, true);
                 }
             }
             else
             {
                 //Enemigo roba starting card
-                emit pDebug("Enemy: Starting card drawn. ID: " + id, numLine);
+                GW_DEBUG("Enemy: Starting card drawn. ID: " + id, numLine, Normal);
                 emit enemyCardDraw(id.toInt());
             }
         }
@@ -946,7 +873,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         {
             if(mulliganPlayerDone)
             {
-                emit pDebug("Player: Outsider unknown card to deck. ID: " + id, numLine);
+                GW_DEBUG("Player: Outsider unknown card to deck. ID: " + id, numLine, Normal);
                 emit playerReturnToDeck("", id.toInt());
             }
         }
@@ -958,12 +885,12 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             //Carta devuelta al mazo en Mulligan
             if(zoneTo == "OPPOSING DECK")
             {
-                emit pDebug("Enemy: Starting card returned. ID: " + id, numLine);
+                GW_DEBUG("Enemy: Starting card returned. ID: " + id, numLine, Normal);
                 emit enemyCardPlayed(id.toInt(), "", true);
             }
             else
             {
-                emit pDebug("Enemy: Unknown card played. ID: " + id, numLine);
+                GW_DEBUG("Enemy: Unknown card played. ID: " + id, numLine, Normal);
                 emit enemyCardPlayed(id.toInt());
             }
         }
@@ -971,7 +898,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Jugador, elimina OUTSIDER desconocido de deck
         else if(zoneFrom == "FRIENDLY DECK")
         {
-            emit pDebug("Player: Unknown card removed from deck. ID: " + id, numLine);
+            GW_DEBUG("Player: Unknown card removed from deck. ID: " + id, numLine, Normal);
             emit playerCardDraw("", id.toInt());
         }
     }
@@ -980,10 +907,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
     //Carta conocida
     //[entityName=Shellshifter id=32 zone=HAND zonePos=0 cardId=UNG_101 player=1] zone from FRIENDLY DECK -> FRIENDLY HAND
     //[entityName=Shellshifter id=32 zone=DECK zonePos=0 cardId= player=1] zone from FRIENDLY HAND -> FRIENDLY DECK
-    else if(line.contains(QRegularExpression(
-        "\\[entityName=(.*) id=(\\d+) zone=\\w+ zonePos=(\\d+) cardId=(\\w*) player=(\\d+)\\] zone from "
-        "(\\w+ \\w+(?: \\(Weapon\\))?)? -> (\\w+ \\w+(?: \\((?:Weapon|Hero|Hero Power)\\))?)?"
-        ), match))
+    else if(isZoneFrom && line.contains(LogPatterns::get(LP_ZONE_KNOWN), match))
     {
         QString name = match->captured(1);
         QString id = match->captured(2);
@@ -999,7 +923,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Jugador juega secreto
         if(zoneTo == "FRIENDLY SECRET" && zoneFrom != "OPPOSING SECRET")
         {
-            emit pDebug("Player: Secret played: " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Secret played: " + name + " ID: " + id, numLine, Normal);
             emit playerSecretPlayed(id.toInt(), cardId);
         }
 
@@ -1009,7 +933,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             bool advance = false;
             if(zoneFrom == "OPPOSING DECK")
             {
-                emit pDebug("Enemy: Known card to hand from deck (Hidden to avoid cheating): " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Known card to hand from deck (Hidden to avoid cheating): " + name + " ID: " + id, numLine, Normal);
                 advance = advanceTurn(false);
                 //Bug HS, aun no deberiamos conocer esta carta, no queremos que vaya a enemy deck tab hasta que sea jugada
                 //emit enemyKnownCardDraw(id.toInt(), cardId);
@@ -1021,7 +945,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             }
             else
             {
-                emit pDebug("Enemy: Known card to hand: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Known card to hand: " + name + " ID: " + id, numLine, Normal);
                 emit enemyCardDraw(id.toInt(), turnReal, false, cardId);
             }
         }
@@ -1031,7 +955,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         {
             if(mulliganPlayerDone)//Evita que las cartas iniciales creen un nuevo Board en PlanHandler al ser robadas
             {
-                emit pDebug("Player: Known card to hand: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Known card to hand: " + name + " ID: " + id, numLine, Normal);
                 bool advance = false;
                 if(zoneFrom == "FRIENDLY DECK")
                 {
@@ -1043,7 +967,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             }
             else
             {
-                emit pDebug("Player: Starting card to hand: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Starting card to hand: " + name + " ID: " + id, numLine, Normal);
                 emit playerCardToHand(id.toInt(), cardId, 0);
             }
         }
@@ -1051,7 +975,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Jugador, OUTSIDER a deck
         else if(zoneTo == "FRIENDLY DECK" && zoneFrom != "FRIENDLY DECK" && zoneFrom != "FRIENDLY HAND")
         {
-            emit pDebug("Player: Outsider card to deck: " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Outsider card to deck: " + name + " ID: " + id, numLine, Normal);
             emit playerReturnToDeck(cardId, id.toInt());
         }
 
@@ -1059,7 +983,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         else if(zoneTo == "OPPOSING PLAY" && zoneFrom != "OPPOSING PLAY")
         {
             enemyMinions++;
-            emit pDebug("Enemy: Minion moved to OPPOSING PLAY: " + name + " ID: " + id + " Minions: " + QString::number(enemyMinions), numLine);
+            GW_DEBUG("Enemy: Minion moved to OPPOSING PLAY: " + name + " ID: " + id + " Minions: " + QString::number(enemyMinions), numLine, Normal);
             if(zoneFrom == "FRIENDLY PLAY") emit playerMinionZonePlaySteal(id.toInt(), zonePos.toInt());
             else if(zoneFrom.isEmpty())     emit enemyMinionZonePlayAddTriggered(cardId, id.toInt(), zonePos.toInt());
             else                            emit enemyMinionZonePlayAdd(cardId, id.toInt(), zonePos.toInt());
@@ -1069,7 +993,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         else if(zoneTo == "FRIENDLY PLAY" && zoneFrom != "FRIENDLY PLAY")
         {
             playerMinions++;
-            emit pDebug("Player: Minion moved to FRIENDLY PLAY: " + name + " ID: " + id + " Minions: " + QString::number(playerMinions), numLine);
+            GW_DEBUG("Player: Minion moved to FRIENDLY PLAY: " + name + " ID: " + id + " Minions: " + QString::number(playerMinions), numLine, Normal);
             if(zoneFrom == "OPPOSING PLAY") emit enemyMinionZonePlaySteal(id.toInt(), zonePos.toInt());
             else if(zoneFrom.isEmpty())     emit playerMinionZonePlayAddTriggered(cardId, id.toInt(), zonePos.toInt());
             else                            emit playerMinionZonePlayAdd(cardId, id.toInt(), zonePos.toInt());
@@ -1078,26 +1002,26 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Enemigo, carga heroe
         else if(zoneTo == "OPPOSING PLAY (Hero)")
         {
-            emit pDebug("Enemy: Hero moved to OPPOSING PLAY (Hero): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Enemy: Hero moved to OPPOSING PLAY (Hero): " + name + " ID: " + id, numLine, Normal);
             emit enemyHeroZonePlayAdd(cardId, id.toInt());
         }
 
         //Jugador, carga heroe
         else if(zoneTo == "FRIENDLY PLAY (Hero)")
         {
-            emit pDebug("Player: Hero moved to FRIENDLY PLAY (Hero): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Hero moved to FRIENDLY PLAY (Hero): " + name + " ID: " + id, numLine, Normal);
             if(playerID == 0)
             {
                 playerID = player.toInt();
                 emit enemyHero((playerID == 1)?hero2:hero1);
-                emit pDebug("Found playerID: " + player, numLine);
+                GW_DEBUG("Found playerID: " + player, numLine, Normal);
 
                 secretHero = Utility::heroFromLogNumber((playerID == 1)?hero1:hero2);
 
                 if(playerTag.isEmpty())
                 {
                     playerTag = (playerID == 1)?name1:name2;
-                    if(!playerTag.isEmpty())    emit pDebug("Found playerTag: " + playerTag, numLine);
+                    if(!playerTag.isEmpty())    GW_DEBUG("Found playerTag: " + playerTag, numLine, Normal);
                 }
             }
             emit playerHeroZonePlayAdd(cardId, id.toInt());
@@ -1106,28 +1030,28 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Enemigo, carga hero power
         else if(zoneTo == "OPPOSING PLAY (Hero Power)")
         {
-            emit pDebug("Enemy: Hero Power moved to OPPOSING PLAY (Hero Power): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Enemy: Hero Power moved to OPPOSING PLAY (Hero Power): " + name + " ID: " + id, numLine, Normal);
             emit enemyHeroPowerZonePlayAdd(cardId, id.toInt());
         }
 
         //Jugador, carga hero power
         else if(zoneTo == "FRIENDLY PLAY (Hero Power)")
         {
-            emit pDebug("Player: Hero Power moved to FRIENDLY PLAY (Hero Power): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Hero Power moved to FRIENDLY PLAY (Hero Power): " + name + " ID: " + id, numLine, Normal);
             emit playerHeroPowerZonePlayAdd(cardId, id.toInt());
         }
 
         //Enemigo, equipa arma
         else if(zoneTo == "OPPOSING PLAY (Weapon)" && zoneFrom != "OPPOSING GRAVEYARD")//Al reemplazar un arma por otra, la antigua va, vuelve y va a graveyard.
         {
-            emit pDebug("Enemy: Weapon moved to OPPOSING PLAY (Weapon): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Enemy: Weapon moved to OPPOSING PLAY (Weapon): " + name + " ID: " + id, numLine, Normal);
             emit enemyWeaponZonePlayAdd(cardId, id.toInt());
         }
 
         //Jugador, equipa arma
         else if(zoneTo == "FRIENDLY PLAY (Weapon)" && zoneFrom != "FRIENDLY GRAVEYARD")
         {
-            emit pDebug("Player: Weapon moved to FRIENDLY PLAY (Weapon): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Weapon moved to FRIENDLY PLAY (Weapon): " + name + " ID: " + id, numLine, Normal);
             emit playerWeaponZonePlayAdd(cardId, id.toInt());
         }
 
@@ -1139,13 +1063,13 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             //Enemigo roba secreto (kezan mystic)
             if(zoneTo == "OPPOSING SECRET")
             {
-                emit pDebug("Enemy: Secret stolen: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Secret stolen: " + name + " ID: " + id, numLine, Normal);
                 emit enemySecretStolen(id.toInt(), cardId);
             }
             //Jugador secreto desvelado
             else
             {
-                emit pDebug("Player: Secret revealed: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Secret revealed: " + name + " ID: " + id, numLine, Normal);
                 emit playerSecretRevealed(id.toInt(), cardId);
             }
         }
@@ -1155,13 +1079,13 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             //Jugador roba secreto (kezan mystic)
             if(zoneTo == "FRIENDLY SECRET")
             {
-                emit pDebug("Player: Secret stolen: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Secret stolen: " + name + " ID: " + id, numLine, Normal);
                 emit playerSecretStolen(id.toInt(), cardId);
             }
             //Enemigo secreto desvelado
             else if(zoneTo != "OPPOSING SECRET")
             {
-                emit pDebug("Enemy: Secret revealed: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Secret revealed: " + name + " ID: " + id, numLine, Normal);
                 emit enemySecretRevealed(id.toInt(), cardId);
             }
         }
@@ -1174,38 +1098,38 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             //Enemigo juega hechizo
             if(zoneTo.isEmpty() || zoneTo == "OPPOSING SECRET")
             {
-                emit pDebug("Enemy: Spell played: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Spell played: " + name + " ID: " + id, numLine, Normal);
             }
             //Enemigo juega esbirro
             else if(zoneTo == "OPPOSING PLAY")
             {
-                emit pDebug("Enemy: Minion played: " + name + " ID: " + id + " Minions: " + QString::number(enemyMinions), numLine);
+                GW_DEBUG("Enemy: Minion played: " + name + " ID: " + id + " Minions: " + QString::number(enemyMinions), numLine, Normal);
             }
             //Enemigo juega arma
             else if(zoneTo == "OPPOSING PLAY (Weapon)")
             {
-                emit pDebug("Enemy: Weapon played: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Weapon played: " + name + " ID: " + id, numLine, Normal);
             }
             //Enemigo juega heroe
             else if(zoneTo == "OPPOSING PLAY (Hero)")
             {
-                emit pDebug("Enemy: Hero played: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Hero played: " + name + " ID: " + id, numLine, Normal);
             }
             //Enemigo descarta carta
             else if(zoneTo == "OPPOSING GRAVEYARD")
             {
-                emit pDebug("Enemy: Card discarded: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Card discarded: " + name + " ID: " + id, numLine, Normal);
                 discard = true;
             }
             //Carta devuelta al mazo en Mulligan, Leviatan de llamas
             else if(zoneTo == "OPPOSING DECK")
             {
-                emit pDebug("Enemy: Starting card returned: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Enemy: Starting card returned: " + name + " ID: " + id, numLine, Normal);
                 discard = true;
             }
             else
             {
-                emit pDebug("Enemy: Card moved from hand: " + name + " ID: " + id, numLine, Warning);
+                GW_DEBUG("Enemy: Card moved from hand: " + name + " ID: " + id, numLine, Warning);
                 discard = true;
             }
 
@@ -1216,7 +1140,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         else if(zoneFrom == "OPPOSING DECK" && (zoneTo == "OPPOSING GRAVEYARD" || zoneTo == "OPPOSING PLAY"))
         {
             bool advance = advanceTurn(false);
-            emit pDebug("Enemy: Card from deck skipped hand (overdraw/recruit): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Enemy: Card from deck skipped hand (overdraw/recruit): " + name + " ID: " + id, numLine, Normal);
             emit enemyKnownCardDraw(id.toInt(), cardId);
             if(advance)     emit newTurn(isPlayerTurn, turnReal);
         }
@@ -1229,7 +1153,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Explorar un'goro vacia el deck a empty y lo rellena de explorar un'goro. PRO
         else if(zoneFrom == "FRIENDLY DECK" && zoneTo != "FRIENDLY DECK")
         {
-            emit pDebug("Player: Card drawn: " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Card drawn: " + name + " ID: " + id, numLine, Normal);
             //El avance de turno ocurre generalmente en (zoneTo == "FRIENDLY HAND") pero en el caso de overdraw ocurrira aqui.
             if(mulliganPlayerDone)//Evita que las cartas iniciales creen un nuevo Board en PlanHandler al ser robadas
             {
@@ -1247,42 +1171,42 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
             //Jugador juega hechizo
             if(zoneTo.isEmpty() || zoneTo == "FRIENDLY SECRET")//En spectator mode los secretos van FRIENDLY HAND --> FRIENDLY SECRET
             {
-                emit pDebug("Player: Spell played: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Spell played: " + name + " ID: " + id, numLine, Normal);
                 if(isPlayerTurn)    emit playerSpellPlayed(cardId);
             }
             //Jugador juega esbirro
             else if(zoneTo == "FRIENDLY PLAY")
             {
-                emit pDebug("Player: Minion played: " + name + " ID: " + id + " Minions: " + QString::number(playerMinions), numLine);
+                GW_DEBUG("Player: Minion played: " + name + " ID: " + id + " Minions: " + QString::number(playerMinions), numLine, Normal);
                 if(isPlayerTurn)    emit playerMinionPlayed(cardId, playerMinions);
             }
             //Jugador juega arma
             else if(zoneTo == "FRIENDLY PLAY (Weapon)")
             {
-                emit pDebug("Player: Weapon played: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Weapon played: " + name + " ID: " + id, numLine, Normal);
             }
             //Jugador juega heroe
             else if(zoneTo == "FRIENDLY PLAY (Hero)")
             {
-                emit pDebug("Player: Hero played: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Hero played: " + name + " ID: " + id, numLine, Normal);
             }
             //Jugador descarta carta
             else if(zoneTo == "FRIENDLY GRAVEYARD")
             {
-                emit pDebug("Player: Card discarded: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Card discarded: " + name + " ID: " + id, numLine, Normal);
                 discard = true;
             }
             //Carta devuelta al mazo en Mulligan
             //(Quizas sea util verificar que estamos en el turno 1 o puede dar problemas en el futuro)
             else if(zoneTo == "FRIENDLY DECK")
             {
-                emit pDebug("Player: Starting card returned: " + name + " ID: " + id, numLine);
+                GW_DEBUG("Player: Starting card returned: " + name + " ID: " + id, numLine, Normal);
                 emit playerReturnToDeck(cardId, id.toInt());
                 discard = true;
             }
             else
             {
-                emit pDebug("Player: Card moved from hand: " + name + " ID: " + id, numLine, Warning);
+                GW_DEBUG("Player: Card moved from hand: " + name + " ID: " + id, numLine, Warning);
                 discard = true;
             }
 
@@ -1294,7 +1218,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
                 playerCardsPlayedThisTurn++;
                 if(playerCardsPlayedThisTurn > 2)
                 {
-                    emit pDebug("Rat trap/Hidden wisdom tested: This turn cards played: " + QString::number(playerCardsPlayedThisTurn), 0);
+                    GW_DEBUG("Rat trap/Hidden wisdom tested: This turn cards played: " + QString::number(playerCardsPlayedThisTurn), 0, Normal);
                     emit _3CardsPlayedTested();
                 }
             }
@@ -1304,7 +1228,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         else if(zoneFrom == "OPPOSING PLAY" && zoneTo != "OPPOSING PLAY")
         {
             if(enemyMinions>0)  enemyMinions--;
-            emit pDebug("Enemy: Minion removed from OPPOSING PLAY: " + name + " ID: " + id + " Minions: " + QString::number(enemyMinions), numLine);
+            GW_DEBUG("Enemy: Minion removed from OPPOSING PLAY: " + name + " ID: " + id + " Minions: " + QString::number(enemyMinions), numLine, Normal);
             if(zoneTo != "FRIENDLY PLAY")   emit enemyMinionZonePlayRemove(id.toInt());
 
             if(zoneTo == "OPPOSING GRAVEYARD")
@@ -1317,7 +1241,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
                     {
                         if(cardId == MAD_SCIENTIST)
                         {
-                            emit pDebug("Skip avenge testing (Mad Scientist died).", 0);
+                            GW_DEBUG("Skip avenge testing (Mad Scientist died).", 0, Normal);
                         }
                         else
                         {
@@ -1333,11 +1257,11 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
                     {
                         if(cardId == MAD_SCIENTIST)
                         {
-                            emit pDebug("Skip Hand of salvation testing (Mad Scientist died).", 0);
+                            GW_DEBUG("Skip Hand of salvation testing (Mad Scientist died).", 0, Normal);
                         }
                         else
                         {
-                            emit pDebug("Hand of salvation tested: This turn died: " + QString::number(enemyMinionsDeadThisTurn), 0);
+                            GW_DEBUG("Hand of salvation tested: This turn died: " + QString::number(enemyMinionsDeadThisTurn), 0, Normal);
                             emit handOfSalvationTested();
                         }
                     }
@@ -1349,7 +1273,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         else if(zoneFrom == "FRIENDLY PLAY" && zoneTo != "FRIENDLY PLAY")
         {
             if(playerMinions>0) playerMinions--;
-            emit pDebug("Player: Minion removed from FRIENDLY PLAY: " + name + " ID: " + id + " Minions: " + QString::number(playerMinions), numLine);
+            GW_DEBUG("Player: Minion removed from FRIENDLY PLAY: " + name + " ID: " + id + " Minions: " + QString::number(playerMinions), numLine, Normal);
             if(zoneTo != "OPPOSING PLAY")   emit playerMinionZonePlayRemove(id.toInt());
 
             if(zoneTo == "FRIENDLY GRAVEYARD")  emit playerMinionGraveyard(id.toInt(), cardId);
@@ -1358,7 +1282,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Enemigo, deshecha arma
         else if(zoneFrom == "OPPOSING PLAY (Weapon)")
         {
-            emit pDebug("Enemy: Weapon moved from OPPOSING PLAY (Weapon): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Enemy: Weapon moved from OPPOSING PLAY (Weapon): " + name + " ID: " + id, numLine, Normal);
             emit enemyWeaponZonePlayRemove(id.toInt());
 
             if(zoneTo == "OPPOSING GRAVEYARD")  emit enemyWeaponGraveyard(id.toInt(), cardId);
@@ -1367,7 +1291,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
         //Jugador, deshecha arma
         else if(zoneFrom == "FRIENDLY PLAY (Weapon)")
         {
-            emit pDebug("Player: Weapon moved from FRIENDLY PLAY (Weapon): " + name + " ID: " + id, numLine);
+            GW_DEBUG("Player: Weapon moved from FRIENDLY PLAY (Weapon): " + name + " ID: " + id, numLine, Normal);
             emit playerWeaponZonePlayRemove(id.toInt());
 
             if(zoneTo == "FRIENDLY GRAVEYARD")  emit playerWeaponGraveyard(id.toInt(), cardId);
@@ -1381,9 +1305,7 @@ void GameWatcher::processZone(QString &line, qint64 numLine)
     //Ej: Si un esbirro con deathrattle produce otro esbirro. Primero se cambia la pos de los esbirros a la dcha
     //y despues se genran los esbirros de deathrattle causando una suma erronea.
     //id=7 local=True [entityName=Ingeniera novata id=25 zone=HAND zonePos=5 cardId=EX1_015 player=1] pos from 5 -> 3
-    else if(line.contains(QRegularExpression(
-        "\\[entityName=(.*) id=(\\d+) zone=(?:HAND|PLAY) zonePos=\\d+ cardId=\\w+ player=(\\d+)\\] pos from \\d+ -> (\\d+)"
-        ), match))
+    else if(isPosFrom && line.contains(LogPatterns::get(LP_ZONE_POS), match))
     {
         QString name = match->captured(1);
         QString id = match->captured(2);
@@ -1423,9 +1345,9 @@ void GameWatcher::checkAvenge()
     if(enemyMinionsAliveForAvenge > 0)
     {
         emit avengeTested();
-        emit pDebug("Avenge tested: Survivors: " + QString::number(enemyMinionsAliveForAvenge), 0);
+        GW_DEBUG("Avenge tested: Survivors: " + QString::number(enemyMinionsAliveForAvenge), 0, Normal);
     }
-    else    emit pDebug("Avenge not tested: Survivors: " + QString::number(enemyMinionsAliveForAvenge), 0);
+    else    GW_DEBUG("Avenge not tested: Survivors: " + QString::number(enemyMinionsAliveForAvenge), 0, Normal);
     enemyMinionsAliveForAvenge = -1;
 }
 
@@ -1463,18 +1385,18 @@ QString GameWatcher::createGameLog()
 {
     if(!copyGameLogs)
     {
-        emit pDebug("Game log copy disabled.", 0);
+        GW_DEBUG("Game log copy disabled.", 0, Normal);
         return "";
     }
     if(logSeekCreate == -1)
     {
-        emit pDebug("Cannot create match log. Not found CREATE_GAME", 0);
+        GW_DEBUG("Cannot create match log. Not found CREATE_GAME", 0, Normal);
         return "";
     }
 
     if(logSeekWon == -1)
     {
-        emit pDebug("Cannot create match log. Not found WON ", 0);
+        GW_DEBUG("Cannot create match log. Not found WON ", 0, Normal);
         return "";
     }
 
@@ -1496,7 +1418,7 @@ QString GameWatcher::createGameLog()
     QString fileName = gameMode + " " + timeStamp + " " + playerHero + "vs" + enemyHero + " " + win + " " + coin + ".arenatracker";
 
 
-    emit pDebug("Game log ready to be copied.", 0);
+    GW_DEBUG("Game log ready to be copied.", 0, Normal);
     emit gameLogComplete(logSeekCreate, logSeekWon, fileName);
     logSeekCreate = -1;
     logSeekWon = -1;
@@ -1524,7 +1446,7 @@ bool GameWatcher::advanceTurn(bool playerDraw)
     if(advance)
     {
         turnReal = turn;
-        emit pDebug("\nTurn: " + QString::number(turn) + " " + (playerTurn?"Player":"Enemy"), 0);
+        GW_DEBUG("\nTurn: " + QString::number(turn) + " " + (playerTurn?"Player":"Enemy"), 0, Normal);
 
         isPlayerTurn = playerTurn;
 
@@ -1535,7 +1457,7 @@ bool GameWatcher::advanceTurn(bool playerDraw)
         //Secret CSpirit test
         if(!isPlayerTurn && enemyMinions > 0)
         {
-            emit pDebug("CSpirit tested. Minions: " + QString::number(enemyMinions), 0);
+            GW_DEBUG("CSpirit tested. Minions: " + QString::number(enemyMinions), 0, Normal);
             emit cSpiritTested();
         }
 
@@ -1558,3 +1480,11 @@ void GameWatcher::setCopyGameLogs(bool value)
 }
 
 
+//MainWindow sustituye la CardDB al recargar cards.json y la entrega aqui: al procesarse este evento
+//ya no se esta parseando ninguna linea con ella, las siguientes leen la nueva (Utility::db()).
+void GameWatcher::deleteCardDB(CardDB *oldCardDB)
+{
+    delete oldCardDB;
+}
+
+
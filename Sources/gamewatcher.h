@@ -5,6 +5,11 @@
 #include <QString>
 #include "Cards/secretcard.h"
 #include "utility.h"
+#include "Utils/powertokenizer.h"
+#include "Utils/logsink.h"
+
+//Emite pDebug solo si LogSink va a escribir ese nivel, sin formatear antes la linea
+#define GW_DEBUG(line, numLine, level) do{ if(LogSink::isEnabled(level))  emit pDebug(line, numLine, level); }while(0)
 
 
 class GameResult
@@ -88,7 +93,9 @@ private:
     void processArena(QString &line, qint64 numLine);
     void processPower(QString &line, qint64 numLine, qint64 logSeek);
     void processPowerMulligan(QString &line, qint64 numLine);
-    void processPowerInGame(QString &line, qint64 numLine);
+    void processPowerInGame(const PowerLine &powerLine, qint64 numLine);
+    void processPowerTagChange(const PowerLine &powerLine, qint64 numLine);
+    void processPowerBlockStart(const PowerLine &powerLine, qint64 numLine);
     void processZone(QString &line, qint64 numLine);
     bool advanceTurn(bool playerDraw);
     void startReadingDeck();
@@ -98,9 +105,7 @@ private:
 
 
 public:
-    void reset();
     LoadingScreenState getLoadingScreen();
-    void setCopyGameLogs(bool value);
 
 signals:
     void newGameResult(GameResult gameResult, LoadingScreenState loadingScreen, QString logFileName, qint64 startGameEpoch);
@@ -147,11 +152,11 @@ signals:
     void enemyWeaponZonePlayRemove(int id);
     void playerMinionPosChange(int id, int pos);
     void enemyMinionPosChange(int id, int pos);
-    void playerBoardTagChange(int id, QString code, QString tag, QString value);
-    void enemyBoardTagChange(int id, QString code, QString tag, QString value);
-    void unknownTagChange(QString tag, QString value);
-    void playerTagChange(QString tag, QString value);
-    void enemyTagChange(QString tag, QString value);
+    void playerBoardTagChange(int id, QString code, PowerTag tag, int value);
+    void enemyBoardTagChange(int id, QString code, PowerTag tag, int value);
+    void unknownTagChange(PowerTag tag, int value);
+    void playerTagChange(PowerTag tag, int value);
+    void enemyTagChange(PowerTag tag, int value);
     void playerCardCodeChange(int id, QString newCode);
     void minionCodeChange(bool friendly, int id, QString newCode);
     void playerMinionGraveyard(int id, QString code);
@@ -190,6 +195,9 @@ private slots:
 public slots:
     void processLogLine(LogComponent logComponent, QString line, qint64 numLine, qint64 logSeek);
     void setDeckRead(bool value=true);
+    void reset();
+    void setCopyGameLogs(bool value);
+    void deleteCardDB(CardDB *oldCardDB);
 };
 
 #endif // GAMEWATCHER_H
@@ -239,7 +239,7 @@ void GraveyardHandler::newDeckCard(bool friendly, QString code, int id)
     }
 
     emit pDebug("Add to " + (friendly?QString("Player"):QString("Enemy")) + " Graveyard: " +
-                Utility::getCardAttribute(code, "name").toString());
+                Utility::cardLocalNameFromCode(code));
 }
 
 
@@ -1,5 +1,6 @@
 #include "logloader.h"
 #include <QtWidgets>
+#include <limits>
 
 LogLoader::LogLoader(QObject *parent) : QObject(parent)
 {
@@ -12,7 +13,15 @@ LogLoader::LogLoader(QObject *parent) : QObject(parent)
     logComponentList.append("Arena");
     logComponentList.append("Asset");
 
-    match = new QRegularExpressionMatch();
+    fileWatcher = nullptr;
+    watcherReadPending = false;
+    watcherReliable = false;
+    newLinesRead = false;
+    batchFirstLineTime = -1;
+    burstStarted = false;
+    sortReadPending = false;
+    dayOffset = maxTimeStamp = 0;
+    for(qint64 &watermark: dataLogWatermarks)   watermark = 0;
 }
 
 
@@ -27,7 +36,7 @@ bool LogLoader::init()
 
     createLogWorkers();
 
-    QTimer::singleShot(1, this, SLOT(sendLogWorkerFirstRun())); //Retraso para dejar que la aplicacion se pinte.
+    //La primera lectura (sendLogWorkerFirstRun) la lanza MainWindow al arrancar el hilo del parser.
     return true;
 }
 
@@ -275,52 +284,319 @@ LogLoader::~LogLoader()
 {
     foreach(LogWorker *worker, logWorkerMap.values())   delete worker;
     logWorkerMap.clear();
-    delete match;
+}
+
+
+//Sincronizacion inicial rapida. El historico de los logs se indexa (logSeek/numLine) sin pasar por GameWatcher:
+//- LoadingScreen se reproduce desde la ultima entrada en HUB, el estado anterior ya no importa.
+//- Power/Zone solo se reproducen si la ultima partida (ultimo CREATE_GAME) no ha terminado.
+//- Arena/Asset y las partidas terminadas no se reproducen, igual que antes.
+//Devuelve los componentes que hay que reproducir.
+QList<QString> LogLoader::fastForwardLogs()
+{
+    QList<QString> replayComponents;
+
+    //LoadingScreen.OnSceneLoaded() - prevMode=GAMEPLAY currMode=HUB
+    LogWorker *loadingWorker = logWorkerMap["LoadingScreen"];
+    qint64 hubSeek = loadingWorker->findLastLine([](const QByteArray &line)
+    {
+        return line.contains("OnSceneLoaded") && line.contains("currMode=HUB");
+    });
+    if(hubSeek != -1)   loadingWorker->fastForward(hubSeek);
+    replayComponents.append("LoadingScreen");
+
+    //GameState.DebugPrintPower() - CREATE_GAME
+    LogWorker *powerWorker = logWorkerMap["Power"];
+    int createTime = -1;
+    qint64 createSeek = powerWorker->findLastLine([&createTime](const QByteArray &line)
+    {
+        if(!line.contains("GameState.DebugPrintPower() - CREATE_GAME"))     return false;
+        createTime = LogWorker::lineTime(line);
+        return true;
+    });
+    bool gameInProgress = false;
+    if(createSeek != -1)
+    {
+        qint64 endSeek = powerWorker->findLastLine([](const QByteArray &line)
+        {
+            return line.contains("tag=PLAYSTATE value=WON") || line.contains("tag=PLAYSTATE value=TIED") ||
+                    line.contains("End Spectator Game");
+        }, createSeek);
+        gameInProgress = (endSeek == -1);
+    }
+
+    if(gameInProgress)
+    {
+        emit pDebug("Game in progress found in Power.log. Replaying from CREATE_GAME.");
+        powerWorker->fastForward(createSeek);
+        replayComponents.append("Power");
+
+        //Zone se reproduce desde la primera linea con hora >= CREATE_GAME (teniendo en cuenta el cambio de dia).
+        //Si no se puede situar CREATE_GAME en Zone no se reproduce su historico, se sigue desde el final.
+        LogWorker *zoneWorker = logWorkerMap["Zone"];
+        qint64 zoneSeek = -1;
+        if(createTime != -1)
+        {
+            const int dayMs = 24*60*60*1000;
+            int oldLineLength = 0;
+            qint64 oldSeek = zoneWorker->findLastLine([createTime, dayMs, &oldLineLength](const QByteArray &line)
+            {
+                int time = LogWorker::lineTime(line);
+                if(time == -1)  return false;
+                int delta = (createTime - time + dayMs) % dayMs;
+                if(delta == 0 || delta >= dayMs/2)  return false;
+                oldLineLength = line.size();
+                return true;
+            });
+            if(oldSeek != -1)   zoneSeek = oldSeek + oldLineLength;
+        }
+        if(zoneSeek == -1)
+        {
+            emit pDebug("Zone.log: no line before CREATE_GAME. Skipping to end of log.", DebugLevel::Warning);
+            zoneSeek = std::numeric_limits<qint64>::max();
+        }
+        zoneWorker->fastForward(zoneSeek);
+        replayComponents.append("Zone");
+    }
+
+    return replayComponents;
 }
 
 
 void LogLoader::sendLogWorkerFirstRun()
 {
+    QElapsedTimer timer;
+    timer.start();
+    QList<QString> replayComponents = fastForwardLogs();
+
     foreach(QString logComponent, logComponentList)
     {
         LogWorker *logWorker = logWorkerMap[logComponent];
-        logWorker->readLog();
+        bool replay = replayComponents.contains(logComponent);
 
-        if(logComponent != "LoadingScreen")
+        if(logComponent != "LoadingScreen" && replay)
+        {
+            connect(logWorker, SIGNAL(newLogLineRead(LogComponent, QString, qint64, qint64)),
+                    this, SLOT(emitNewLogLineRead(LogComponent, QString, qint64, qint64)));
+        }
+
+        if(replay)  logWorker->readLog();
+        else        logWorker->fastForward(std::numeric_limits<qint64>::max());
+
+        if(logComponent != "LoadingScreen" && !replay)
         {
             connect(logWorker, SIGNAL(newLogLineRead(LogComponent, QString, qint64, qint64)),
                     this, SLOT(emitNewLogLineRead(LogComponent, QString, qint64, qint64)));
         }
     }
 
+    finishLogBurst();//Lineas del replay
+
+    emit pDebug("Logs synchronized in " + QString::number(timer.elapsed()) + " ms.");
+    createFileWatcher();
     QTimer::singleShot(updateTime, this, SLOT(sendLogWorker()));
     emit synchronized();
 }
 
 
+//El watcher adelanta la lectura cuando un log crece. Mientras no se vea avisar de lineas nuevas el polling de
+//sendLogWorker sigue con su periodo adaptativo (updateTime); en Windows QFileSystemWatcher no siempre notifica
+//las escrituras de Hearthstone. Una vez avisa, el polling queda de respaldo cada WATCHER_FALLBACK_TIME.
+void LogLoader::createFileWatcher()
+{
+    fileWatcher = new QFileSystemWatcher(this);
+    if(!fileWatcher->addPath(logsDirPath))
+    {
+        emit pDebug("File watcher not available. Polling logs.", DebugLevel::Warning);
+        delete fileWatcher;
+        fileWatcher = nullptr;
+        return;
+    }
+    addLogFilesToWatcher();
+
+    connect(fileWatcher, SIGNAL(fileChanged(QString)),
+            this, SLOT(logFileChanged()));
+    connect(fileWatcher, SIGNAL(directoryChanged(QString)),
+            this, SLOT(logDirChanged()));
+    emit pDebug("File watcher started: " + QString::number(fileWatcher->files().count()) + " logs watched.");
+}
+
+
+void LogLoader::addLogFilesToWatcher()
+{
+    QStringList watchedFiles = fileWatcher->files();
+    foreach(QString logComponent, logComponentList)
+    {
+        QString logPath = logsDirPath + "/" + logComponent + ".log";
+        if(!watchedFiles.contains(logPath) && QFileInfo::exists(logPath))  fileWatcher->addPath(logPath);
+    }
+}
+
+
+void LogLoader::logFileChanged()
+{
+    //Varias notificaciones seguidas (una por log/escritura) se agrupan en una sola lectura
+    if(watcherReadPending)  return;
+    watcherReadPending = true;
+    QTimer::singleShot(WATCHER_COALESCE_TIME, this, SLOT(sendLogWorkerWatcher()));
+}
+
+
+void LogLoader::logDirChanged()
+{
+    //Los logs recreados al reiniciar Hearthstone desaparecen de la lista del watcher
+    addLogFilesToWatcher();
+    logFileChanged();
+}
+
+
+void LogLoader::sendLogWorkerWatcher()
+{
+    watcherReadPending = false;
+    if(readLogWorkers("watcher") && !watcherReliable)
+    {
+        watcherReliable = true;
+        emit pDebug("File watcher notifies log changes. Polling every " + QString::number(WATCHER_FALLBACK_TIME) + " ms.");
+    }
+}
+
+
 void LogLoader::sendLogWorker()
 {
-    foreach(QString logComponent, logComponentList)     logWorkerMap[logComponent]->readLog();
-    processDataLogs();
+    bool linesRead = readLogWorkers("poll");
+
+    //Lineas que no ha avisado el watcher (sin lectura del watcher pendiente): se vuelve al polling adaptativo
+    if(linesRead && watcherReliable && !watcherReadPending)
+    {
+        watcherReliable = false;
+        emit pDebug("File watcher missed log changes. Adaptive polling.", DebugLevel::Warning);
+    }
 
+    if(watcherReliable)
+    {
+        QTimer::singleShot(WATCHER_FALLBACK_TIME, this, SLOT(sendLogWorker()));
+        return;
+    }
+
+    if(linesRead)   updateTime = MIN_UPDATE_TIME;
     QTimer::singleShot(updateTime, this, SLOT(sendLogWorker()));
     if(updateTime < maxUpdateTime)  updateTime += UPDATE_TIME_STEP;
 }
 
 
-void LogLoader::processDataLogs()
+void LogLoader::sendLogWorkerSort()
+{
+    sortReadPending = false;
+    readLogWorkers("sort");
+}
+
+
+//Devuelve si se ha leido alguna linea nueva
+bool LogLoader::readLogWorkers(QString trigger)
+{
+    batchFirstLineTime = -1;
+    newLinesRead = false;
+
+    //Se toma antes de leer: todo lo escrito por Hearthstone hasta (now - LOG_SORT_DELAY) ya estara en los logs leidos
+    qint64 now = unwrapTimeStamp(QTime::currentTime().msecsSinceStartOfDay()*Q_INT64_C(10000));
+    foreach(QString logComponent, logComponentList)     logWorkerMap[logComponent]->readLog();
+
+    //Marca de agua de cada componente: su ultima linea leida, o now - LOG_SORT_DELAY si ha llegado al final del log.
+    //Solo se emiten las lineas por debajo de la menor de todas, ningun log puede traer despues otra anterior.
+    qint64 watermark = now - LOG_SORT_DELAY*Q_INT64_C(10000);
+    qint64 minWatermark = std::numeric_limits<qint64>::max();
+    for(qint64 componentWatermark: dataLogWatermarks)   minWatermark = std::min(minWatermark, std::max(componentWatermark, watermark));
+    processDataLogs(minWatermark);
+
+    //Las lineas retenidas se emiten en cuanto pasa el margen, sin esperar al siguiente poll
+    bool pendingLines = false;
+    for(const QVector<DataLog> &queue: dataLogQueues)   pendingLines = pendingLines || !queue.isEmpty();
+    if(pendingLines && !sortReadPending)
+    {
+        sortReadPending = true;
+        QTimer::singleShot(LOG_SORT_DELAY, this, SLOT(sendLogWorkerSort()));
+    }
+
+    //Latencia linea-->signal: hora actual menos la hora escrita por Hearthstone en la linea mas antigua leida
+    if(batchFirstLineTime != -1)
+    {
+        const int dayMs = 24*60*60*1000;
+        int latency = (QTime::currentTime().msecsSinceStartOfDay() - batchFirstLineTime + dayMs) % dayMs;
+        emit pDebug("Log latency (" + trigger + "): " + QString::number(latency) + " ms.");
+    }
+
+    finishLogBurst();
+    return newLinesRead;
+}
+
+
+//Mezcla k-way de las colas de cada componente: se emite siempre la linea mas antigua de entre las cabezas,
+//hasta watermark incluido. Se recorren en el orden de logComponentList, en caso de empate gana el log que se lee antes.
+void LogLoader::processDataLogs(qint64 watermark)
+{
+    static const LogComponent mergeOrder[] = {logLoadingScreen, logPower, logZone, logArena, logAsset};
+    int heads[logInvalid] = {};
+
+    while(true)
+    {
+        int next = -1;
+        for(LogComponent component: mergeOrder)
+        {
+            const QVector<DataLog> &queue = dataLogQueues[component];
+            if(heads[component] >= queue.size() || queue[heads[component]].timeStamp > watermark)   continue;
+            if(next == -1 || queue[heads[component]].timeStamp < dataLogQueues[next][heads[next]].timeStamp)    next = component;
+        }
+        if(next == -1)  break;
+
+        const DataLog &dataLog = dataLogQueues[next][heads[next]++];
+        emitLogLine(dataLog.logComponent, dataLog.line, dataLog.numLine, dataLog.logSeek);
+    }
+
+    for(int component=0; component<logInvalid; component++)
+    {
+        if(heads[component] > 0)    dataLogQueues[component].remove(0, heads[component]);
+    }
+}
+
+
+//Todas las lineas de una lectura (poll, watcher o sort), ordenadas o no, van entre un unico logBurstStarted/logBurstFinished.
+//GameWatcher las parsea en el hilo del parser y sus signals siguen llegando a los handlers una a una (eventos encolados,
+//en orden); MainWindow pinta una sola vez por lectura al llegar logBurstFinished.
+void LogLoader::emitLogLine(LogComponent logComponent, const QString &line, qint64 numLine, qint64 logSeek)
 {
-    if(dataLogs.isEmpty())  return;
+    if(!burstStarted)
+    {
+        burstStarted = true;
+        emit logBurstStarted();
+    }
+    emit newLogLineRead(logComponent, line, numLine, logSeek);
+}
 
-    QList<qint64> timeStamps = dataLogs.keys();
-    qSort(timeStamps);
 
-    foreach(qint64 timeStamp, timeStamps)
+void LogLoader::finishLogBurst()
+{
+    if(!burstStarted)   return;
+    burstStarted = false;
+    emit logBurstFinished();
+}
+
+
+//timeStamp es la hora del dia. Se le suma un dia cada vez que se pasa la medianoche;
+//una linea atrasada del dia anterior (mas de medio dia por encima del maximo) se queda en su dia.
+qint64 LogLoader::unwrapTimeStamp(qint64 timeStamp)
+{
+    timeStamp += dayOffset;
+    if(timeStamp < maxTimeStamp - LOG_DAY_TICKS/2)
     {
-        DataLog dataLog = dataLogs[timeStamp];
-        emit newLogLineRead(dataLog.logComponent, dataLog.line, dataLog.numLine, dataLog.logSeek);
+        dayOffset += LOG_DAY_TICKS;
+        timeStamp += LOG_DAY_TICKS;
     }
-    dataLogs.clear();
+    else if(timeStamp > maxTimeStamp + LOG_DAY_TICKS/2 && maxTimeStamp != 0)
+    {
+        timeStamp -= LOG_DAY_TICKS;
+    }
+    maxTimeStamp = std::max(maxTimeStamp, timeStamp);
+    return timeStamp;
 }
 
 
@@ -361,34 +637,74 @@ QString LogLoader::getLogsDirPath()
 }
 
 
-void LogLoader::addToDataLogs(LogComponent logComponent, QString line, qint64 numLine, qint64 logSeek)
+//D 10:48:46.1127070 PowerTaskList.DebugPrintPower() - ...
+//Formato fijo "D HH:MM:SS.fffffff ". timeStamp en unidades de 100ns del dia, textPos apunta al texto tras la hora.
+bool LogLoader::parseTimeStamp(const QString &line, qint64 &timeStamp, int &textPos)
 {
-    if(line.contains(QRegularExpression("(\\d+):(\\d+):(\\d+).(\\d+) (.*)"), match))
-    {
-        DataLog dataLog;
-        dataLog.logComponent = logComponent;
-        dataLog.line = match->captured(5);
-        dataLog.numLine = numLine;
-        dataLog.logSeek = logSeek;
+    const int length = line.length();
+    if(length < 13 || line.at(4) != QLatin1Char(':') || line.at(7) != QLatin1Char(':') || line.at(10) != QLatin1Char('.'))  return false;
 
-        qint64 timeStamp = QString(match->captured(1) + match->captured(2) + match->captured(3) + match->captured(4)).toLongLong();
-        while(dataLogs.contains(timeStamp))     timeStamp++;
-        dataLogs[timeStamp] = dataLog;
+    const int digitPos[] = {2, 3, 5, 6, 8, 9};
+    int digits[6];
+    for(int i=0; i<6; i++)
+    {
+        ushort c = line.at(digitPos[i]).unicode();
+        if(c < '0' || c > '9')  return false;
+        digits[i] = c - '0';
     }
-    else
+
+    qint64 fraction = 0;
+    int fractionDigits = 0;
+    int pos = 11;
+    for(; pos < length && line.at(pos) != QLatin1Char(' '); pos++, fractionDigits++)
     {
-        emit pDebug("Log timestamp invalid: " + line, DebugLevel::Error);
-        emit newLogLineRead(logComponent, line, numLine, logSeek);
+        ushort c = line.at(pos).unicode();
+        if(c < '0' || c > '9' || fractionDigits >= 7)   return false;
+        fraction = fraction*10 + (c - '0');
     }
+    if(fractionDigits == 0 || pos >= length)    return false;
+    for(; fractionDigits < 7; fractionDigits++)     fraction *= 10;
+
+    int seconds = ((digits[0]*10 + digits[1])*60 + (digits[2]*10 + digits[3]))*60 + (digits[4]*10 + digits[5]);
+    timeStamp = seconds*Q_INT64_C(10000000) + fraction;
+    textPos = pos + 1;
+    return true;
+}
+
+
+void LogLoader::addToDataLogs(LogComponent logComponent, const QString &line, int textPos, qint64 timeStamp, qint64 numLine, qint64 logSeek)
+{
+    int textLength = line.length() - textPos;
+    if(line.endsWith(QLatin1Char('\n')))    textLength--;
+
+    DataLog dataLog;
+    dataLog.logComponent = logComponent;
+    dataLog.line = line.mid(textPos, textLength);
+    dataLog.numLine = numLine;
+    dataLog.logSeek = logSeek;
+    dataLog.timeStamp = unwrapTimeStamp(timeStamp);
+
+    dataLogQueues[logComponent].append(dataLog);
+    dataLogWatermarks[logComponent] = std::max(dataLogWatermarks[logComponent], dataLog.timeStamp);
 }
 
 
 //LogWorker signal reemit
 void LogLoader::emitNewLogLineRead(LogComponent logComponent, QString line, qint64 numLine, qint64 logSeek)
 {
-    updateTime = MIN_UPDATE_TIME;
-    if(sortLogs)    addToDataLogs(logComponent, line, numLine, logSeek);
-    else            emit newLogLineRead(logComponent, line, numLine, logSeek);
-}
+    newLinesRead = true;
 
+    qint64 timeStamp;
+    int textPos;
+    if(!parseTimeStamp(line, timeStamp, textPos))
+    {
+        emit pDebug("Log timestamp invalid: " + line, DebugLevel::Error);
+        emitLogLine(logComponent, line, numLine, logSeek);
+        return;
+    }
 
+    int lineTime = static_cast<int>(timeStamp/10000);
+    if(batchFirstLineTime == -1 || lineTime < batchFirstLineTime)    batchFirstLineTime = lineTime;
+    if(sortLogs)    addToDataLogs(logComponent, line, textPos, timeStamp, numLine, logSeek);
+    else            emitLogLine(logComponent, line, numLine, logSeek);
+}
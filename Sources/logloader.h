@@ -5,10 +5,16 @@
 #include "logworker.h"
 #include <QObject>
 #include <QTextStream>
+#include <QFileSystemWatcher>
+#include <QVector>
 
 #define MIN_UPDATE_TIME 500
 #define MAX_UPDATE_TIME 2000
 #define UPDATE_TIME_STEP 500
+#define WATCHER_COALESCE_TIME 10
+#define WATCHER_FALLBACK_TIME 10000         //ms. Polling de respaldo cuando el watcher ya ha avisado de un log que crece
+#define LOG_SORT_DELAY 200                  //ms. Una linea solo se emite cuando ningun log puede traer ya otra mas antigua
+#define LOG_DAY_TICKS Q_INT64_C(864000000000)   //Un dia en unidades de 100ns (timeStamp de DataLog)
 
 
 class DataLog
@@ -18,6 +24,7 @@ public:
     QString line;
     qint64 numLine;
     qint64 logSeek;
+    qint64 timeStamp;
 };
 
 
@@ -37,8 +44,16 @@ private:
     QList<QString> logComponentList;
     int updateTime, maxUpdateTime;
     bool sortLogs;
-    QMap<qint64,DataLog> dataLogs;
-    QRegularExpressionMatch *match;
+    QVector<DataLog> dataLogQueues[logInvalid];//Una cola por componente, cada una ya ordenada por hora
+    qint64 dataLogWatermarks[logInvalid];       //timeStamp de la ultima linea leida de cada componente
+    qint64 dayOffset, maxTimeStamp;             //Para que timeStamp siga creciendo al pasar la medianoche
+    bool sortReadPending;
+    QFileSystemWatcher *fileWatcher;
+    bool watcherReadPending;
+    bool watcherReliable;                       //El watcher ha avisado de lineas nuevas y el polling no ha encontrado ninguna sin aviso
+    bool newLinesRead;
+    int batchFirstLineTime;
+    bool burstStarted;                          //logBurstStarted emitido en la lectura actual
 
 //Metodos
 private:
@@ -52,8 +67,15 @@ private:
     void setMaxUpdateTime(int value);
     void createLogWorkers();
     void createLogWorker(QString logComponent);
-    void addToDataLogs(LogComponent logComponent, QString line, qint64 numLine, qint64 logSeek);
-    void processDataLogs();
+    QList<QString> fastForwardLogs();
+    void addToDataLogs(LogComponent logComponent, const QString &line, int textPos, qint64 timeStamp, qint64 numLine, qint64 logSeek);
+    void processDataLogs(qint64 watermark);
+    void emitLogLine(LogComponent logComponent, const QString &line, qint64 numLine, qint64 logSeek);
+    void finishLogBurst();
+    qint64 unwrapTimeStamp(qint64 timeStamp);
+    static bool parseTimeStamp(const QString &line, qint64 &timeStamp, int &textPos);
+    bool readLogWorkers(QString trigger);
+    void addLogFilesToWatcher();
     QString findLinuxLogs(QString pattern);
 
 public:
@@ -64,6 +86,8 @@ public:
 //Signals
 signals:
     void synchronized();
+    void logBurstStarted();
+    void logBurstFinished();
     void logReset();
     void logConfigSet();
     void showMessageProgressBar(QString text);
@@ -80,9 +104,13 @@ private slots:
     void emitNewLogLineRead(LogComponent logComponent, QString line, qint64 numLine, qint64 logSeek);
 
     void sendLogWorker();
-    void sendLogWorkerFirstRun();
+    void sendLogWorkerWatcher();
+    void sendLogWorkerSort();
+    void logFileChanged();
+    void logDirChanged();
 
 public slots:
+    void sendLogWorkerFirstRun();
     void setUpdateTimeMax();
     void setUpdateTimeMin();
     void copyGameLog(qint64 logSeekCreate, qint64 logSeekWon, QString fileName);
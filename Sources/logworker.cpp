@@ -1,5 +1,13 @@
 #include "logworker.h"
 #include <QtWidgets>
+#include <cstring>
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <sys/stat.h>
+#endif
 
 
 LogWorker::LogWorker(QObject *parent, const QString &logsDirPath, const QString &logComponentString) : QObject(parent)
@@ -14,7 +22,7 @@ LogWorker::LogWorker(QObject *parent, const QString &logsDirPath, const QString
 
 LogWorker::~LogWorker()
 {
-
+    logFile.close();
 }
 
 
@@ -49,16 +57,61 @@ void LogWorker::initLogComponent(QString logComponentString)
 
 void LogWorker::reset()
 {
+    //El log se ha recreado, el handle abierto apunta al fichero antiguo
+    logFile.close();
+    logFileId = qMakePair(quint64(0), quint64(0));
     logSeek = 0;
     logNumLine = 0;
     logSize = 0;
 }
 
 
+//Identidad del fichero en disco; (0,0) si no existe
+QPair<quint64, quint64> LogWorker::fileId(const QString &path)
+{
+#ifdef Q_OS_WIN
+    HANDLE handle = CreateFileW(reinterpret_cast<LPCWSTR>(QDir::toNativeSeparators(path).utf16()), 0,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(handle == INVALID_HANDLE_VALUE)  return qMakePair(quint64(0), quint64(0));
+
+    BY_HANDLE_FILE_INFORMATION info;
+    bool ok = GetFileInformationByHandle(handle, &info);
+    CloseHandle(handle);
+    if(!ok)     return qMakePair(quint64(0), quint64(0));
+    return qMakePair(quint64(info.dwVolumeSerialNumber), (quint64(info.nFileIndexHigh) << 32) | info.nFileIndexLow);
+#else
+    struct stat info;
+    if(stat(QFile::encodeName(path).constData(), &info) != 0)  return qMakePair(quint64(0), quint64(0));
+    return qMakePair(quint64(info.st_dev), quint64(info.st_ino));
+#endif
+}
+
+
 bool LogWorker::isLogReset()
 {
     qint64 newSize = QFileInfo (logPath).size();
 
+    //Log recreado: el handle abierto sigue en el fichero antiguo aunque el nuevo ya sea mas grande
+    if(logFileId != qMakePair(quint64(0), quint64(0)))
+    {
+        QPair<quint64, quint64> newFileId = fileId(logPath);
+        if(newFileId == qMakePair(quint64(0), quint64(0)))
+        {
+            //Log borrado (o pendiente de borrar): se suelta el handle para que Hearthstone pueda recrearlo.
+            //logFileId se mantiene para detectar en la siguiente lectura si es un fichero nuevo.
+            logFile.close();
+        }
+        else if(newFileId != logFileId)
+        {
+            emit pDebug("Log " + logComponentString + " reset. File recreated.");
+            emit logReset();
+            reset();
+            logSize = newSize;
+            return true;
+        }
+    }
+
     if(newSize < logSize)
     {
         //Log se ha reiniciado
@@ -75,49 +128,195 @@ bool LogWorker::isLogReset()
 }
 
 
-int LogWorker::readLine(QFile &file, QString &utf8Line)
+bool LogWorker::openLogFile()
 {
-    char c;
-    int lineLength = 0;
-    QByteArray line;
-
-    while(true)
+    if(logFile.isOpen())    return true;
+
+#ifdef Q_OS_WIN
+    //QFile no abre con FILE_SHARE_DELETE y el handle impediria a Hearthstone borrar/recrear el log al reiniciar
+    bool opened = false;
+    HANDLE handle = CreateFileW(reinterpret_cast<LPCWSTR>(QDir::toNativeSeparators(logPath).utf16()), GENERIC_READ,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(handle != INVALID_HANDLE_VALUE)
     {
-        if(!file.getChar(&c))    return -1;
-        line.append(c);
-        lineLength++;
-        if(c == '\n')
+        int fd = _open_osfhandle(reinterpret_cast<intptr_t>(handle), _O_RDONLY | _O_BINARY);
+        if(fd == -1)    CloseHandle(handle);
+        else
         {
-            utf8Line = QString::fromUtf8(line);
-            return lineLength;
+            opened = logFile.open(fd, QIODevice::ReadOnly, QFileDevice::AutoCloseHandle);
+            if(!opened)     _close(fd);
         }
     }
+#else
+    logFile.setFileName(logPath);
+    bool opened = logFile.open(QIODevice::ReadOnly);
+#endif
+    if(!opened)
+    {
+        emit pDebug("Cannot open log " + this->logComponentString, DebugLevel::Error);
+        return false;
+    }
+    logFileId = fileId(logPath);
+    return true;
+}
+
+
+//Emite las lineas completas de data (incluido el '\n', igual que antes) y devuelve los bytes consumidos.
+//Una linea sin '\n' final aun se esta escribiendo, se deja para la siguiente lectura.
+qint64 LogWorker::processLines(const char *data, qint64 size)
+{
+    const char *lineStart = data;
+    const char *end = data + size;
+
+    while(lineStart < end)
+    {
+        const char *lineEnd = static_cast<const char *>(memchr(lineStart, '\n', static_cast<size_t>(end - lineStart)));
+        if(lineEnd == nullptr)  break;
+
+        int lineLength = static_cast<int>(lineEnd - lineStart) + 1;
+        emit newLogLineRead(logComponent, QString::fromUtf8(lineStart, lineLength), ++logNumLine, logSeek);
+        logSeek += lineLength;
+        lineStart = lineEnd + 1;
+    }
+
+    return lineStart - data;
+}
+
+
+void LogWorker::readLogBlocks()
+{
+    logFile.seek(logSeek);
+    readBuffer.truncate(0);
+
+    while(true)
+    {
+        int oldSize = readBuffer.size();
+        readBuffer.resize(oldSize + LOG_READ_BLOCK_SIZE);
+        qint64 bytesRead = logFile.read(readBuffer.data() + oldSize, LOG_READ_BLOCK_SIZE);
+        readBuffer.resize(oldSize + static_cast<int>(std::max(bytesRead, qint64(0))));
+        if(bytesRead <= 0)  break;
+
+        qint64 consumed = processLines(readBuffer.constData(), readBuffer.size());
+        readBuffer.remove(0, static_cast<int>(consumed));
+    }
+
+    //La linea incompleta se vuelve a leer desde logSeek en el siguiente readLog
+    readBuffer.truncate(0);
+}
+
+
+//Sincronizacion inicial de logs grandes: se mapea todo lo pendiente y se trocea sin copias intermedias.
+bool LogWorker::readLogMapped(qint64 size)
+{
+    uchar *data = logFile.map(logSeek, size);
+    if(data == nullptr)     return false;
+
+    processLines(reinterpret_cast<const char *>(data), size);
+    logFile.unmap(data);
+    return true;
 }
 
 
 void LogWorker::readLog()
 {
     isLogReset();
+    if(!openLogFile())  return;
 
-    QFile logFile(logPath);
-    if(!logFile.open(QIODevice::ReadOnly))
+    qint64 pendingSize = logSize - logSeek;
+    if(pendingSize <= 0)    return;
+
+    if(pendingSize < LOG_MAP_MIN_SIZE || !readLogMapped(pendingSize))   readLogBlocks();
+}
+
+
+//Recorre hacia atras las lineas de [fromSeek, EOF) hasta que isTarget acepte una.
+//Devuelve el logSeek del inicio de esa linea o -1. Las lineas se pasan con su '\n'.
+qint64 LogWorker::findLastLine(const std::function<bool(const QByteArray &)> &isTarget, qint64 fromSeek)
+{
+    isLogReset();
+    if(!openLogFile())  return -1;
+
+    qint64 blockEnd = logSize;
+    while(blockEnd > fromSeek)
     {
-        emit pDebug("Cannot open log " + this->logComponentString, DebugLevel::Error);
-        return;
+        qint64 blockStart = std::max(fromSeek, blockEnd - LOG_READ_BLOCK_SIZE);
+        logFile.seek(blockStart);
+        QByteArray block = logFile.read(blockEnd - blockStart);
+        if(block.size() != blockEnd - blockStart)   return -1;
+
+        //La primera linea del bloque puede estar cortada, salvo que el bloque empiece en fromSeek
+        int firstLine = 0;
+        if(blockStart > fromSeek)
+        {
+            int firstNewLine = block.indexOf('\n');
+            if(firstNewLine == -1)  return -1;
+            firstLine = firstNewLine + 1;
+        }
+
+        int lineEnd = block.size();
+        while(lineEnd > firstLine)
+        {
+            int lineStart = (lineEnd >= 2)?(block.lastIndexOf('\n', lineEnd - 2) + 1):0;
+            lineStart = std::max(lineStart, firstLine);
+            if(isTarget(QByteArray::fromRawData(block.constData() + lineStart, lineEnd - lineStart)))
+            {
+                return blockStart + lineStart;
+            }
+            lineEnd = lineStart;
+        }
+        blockEnd = blockStart + firstLine;
     }
+    return -1;
+}
+
+
+//Avanza logSeek hasta seek sin emitir las lineas, solo se cuentan para mantener logNumLine.
+//Si seek no es inicio de linea se queda al principio de la linea cortada.
+void LogWorker::fastForward(qint64 seek)
+{
+    if(seek <= logSeek || !openLogFile())   return;
 
     logFile.seek(logSeek);
+    qint64 newSeek = logSeek;
+    qint64 readSeek = logSeek;
+    while(readSeek < seek)
+    {
+        QByteArray block = logFile.read(std::min(seek - readSeek, qint64(LOG_READ_BLOCK_SIZE)));
+        if(block.isEmpty())     break;
 
-    QString line;
-    int lineLenght;
+        int lastNewLine = block.lastIndexOf('\n');
+        if(lastNewLine != -1)
+        {
+            logNumLine += block.count('\n');
+            newSeek = readSeek + lastNewLine + 1;
+        }
+        readSeek += block.size();
+    }
+
+    emit pDebug("Log " + logComponentString + " fast-forward: " + QString::number(logSeek) + " -> " +
+                QString::number(newSeek) + " (line " + QString::number(logNumLine) + ")");
+    logSeek = newSeek;
+}
 
-    while((lineLenght = readLine(logFile, line)) > 0)
+
+//D 10:48:46.1127070 ... --> milisegundos del dia, -1 si la linea no empieza por la hora
+int LogWorker::lineTime(const QByteArray &line)
+{
+    if(line.size() < 14 || line.at(4) != ':' || line.at(7) != ':' || line.at(10) != '.')  return -1;
+
+    const char *time = line.constData() + 2;
+    const int digits[] = {0, 1, 3, 4, 6, 7, 9, 10, 11};
+    for(int digit: digits)
     {
-        emit newLogLineRead(logComponent, line, ++logNumLine, logSeek);
-        logSeek += lineLenght;
+        if(time[digit] < '0' || time[digit] > '9')  return -1;
     }
 
-    logFile.close();
+    int hours = (time[0]-'0')*10 + (time[1]-'0');
+    int minutes = (time[3]-'0')*10 + (time[4]-'0');
+    int seconds = (time[6]-'0')*10 + (time[7]-'0');
+    int millis = (time[9]-'0')*100 + (time[10]-'0')*10 + (time[11]-'0');
+    return ((hours*60 + minutes)*60 + seconds)*1000 + millis;
 }
 
 
@@ -4,6 +4,11 @@
 #include "utility.h"
 #include <QObject>
 #include <QFile>
+#include <QPair>
+#include <functional>
+
+#define LOG_READ_BLOCK_SIZE (1024*1024)
+#define LOG_MAP_MIN_SIZE (16*1024*1024)
 
 class LogWorker : public QObject
 {
@@ -17,21 +22,31 @@ private:
     qint64 logSeek, logNumLine, logSize;
     QString logPath, logComponentString;
     LogComponent logComponent;
+    QFile logFile;
+    QPair<quint64, quint64> logFileId;     //Identidad (volumen/dispositivo, indice/inodo) del fichero abierto en logFile
+    QByteArray readBuffer;
 
 
 //Metodos
 private:
     void doCopyGameLog(qint64 logSeekCreate, qint64 logSeekWon, QString fileName);
-    int readLine(QFile &file, QString &utf8Line);
+    bool openLogFile();
+    qint64 processLines(const char *data, qint64 size);
+    void readLogBlocks();
+    bool readLogMapped(qint64 size);
     bool isLogReset();
     void reset();
     void initLogComponent(QString logComponentString);
+    static QPair<quint64, quint64> fileId(const QString &path);
 
 public:
     void readLog();
+    qint64 findLastLine(const std::function<bool(const QByteArray &)> &isTarget, qint64 fromSeek=0);
+    void fastForward(qint64 seek);
     void copyGameLog(qint64 logSeekCreate, qint64 logSeekWon, QString fileName);
 
     static void setCopyGameLogs(bool value);
+    static int lineTime(const QByteArray &line);
 
 signals:
     void logReset();
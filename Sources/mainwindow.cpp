@@ -5,6 +5,7 @@
 #include "Widgets/cardwindow.h"
 #include "versionchecker.h"
 #include "themehandler.h"
+#include "Utils/pixmapcache.h"
 #include <QtConcurrent/QtConcurrent>
 #include <QtWidgets>
 
@@ -15,12 +16,15 @@ MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent, Qt::FramelessWindowHint|Qt::WindowStaysOnTopHint),
     ui(new Ui::Extended)
 {
+    startupTimer.start();
     QFontDatabase::addApplicationFont(":Fonts/hsFont.ttf");
     QFontDatabase::addApplicationFont(":Fonts/LuckiestGuy.ttf");
 
     ui->setupUi(this);
 
-    atLogFile = nullptr;
+    cardDB = new CardDB();
+    logSink = nullptr;
+    atLogPath = "";
     mouseInApp = false;
     deckWindow = nullptr;
     arenaWindow = nullptr;
@@ -30,10 +34,12 @@ MainWindow::MainWindow(QWidget *parent) :
     planWindow = nullptr;
     copyGameLogs = false;
     draftLogFile = "";
+    logsDirPath = "";
     cardHeight = -1;
 
     logLoader = nullptr;
     gameWatcher = nullptr;
+    parserThread = nullptr;
     arenaHandler = nullptr;
     cardDownloader = nullptr;
     enemyHandHandler = nullptr;
@@ -88,6 +94,11 @@ MainWindow::~MainWindow()
 {
     if(networkManager != nullptr)      delete networkManager;
     if(premiumHandler != nullptr)      delete premiumHandler;
+    if(parserThread != nullptr)
+    {
+        parserThread->quit();
+        parserThread->wait();
+    }
     if(logLoader != nullptr)           delete logLoader;
     if(gameWatcher != nullptr)         delete gameWatcher;
     if(arenaHandler != nullptr)        delete arenaHandler;
@@ -100,6 +111,8 @@ MainWindow::~MainWindow()
     if(secretsHandler != nullptr)      delete secretsHandler;
     if(trackobotUploader != nullptr)   delete trackobotUploader;
     if(ui != nullptr)                  delete ui;
+    Utility::setCardDB(nullptr);
+    delete cardDB;
     closeLogFile();
     QFontDatabase::removeAllApplicationFonts();
 }
@@ -107,6 +120,7 @@ MainWindow::~MainWindow()
 
 void MainWindow::init()
 {
+    emit pDebug("Startup: Ready in " + QString::number(startupTimer.elapsed()) + " ms.");
     spreadTransparency();
     trackobotUploader->checkAccount();
 //    downloadAllArenaCodes();  //Connect en completeUI
@@ -209,15 +223,8 @@ void MainWindow::closedDetachWindow(DetachWindow *detachWindow, QWidget *paneWid
 }
 
 
-void MainWindow::resetDeckDontRead()
-{
-    resetDeck(true);
-}
-
-
-void MainWindow::resetDeck(bool deckRead)
+void MainWindow::resetDeck()
 {
-    gameWatcher->setDeckRead(deckRead);
     deckHandler->reset();
 }
 
@@ -303,18 +310,49 @@ void MainWindow::createCardsJsonMap(QByteArray &jsonData)
 {
     emit pDebug("Create Json Map.");
 
+    QElapsedTimer timer;
+    timer.start();
     QJsonDocument jsonDoc = QJsonDocument::fromJson(jsonData);
-    QJsonArray jsonArray = jsonDoc.array();
-    foreach(QJsonValue jsonCard, jsonArray)
+
+    //La nueva CardDB se construye aparte y se publica entera; el hilo del parser puede estar leyendo la anterior
+    CardDB *newCardDB = new CardDB();
+    newCardDB->setLocalLang(Utility::getLocalLang());
+    newCardDB->load(jsonDoc.array());
+    CardDB *oldCardDB = cardDB;
+    cardDB = newCardDB;
+    Utility::setCardDB(cardDB);
+    releaseCardDB(oldCardDB);
+    emit pDebug("Card DB: " + QString::number(cardDB->count()) + " cards parsed from cards.json in " +
+                QString::number(timer.elapsed()) + " ms (" + QString::number(startupTimer.elapsed()) + " ms after start).");
+
+    //Cache para los siguientes arranques con la misma version de cards.json
+    QSettings settings("Arena Tracker", "Arena Tracker");
+    QString cardsJsonVersion = settings.value("cardsJsonVersion", "").toString();
+    if(USE_CARDS_CACHE && !cardDB->saveCache(Utility::extraPath() + "/" + CARDS_CACHE_FILE, cardsJsonVersion))
     {
-        QJsonObject jsonCardObject = jsonCard.toObject();
-        cardsJson[jsonCardObject.value("id").toString()] = jsonCardObject;
+        emit pDebug("Card DB: Failed to write cache.", Warning);
     }
 
     emit cardsJsonReady();
 }
 
 
+//El hilo del parser puede estar leyendo la CardDB sustituida: se le entrega para que la borre
+//despues de la linea que este parseando. Sin hilo del parser nadie mas la usa.
+void MainWindow::releaseCardDB(CardDB *oldCardDB)
+{
+    if(oldCardDB == nullptr)    return;
+    if(parserThread == nullptr || gameWatcher == nullptr)
+    {
+        delete oldCardDB;
+        return;
+    }
+
+    qRegisterMetaType<CardDB *>("CardDB*");
+    QMetaObject::invokeMethod(gameWatcher, "deleteCardDB", Qt::QueuedConnection, Q_ARG(CardDB*, oldCardDB));
+}
+
+
 void MainWindow::replyFinished(QNetworkReply *reply)
 {
     reply->deleteLater();
@@ -475,10 +513,24 @@ void MainWindow::setLocalLang()
 
 void MainWindow::initCardsJson()
 {
-    Utility::setCardsJson(&cardsJson);
+    cardDB->setLocalLang(Utility::getLocalLang());
+    Utility::setCardDB(cardDB);
     networkManager->get(QNetworkRequest(QUrl(JSON_CARDS_URL)));
     emit pDebug("Extra: Json Cards --> Trying: " + QString(JSON_CARDS_URL));
 
+    //Cache binaria de la version guardada, evita leer y parsear cards.json
+    QElapsedTimer timer;
+    timer.start();
+    QSettings settings("Arena Tracker", "Arena Tracker");
+    QString cardsJsonVersion = settings.value("cardsJsonVersion", "").toString();
+    if(USE_CARDS_CACHE && cardDB->loadCache(Utility::extraPath() + "/" + CARDS_CACHE_FILE, cardsJsonVersion))
+    {
+        emit pDebug("Card DB: " + QString::number(cardDB->count()) + " cards loaded from cache in " +
+                    QString::number(timer.elapsed()) + " ms (" + QString::number(startupTimer.elapsed()) + " ms after start).");
+        emit cardsJsonReady();
+        return;
+    }
+
     //Load local cards.json (Incluso aunque haya una version nueva para bajar)
     QFile cardsJsonFile(Utility::extraPath() + "/cards.json");
     if(cardsJsonFile.exists())
@@ -923,10 +975,10 @@ void MainWindow::createCardDownloader()
 
 void MainWindow::createGameWatcher()
 {
-    gameWatcher = new GameWatcher(this);
+    gameWatcher = new GameWatcher();//Sin padre, se mueve a parserThread
 
     connect(gameWatcher, SIGNAL(newArena(QString)),
-            this, SLOT(resetDeckDontRead()));
+            this, SLOT(resetDeck()));
     connect(gameWatcher, SIGNAL(needResetDeck()),
             this, SLOT(resetDeck()));
     connect(gameWatcher, SIGNAL(arenaDeckRead()),
@@ -1050,16 +1102,16 @@ void MainWindow::createGameWatcher()
             planHandler, SLOT(playerMinionPosChange(int,int)));
     connect(gameWatcher, SIGNAL(enemyMinionPosChange(int,int)),
             planHandler, SLOT(enemyMinionPosChange(int,int)));
-    connect(gameWatcher, SIGNAL(playerBoardTagChange(int,QString,QString,QString)),
-            planHandler, SLOT(playerBoardTagChange(int,QString,QString,QString)));
-    connect(gameWatcher, SIGNAL(enemyBoardTagChange(int,QString,QString,QString)),
-            planHandler, SLOT(enemyBoardTagChange(int,QString,QString,QString)));
-    connect(gameWatcher, SIGNAL(unknownTagChange(QString,QString)),
-            planHandler, SLOT(unknownTagChange(QString,QString)));
-    connect(gameWatcher, SIGNAL(playerTagChange(QString,QString)),
-            planHandler, SLOT(playerTagChange(QString,QString)));
-    connect(gameWatcher, SIGNAL(enemyTagChange(QString,QString)),
-            planHandler, SLOT(enemyTagChange(QString,QString)));
+    connect(gameWatcher, SIGNAL(playerBoardTagChange(int,QString,PowerTag,int)),
+            planHandler, SLOT(playerBoardTagChange(int,QString,PowerTag,int)));
+    connect(gameWatcher, SIGNAL(enemyBoardTagChange(int,QString,PowerTag,int)),
+            planHandler, SLOT(enemyBoardTagChange(int,QString,PowerTag,int)));
+    connect(gameWatcher, SIGNAL(unknownTagChange(PowerTag,int)),
+            planHandler, SLOT(unknownTagChange(PowerTag,int)));
+    connect(gameWatcher, SIGNAL(playerTagChange(PowerTag,int)),
+            planHandler, SLOT(playerTagChange(PowerTag,int)));
+    connect(gameWatcher, SIGNAL(enemyTagChange(PowerTag,int)),
+            planHandler, SLOT(enemyTagChange(PowerTag,int)));
     connect(gameWatcher, SIGNAL(zonePlayAttack(QString, int,int)),
             planHandler, SLOT(zonePlayAttack(QString, int,int)));
     connect(gameWatcher, SIGNAL(playerSecretPlayed(int,QString)),
@@ -1159,6 +1211,12 @@ void MainWindow::createLogLoader()
     logLoader = new LogLoader(this);
     connect(logLoader, SIGNAL(logReset()),
             this, SLOT(logReset()));
+    connect(logLoader, SIGNAL(logReset()),
+            gameWatcher, SLOT(reset()));
+    connect(logLoader, SIGNAL(logBurstStarted()),
+            this, SLOT(suspendLogRepaints()));
+    connect(logLoader, SIGNAL(logBurstFinished()),
+            this, SLOT(resumeLogRepaints()));
     connect(logLoader, SIGNAL(newLogLineRead(LogComponent, QString,qint64,qint64)),
             gameWatcher, SLOT(processLogLine(LogComponent, QString,qint64,qint64)));
     connect(logLoader, SIGNAL(logConfigSet()),
@@ -1179,6 +1237,61 @@ void MainWindow::createLogLoader()
             logLoader, SLOT(setUpdateTimeMin()));
 
     if(!logLoader->init())  QTimer::singleShot(1, this, SLOT(closeApp()));
+    else
+    {
+        //logLoader pasa al hilo del parser, su ruta se guarda aqui para no leerla desde el hilo de GUI
+        logsDirPath = logLoader->getLogsDirPath();
+        createParserThread();
+    }
+}
+
+
+//LogLoader (con sus LogWorkers) y GameWatcher leen y parsean los logs en su propio hilo.
+//Sus signals llegan a los handlers como eventos encolados, por eso los tipos propios se registran aqui.
+void MainWindow::createParserThread()
+{
+    qRegisterMetaType<DebugLevel>("DebugLevel");
+    qRegisterMetaType<LoadingScreenState>("LoadingScreenState");
+    qRegisterMetaType<CardClass>("CardClass");
+    qRegisterMetaType<PowerTag>("PowerTag");
+    qRegisterMetaType<GameResult>("GameResult");
+
+    //moveToThread no admite objetos con padre. LogLoader lo ha usado para sus dialogos en init().
+    logLoader->setParent(nullptr);
+
+    parserThread = new QThread(this);
+    logLoader->moveToThread(parserThread);
+    gameWatcher->moveToThread(parserThread);
+
+    //Queued: las llamadas encoladas antes de arrancar (setCopyGameLogs) se procesan antes de la primera lectura
+    connect(parserThread, SIGNAL(started()),
+            logLoader, SLOT(sendLogWorkerFirstRun()), Qt::QueuedConnection);
+    QTimer::singleShot(1, parserThread, SLOT(start())); //Retraso para dejar que la aplicacion se pinte y se conecten todos los handlers.
+}
+
+
+//Las signals de GameWatcher siguen cruzando al hilo de GUI una a una (eventos encolados, en orden), no se agrupan
+//en un lote de eventos: cada una tiene sus propios receptores en los handlers. Lo que se agrupa por lectura de logs
+//(LogLoader::readLogWorkers) es el repintado: se suspende en logBurstStarted y se pinta una sola vez en logBurstFinished.
+void MainWindow::suspendLogRepaints()
+{
+    setLogRepaintsEnabled(false);
+}
+
+
+void MainWindow::resumeLogRepaints()
+{
+    setLogRepaintsEnabled(true);
+}
+
+
+void MainWindow::setLogRepaintsEnabled(bool enabled)
+{
+    QList<QWidget *> widgets = {ui->tabWidget, deckWindow, arenaWindow, enemyWindow, enemyDeckWindow, graveyardWindow, planWindow};
+    for(QWidget *widget: widgets)
+    {
+        if(widget != nullptr)   widget->setUpdatesEnabled(enabled);
+    }
 }
 
 
@@ -1684,6 +1797,7 @@ void MainWindow::closeEvent(QCloseEvent *event)
         planWindow->close();
         planWindow = nullptr;
     }
+    if(logSink != nullptr)  logSink->flush();
     event->accept();
 }
 
@@ -2098,8 +2212,8 @@ void MainWindow::removeNonCompleteDraft()
             return;
         }
 
-        QDir dir(Utility::gameslogPath());
-        dir.remove(draftLogFile);
+        //Se borra desde LogSink, despues de las lineas que tenga pendientes
+        if(logSink != nullptr)  logSink->remove(Utility::gameslogPath() + "/" + draftLogFile);
         pDebug("Remove non-complete draft: " + draftLogFile);
         draftLogFile = "";
     }
@@ -2112,7 +2226,8 @@ void MainWindow::checkDraftLogLine(QString logLine, QString file)
     if(file == "DraftHandler")
     {
         QRegularExpressionMatch match;
-        if(logLine.contains(QRegularExpression("DraftHandler: Begin draft\\. Heroe: (\\d+)"), &match))
+        static const QRegularExpression beginDraftRe("DraftHandler: Begin draft\\. Heroe: (\\d+)");
+        if(logLine.contains(beginDraftRe, &match))
         {
             //Check dir
             QFileInfo dir(Utility::gameslogPath());
@@ -2129,17 +2244,10 @@ void MainWindow::checkDraftLogLine(QString logLine, QString file)
             QString playerHero = Utility::heroStringFromLogNumber(match.captured(1));
             QString fileName = "DRAFT " + timeStamp + " " + playerHero + ".arenatracker";
 
-            QFile logDraft(Utility::gameslogPath() + "/" + fileName);
-            if(!logDraft.open(QIODevice::WriteOnly | QIODevice::Text))
-            {
-                pDebug("Cannot create draft log file...", DebugLevel::Error);
-                pLog(tr("Log: ERROR:Cannot create draft log file..."));
-                return;
-            }
-
-            QTextStream stream(&logDraft);
-            stream << logLine << endl;
-            logDraft.close();
+            //Se encola detras del borrado del draft anterior; remove deja el fichero nuevo vacio aunque ya existiera
+            if(logSink == nullptr)  return;
+            logSink->remove(Utility::gameslogPath() + "/" + fileName);
+            logSink->write(Utility::gameslogPath() + "/" + fileName, logLine);
 
             pDebug("Start DraftLog: " + fileName);
             draftLogFile = fileName;
@@ -2166,22 +2274,13 @@ void MainWindow::checkDraftLogLine(QString logLine, QString file)
             }
         }
 
-        if(copyLogLine)
+        if(copyLogLine && logSink != nullptr)
         {
-            QFile logDraft(Utility::gameslogPath() + "/" + draftLogFile);
-            if(!logDraft.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
-            {
-                pDebug("Cannot open draft log file...", DebugLevel::Error);
-                pLog(tr("Log: ERROR:Cannot open draft log file..."));
-                return;
-            }
-
-            QTextStream stream(&logDraft);
-            stream << logLine << endl;
-            logDraft.close();
+            logSink->write(Utility::gameslogPath() + "/" + draftLogFile, logLine);
         }
         if(endDraftLog)
         {
+            if(logSink != nullptr)  logSink->close(Utility::gameslogPath() + "/" + draftLogFile);
             pDebug("End DraftLog: " + draftLogFile);
             if(arenaHandler != nullptr)    arenaHandler->linkDraftLogToArenaCurrent(draftLogFile);
             draftLogFile = "";
@@ -2196,9 +2295,13 @@ void MainWindow::pDebug(QString line, DebugLevel debugLevel, QString file)
 }
 
 
+//Con el nivel desactivado no se formatea la linea, salvo las de DraftHandler que se copian al log del draft.
 void MainWindow::pDebug(QString line, qint64 numLine, DebugLevel debugLevel, QString file)
 {
-    (void)debugLevel;
+    bool draftLine = copyGameLogs && file == "DraftHandler";
+    bool levelEnabled = LogSink::isEnabled(debugLevel);
+    if(!levelEnabled && !draftLine)     return;
+
     QString logLine = "";
     QString timeStamp = QDateTime::currentDateTime().toString("hh:mm:ss");
 
@@ -2215,15 +2318,17 @@ void MainWindow::pDebug(QString line, qint64 numLine, DebugLevel debugLevel, QSt
         logLine += ": " + line;
     }
 
-    qDebug().noquote() << logLine;
-
-    if(atLogFile != nullptr)
+    if(levelEnabled)
     {
-        QTextStream stream(atLogFile);
-        stream << logLine << endl;
+        qDebug().noquote() << logLine;
+        if(logSink != nullptr && !atLogPath.isEmpty())
+        {
+            logSink->write(atLogPath, logLine);
+            if(debugLevel == Error)     logSink->requestFlush();//Se escribe ya, sin esperar al resto del lote
+        }
     }
 
-    if(copyGameLogs)    checkDraftLogLine(logLine, file);
+    if(draftLine)   checkDraftLogLine(logLine, file);
 }
 
 
@@ -2238,7 +2343,6 @@ void MainWindow::logReset()
     deckHandler->unlockDeckInterface();
     deckHandler->leaveArena();
     enemyHandHandler->unlockEnemyInterface();
-    gameWatcher->reset();
 }
 
 
@@ -2260,6 +2364,7 @@ bool MainWindow::checkCardImage(QString code, bool isHero)
 
 void MainWindow::redrawDownloadedCardImage(QString code)
 {
+    PixmapCache::removeCard(code);
     deckHandler->redrawDownloadedCardImage(code);
     enemyDeckHandler->redrawDownloadedCardImage(code);
     graveyardHandler->redrawDownloadedCardImage(code);
@@ -2308,25 +2413,38 @@ void MainWindow::resetSettings()
 }
 
 
+//El log se crea vacio aqui; las lineas las escribe LogSink en su hilo.
+//logLevel (QSettings) es el DebugLevel minimo que se registra.
 void MainWindow::createLogFile()
 {
-    atLogFile = new QFile(Utility::dataPath() + "/ArenaTrackerLog.txt");
-    if(atLogFile->exists())  atLogFile->remove();
-    if(!atLogFile->open(QIODevice::WriteOnly | QIODevice::Text))
+    QSettings settings("Arena Tracker", "Arena Tracker");
+    LogSink::setMinLevel(static_cast<DebugLevel>(settings.value("logLevel", Normal).toInt()));
+
+    logSink = new LogSink();
+    logSink->start(QThread::LowPriority);
+
+    QFile atLogFile(Utility::dataPath() + "/ArenaTrackerLog.txt");
+    if(atLogFile.exists())  atLogFile.remove();
+    if(!atLogFile.open(QIODevice::WriteOnly | QIODevice::Text))
     {
+        atLogPath = "";
         pDebug("Failed to create Arena Tracker log on disk.", DebugLevel::Error);
         pLog(tr("File: ERROR: Failed to create Arena Tracker log on disk."));
-        atLogFile = nullptr;
+        return;
     }
+    atLogFile.close();
+    atLogPath = atLogFile.fileName();
 }
 
 
+//Espera a que LogSink escriba lo pendiente y cierre los ficheros
 void MainWindow::closeLogFile()
 {
-    if(atLogFile == nullptr)   return;
-    atLogFile->close();
-    delete atLogFile;
-    atLogFile = nullptr;
+    if(logSink == nullptr)  return;
+    logSink->stop();
+    logSink->wait();
+    delete logSink;
+    logSink = nullptr;
 }
 
 
@@ -2979,6 +3097,7 @@ void MainWindow::redrawAllGames()
 
 void MainWindow::spreadTheme(bool redrawAllGames)
 {
+    PixmapCache::clear();
     updateMainUITheme();
     updateTabIcons();
     arenaHandler->setTheme();
@@ -3476,7 +3595,7 @@ void MainWindow::updateMaxGamesLog(int value)
     {
         copyGameLogs = true;
     }
-    gameWatcher->setCopyGameLogs(copyGameLogs);
+    QMetaObject::invokeMethod(gameWatcher, "setCopyGameLogs", Qt::QueuedConnection, Q_ARG(bool, copyGameLogs));
 
     QString labelText;
     if(value == 100)
@@ -3592,13 +3711,6 @@ int MainWindow::getScreenHighest()
 }
 
 
-LoadingScreenState MainWindow::getLoadingScreen()
-{
-    if(gameWatcher != nullptr) return gameWatcher->getLoadingScreen();
-    else                    return menu;
-}
-
-
 void MainWindow::createDebugPack()
 {
     QString timeStamp = QDateTime::currentDateTime().toString("MMMM-d hh-mm-ss");
@@ -3624,7 +3736,7 @@ void MainWindow::createDebugPack()
     QFile atLog(Utility::dataPath() + "/ArenaTrackerLog.txt");
     atLog.copy(dirPath + "/ArenaTrackerLog.txt");
 
-    QString hsLogsPath = logLoader->getLogsDirPath();
+    QString hsLogsPath = logsDirPath;
     QFile arenaLog(hsLogsPath + "/Arena.log");
     arenaLog.copy(dirPath + "/Arena.log");
     QFile loadingScreenLog(hsLogsPath + "/LoadingScreen.log");
@@ -3813,7 +3925,7 @@ void MainWindow::downloadAllArenaCodes()
                 allCardsDownloadList.append(code);
             }
             //Solo bajamos golden cards de cartas colleccionables
-            if(Utility::getCardAttribute(code, "collectible").toBool() && !checkCardImage(code + "_premium"))
+            if(Utility::isCollectible(code) && !checkCardImage(code + "_premium"))
             {
                 allCardsDownloadList.append(code + "_premium");
             }
@@ -3957,11 +4069,11 @@ void MainWindow::testPlan()
     planHandler->zonePlayAttack("AT_003",12,11);
     planHandler->zonePlayAttack("AT_003",12,11);
     planHandler->setLastTriggerId("", "FATIGUE", 0, 0);
-    planHandler->playerBoardTagChange(11, "", "DAMAGE", "1");
+    planHandler->playerBoardTagChange(11, "", PT_DAMAGE, 1);
     planHandler->enemyCardObjPlayed("EX1_020", 4, 1);
     planHandler->setLastTriggerId("CS2_034", "TRIGGER", 134, -1);
-    planHandler->playerBoardTagChange(1, "","DAMAGE", "1");
-//    planHandler->playerMinionTagChange(93, "BRM_027h", "LINKED_ENTITY", "11");
+    planHandler->playerBoardTagChange(1, "", PT_DAMAGE, 1);
+//    planHandler->playerMinionTagChange(93, "BRM_027h", PT_LINKED_ENTITY, 11);
     planHandler->playerMinionZonePlayRemove(1);
     planHandler->playerMinionZonePlayRemove(3);
     planHandler->enemyCardDraw(22, "AT_003", "",2);
@@ -4007,9 +4119,259 @@ void MainWindow::testTierlists()
 }
 
 
+//Reproduce el Power.log capturado a traves de GameWatcher::processLogLine y mide lineas/segundo.
+//El GameWatcher de prueba no esta conectado a ningun handler, solo se mide el parseo.
+//Lineas de Power de una partida de ejemplo, se usan para generar Power.log sinteticos
+QByteArray MainWindow::benchmarkPowerLogBlock()
+{
+    return
+        "D 10:48:40.1127070 GameState.DebugPrintPower() - CREATE_GAME\n"
+        "D 10:48:41.1127070 PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=GameEntity tag=TURN value=3\n"
+        "D 10:48:42.1127070 PowerTaskList.DebugPrintPower() - BLOCK_START BlockType=ATTACK Entity=[entityName=Jinete de lobos id=45 zone=PLAY zonePos=1 cardId=CS2_124 player=2] "
+            "EffectCardId= EffectIndex=-1 Target=[entityName=Jaina Valiente id=64 zone=PLAY zonePos=0 cardId=HERO_08 player=1]\n"
+        "D 10:48:43.1127070 PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=[entityName=Despota del templo id=36 zone=PLAY zonePos=1 cardId=EX1_623 player=2] tag=DAMAGE value=2\n"
+        "D 10:48:44.1127070 PowerTaskList.DebugPrintPower() -     SHOW_ENTITY - Updating Entity=[entityName=UNKNOWN ENTITY [cardType=INVALID] id=58 zone=HAND zonePos=3 cardId= player=2] CardID=EX1_011\n"
+        "D 10:48:45.1127070 PowerTaskList.DebugPrintPower() -         tag=HEALTH value=1\n"
+        "D 10:48:46.1127070 PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=SerKolobok tag=RESOURCES value=3\n"
+        "D 10:48:47.1127070 GameState.DebugPrintOptions() - id=3\n"
+        "D 10:48:48.1127070 PowerTaskList.DebugPrintPower() -     TAG_CHANGE Entity=SerKolobok tag=PLAYSTATE value=WON\n";
+}
+
+
+//Cadena de patrones de Power tal como estaba antes de LogPatterns, en el mismo orden de los if/else.
+QStringList MainWindow::benchmarkBasePowerPatterns()
+{
+    return QStringList()
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE Entity=(.+) tag=PLAYSTATE value=(WON|TIED)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE Entity=GameEntity tag=TURN value=(\\d+)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *tag=(\\w+) value=(\\w+)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE Entity=(.*) tag=(\\w+) value=(\\w+)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE Entity=\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=(\\d+)\\] tag=(\\w+) value=(\\w+)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *TAG_CHANGE Entity=\\[entityName=(.*) id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=(\\w*) player=(\\d+)\\] tag=(\\w+) value=(\\w+)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - BLOCK_START BlockType=(\\w+) Entity=\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=\\d+\\] EffectCardId=\\w* EffectIndex=-?\\d+ Target="
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *SHOW_ENTITY - Updating Entity=\\[entityName=.* id=(\\d+) zone=\\w+ zonePos=\\d+ cardId=\\w* player=(\\d+)\\] CardID=\\w+"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *SHOW_ENTITY - Updating Entity=\\[entityName=UNKNOWN ENTITY \\[cardType=INVALID\\] id=(\\d+) zone=\\w+ zonePos=\\d+ cardId= player=(\\d+)\\] CardID=\\w+"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *FULL_ENTITY - Updating \\[entityName=.* id=(\\d+) zone=\\w+ zonePos=\\d+ cardId=\\w* player=(\\d+)\\] CardID=\\w+"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - *CHANGE_ENTITY - Updating Entity=\\[entityName=.* id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=\\w* player=(\\d+)\\] CardID=(\\w+)"
+        << "PowerTaskList\\.DebugPrintPower\\(\\) - BLOCK_START BlockType=(\\w+) Entity=\\[entityName=(.*) id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=(\\w+) player=(\\d+)\\] EffectCardId=\\w* EffectIndex=-?\\d+ Target=(?:\\[entityName=(.*) id=(\\d+) zone=(\\w+) zonePos=\\d+ cardId=(\\w+) player=\\d+\\])?";
+}
+
+
+//Compara sobre las mismas lineas el camino anterior (un QRegularExpression nuevo por patron y linea, sin filtro
+//de literales) con GameWatcher::processLogLine actual. Usa Power.log si existe o uno sintetico.
+//El camino anterior solo mide los regex, sin el resto de GameWatcher, asi que la mejora real es mayor.
+void MainWindow::testPowerLogBenchmark()
+{
+    QList<QString> lines;
+    QString logPath = logsDirPath + "/Power.log";
+    QFile logFile(logPath);
+    if(logFile.open(QIODevice::ReadOnly))
+    {
+        while(!logFile.atEnd())     lines.append(QString::fromUtf8(logFile.readLine()));
+        logFile.close();
+    }
+    else
+    {
+        logPath = "synthetic";
+        QStringList blockLines = QString::fromUtf8(benchmarkPowerLogBlock()).split('\n', QString::SkipEmptyParts);
+        while(lines.count() < 200000)   lines.append(blockLines);
+    }
+
+    //Antes
+    const QStringList basePatterns = benchmarkBasePowerPatterns();
+    QRegularExpressionMatch match;
+    int baseMatches = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for(const QString &line: lines)
+    {
+        for(const QString &pattern: basePatterns)
+        {
+            if(line.contains(QRegularExpression(pattern), &match))
+            {
+                baseMatches++;
+                break;
+            }
+        }
+    }
+    qint64 baseMs = std::max(timer.elapsed(), qint64(1));
+
+    //Ahora
+    GameWatcher benchWatcher;
+    benchWatcher.setCopyGameLogs(false);
+    qint64 numLine = 0;
+    qint64 logSeek = 0;
+
+    timer.restart();
+    for(const QString &line: lines)
+    {
+        benchWatcher.processLogLine(logPower, line, ++numLine, logSeek);
+        logSeek += line.length();
+    }
+    qint64 elapsedMs = std::max(timer.elapsed(), qint64(1));
+
+    pDebug("Benchmark: Power.log (" + logPath + ") " + QString::number(lines.count()) + " lines --> Before: " +
+           QString::number(baseMs) + " ms (" + QString::number(lines.count()*1000.0/baseMs, 'f', 0) + " lines/sec, " +
+           QString::number(baseMatches) + " matches) - After: " +
+           QString::number(elapsedMs) + " ms (" + QString::number(lines.count()*1000.0/elapsedMs, 'f', 0) + " lines/sec) - x" +
+           QString::number(static_cast<double>(baseMs)/elapsedMs, 'f', 1));
+}
+
+
+void MainWindow::testLogSyncBenchmark()
+{
+    //Power.log sintetico de ~200MB con una partida repetida
+    QTemporaryDir benchDir;
+    if(!benchDir.isValid())
+    {
+        pDebug("Benchmark: Cannot create temp dir.", DebugLevel::Error);
+        return;
+    }
+
+    QFile logFile(benchDir.path() + "/Power.log");
+    if(!logFile.open(QIODevice::WriteOnly))
+    {
+        pDebug("Benchmark: Cannot create " + logFile.fileName(), DebugLevel::Error);
+        return;
+    }
+
+    QByteArray gameBlock = benchmarkPowerLogBlock();
+    const qint64 benchLogSize = 200*1024*1024;
+    qint64 logSize = 0;
+    while(logSize < benchLogSize)   logSize += logFile.write(gameBlock);
+    logFile.close();
+    double sizeMB = logSize/(1024.0*1024.0);
+
+    //Solo lectura
+    QElapsedTimer timer;
+    timer.start();
+    LogWorker readWorker(nullptr, benchDir.path(), "Power");
+    readWorker.readLog();
+    qint64 readMs = std::max(timer.elapsed(), qint64(1));
+
+    //Lectura + GameWatcher, equivalente a la sincronizacion inicial
+    GameWatcher benchWatcher;
+    benchWatcher.setCopyGameLogs(false);
+    LogWorker syncWorker(nullptr, benchDir.path(), "Power");
+    connect(&syncWorker, SIGNAL(newLogLineRead(LogComponent, QString, qint64, qint64)),
+            &benchWatcher, SLOT(processLogLine(LogComponent, QString, qint64, qint64)));
+    timer.restart();
+    syncWorker.readLog();
+    qint64 syncMs = std::max(timer.elapsed(), qint64(1));
+
+    pDebug("Benchmark: Synthetic Power.log " + QString::number(sizeMB, 'f', 0) + " MB --> Read: " +
+           QString::number(readMs) + " ms (" + QString::number(sizeMB*1000/readMs, 'f', 0) + " MB/s) - Sync: " +
+           QString::number(syncMs) + " ms (" + QString::number(sizeMB*1000/syncMs, 'f', 0) + " MB/s)");
+}
+
+
+//Arranque de CardDB sin cache (leer y parsear cards.json, lo que hace initCardsJson con USE_CARDS_CACHE false)
+//frente a cargar la cache de columnas (loadCache). Usa el cards.json guardado en extraPath.
+void MainWindow::testCardsCacheBenchmark()
+{
+    QFile cardsJsonFile(Utility::extraPath() + "/cards.json");
+    if(!cardsJsonFile.open(QIODevice::ReadOnly))
+    {
+        pDebug("Benchmark: Cannot open " + cardsJsonFile.fileName(), DebugLevel::Error);
+        return;
+    }
+
+    QTemporaryDir benchDir;
+    if(!benchDir.isValid())
+    {
+        pDebug("Benchmark: Cannot create temp dir.", DebugLevel::Error);
+        cardsJsonFile.close();
+        return;
+    }
+    QString cachePath = benchDir.path() + "/" + CARDS_CACHE_FILE;
+
+    //Sin cache
+    QElapsedTimer timer;
+    timer.start();
+    QByteArray jsonData = cardsJsonFile.readAll();
+    cardsJsonFile.close();
+    CardDB jsonCardDB;
+    jsonCardDB.setLocalLang(Utility::getLocalLang());
+    jsonCardDB.load(QJsonDocument::fromJson(jsonData).array());
+    qint64 jsonMs = std::max(timer.elapsed(), qint64(1));
+
+    if(!jsonCardDB.saveCache(cachePath, "benchmark"))
+    {
+        pDebug("Benchmark: Cannot write " + cachePath, DebugLevel::Error);
+        return;
+    }
+
+    //Con cache
+    timer.restart();
+    CardDB cacheCardDB;
+    cacheCardDB.setLocalLang(Utility::getLocalLang());
+    bool cacheLoaded = cacheCardDB.loadCache(cachePath, "benchmark");
+    qint64 cacheMs = std::max(timer.elapsed(), qint64(1));
+
+    if(!cacheLoaded)
+    {
+        pDebug("Benchmark: Cannot load " + cachePath, DebugLevel::Error);
+        return;
+    }
+
+    pDebug("Benchmark: CardDB " + QString::number(cacheCardDB.count()) + " cards --> cards.json (no cache): " +
+           QString::number(jsonMs) + " ms - Cache (" + QString::number(QFileInfo(cachePath).size()/1024) + " KB): " +
+           QString::number(cacheMs) + " ms - x" + QString::number(static_cast<double>(jsonMs)/cacheMs, 'f', 1));
+}
+
+
+//Capturas guardadas en DraftBenchmark/<pick>/*.png + pick.txt, hero.txt con el numero de heroe del log (p.ej. 08)
+void MainWindow::testDraftRecognitionBenchmark()
+{
+    QString benchPath = Utility::dataPath() + "/DraftBenchmark";
+    QFile heroFile(benchPath + "/hero.txt");
+    if(!heroFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        pDebug("Benchmark: Cannot open " + heroFile.fileName(), DebugLevel::Error);
+        return;
+    }
+    QString hero = QString(heroFile.readAll()).trimmed();
+    heroFile.close();
+
+    draftHandler->benchmarkRecognition(benchPath, hero);
+}
+
+
+//Peores tableros para BombSolver: 2 heroes y 14 esbirros con vidas distintas o repetidas
+void MainWindow::testBombBenchmark()
+{
+    QList<QList<int>> boards;
+    boards << (QList<int>() << 30 << 1 << 2 << 3 << 4 << 5 << 6 << 7 << 30 << 1 << 2 << 3 << 4 << 5 << 6 << 7);
+    boards << (QList<int>() << 30 << 3 << 4 << 5 << 6 << 7 << 8 << 9 << 30 << 10 << 11 << 12 << 2 << 3 << 4 << 5);
+    boards << (QList<int>() << 30 << 1 << 1 << 1 << 1 << 1 << 1 << 1 << 30 << 2 << 2 << 2 << 2 << 2 << 2 << 2);
+    boards << (QList<int>() << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16 << 16);//BombKey
+
+    for(const QList<int> &targets: boards)
+    {
+        for(int missiles: {8, 12, 15})
+        {
+            QElapsedTimer timer;
+            timer.start();
+            QList<float> deadProbs = BombSolver::deadProbs(targets, missiles);
+            qint64 elapsedUs = timer.nsecsElapsed()/1000;
+
+            QStringList probs;
+            for(float prob: deadProbs)  probs.append(QString::number(static_cast<int>(prob*100)));
+            pDebug("Benchmark: Bomb " + QString::number(targets.count()) + " targets " + QString::number(missiles) +
+                   " missiles --> " + QString::number(elapsedUs) + " us (" + probs.join(" ") + ")");
+        }
+    }
+}
+
+
 void MainWindow::testDelay()
 {
 //    testTierlists();
+//    testPowerLogBenchmark();
+//    testLogSyncBenchmark();
+//    testCardsCacheBenchmark();
+//    testDraftRecognitionBenchmark();
+//    testBombBenchmark();
     testSynergies();
 }
 
@@ -18,8 +18,11 @@
 #include "premiumhandler.h"
 #include "Widgets/cardwindow.h"
 #include "Widgets/cardlistwindow.h"
+#include "Utils/logsink.h"
 #include <QMainWindow>
 #include <QJsonObject>
+#include <QThread>
+#include <QElapsedTimer>
 
 #define DIVIDE_TABS_H 444
 #define DIVIDE_TABS_H2 666
@@ -27,6 +30,8 @@
 #define BIG_BUTTONS_H 48
 #define SMALL_BUTTONS_H 19
 #define DEFAULT_THEME "Classic"
+#define CARDS_CACHE_FILE "cards.bin"
+#define USE_CARDS_CACHE true
 #define JSON_CARDS_URL "https://api.hearthstonejson.com/v1/latest/all/cards.json"
 #define LIGHTFORGE_JSON_URL "http://thelightforge.com/api/TierList/Latest?locale=enUS"
 #define HSR_HEROES_WINRATE "https://hsreplay.net/api/v1/analytics/query/player_class_performance_summary/"
@@ -62,6 +67,7 @@ private:
     bool patreonVersion;
     LogLoader *logLoader;
     GameWatcher *gameWatcher;
+    QThread *parserThread;
     HSCardDownloader *cardDownloader;
     EnemyDeckHandler *enemyDeckHandler;
     GraveyardHandler *graveyardHandler;
@@ -75,9 +81,11 @@ private:
     CardListWindow *cardListWindow;
     TrackobotUploader *trackobotUploader;
     PremiumHandler *premiumHandler;
-    QMap<QString, QJsonObject> cardsJson;
+    CardDB *cardDB;
+    QElapsedTimer startupTimer;
     QPoint dragPosition;
-    QFile* atLogFile;
+    LogSink *logSink;
+    QString atLogPath;
     bool mouseInApp;
     Transparency transparency;
     DraftMethod draftMethod;
@@ -88,6 +96,7 @@ private:
     bool showDraftScoresOverlay, showDraftMechanicsOverlay;
     bool draftLearningMode;
     QString draftLogFile;
+    QString logsDirPath;
     bool copyGameLogs;
     QNetworkAccessManager *networkManager;
     QStringList allCardsDownloadList;
@@ -96,11 +105,10 @@ private:
 
 
 //Metodos
-public:
-    LoadingScreenState getLoadingScreen();
-
 private:
     void createLogLoader();
+    void createParserThread();
+    void setLogRepaintsEnabled(bool enabled);
     void createArenaHandler();
     void createGameWatcher();
     void createCardWindow();
@@ -133,6 +141,7 @@ private:
     void updateTabWidgetsTheme(bool transparent, bool resizing);
     QString getHSLanguage();
     void createCardsJsonMap(QByteArray &jsonData);
+    void releaseCardDB(CardDB *oldCardDB);
     void resizeTopButtons(int right, int top);
     void resizeChecks();
     void moveTabTo(QWidget *widget, QTabWidget *tabWidget);
@@ -187,6 +196,8 @@ private:
     void processHSRHeroesWinrate(QJsonObject jsonObject);
     void deleteTwitchTester();
     void checkTwitchConnection();
+    QByteArray benchmarkPowerLogBlock();
+    QStringList benchmarkBasePowerPatterns();
 
 //Override events
 protected:
@@ -208,8 +219,7 @@ signals:
 //Slots
 public slots:
     //GameWatcher
-    void resetDeck(bool deckRead=false);
-    void resetDeckDontRead();
+    void resetDeck();
 
     //Multi Handlers
     bool checkCardImage(QString code, bool isHero=false);
@@ -232,6 +242,11 @@ private slots:
     void testDelay();
     void testSynergies();
     void testTierlists();
+    void testPowerLogBenchmark();
+    void testLogSyncBenchmark();
+    void testCardsCacheBenchmark();
+    void testDraftRecognitionBenchmark();
+    void testBombBenchmark();
     void confirmNewArenaDraft(QString hero);
     void transparentAlways();
     void transparentAuto();
@@ -252,6 +267,8 @@ private slots:
     void spreadMouseInApp();
     void updateMaxGamesLog(int value);
     void logReset();
+    void suspendLogRepaints();
+    void resumeLogRepaints();
     void spreadCorrectTamCard();
     void completeArenaDeck();
     void changingTabResetSizePlan();
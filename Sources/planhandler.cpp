@@ -19,6 +19,7 @@ PlanHandler::PlanHandler(QObject *parent, Ui::Extended *ui) : QObject(parent)
     this->futureBoard = nullptr;
     this->selectedMinion = nullptr;
     this->selectedCode = "";
+    this->futureBombsGeneration = 0;
     reset();
     completeUI();
     createGraphicsItemSender();
@@ -609,7 +610,7 @@ bool PlanHandler::isLastMinionAddedValid()
 }
 
 
-void PlanHandler::cardTagChangePrevTurn(int id, bool friendly, QString tag, QString value)
+void PlanHandler::cardTagChangePrevTurn(int id, bool friendly, PowerTag tag, int value)
 {
     if(turnBoards.empty())  return;
 
@@ -619,16 +620,16 @@ void PlanHandler::cardTagChangePrevTurn(int id, bool friendly, QString tag, QStr
     CardGraphicsItem *card = findCard(friendly, id, board);
     if(card != nullptr)
     {
-        if(tag == "COST")   card->reduceCost(value.toInt());
+        if(tag == PT_COST)  card->reduceCost(value);
         else                card->processTagChange(tag, value);
     }
 }
 
 
-void PlanHandler::playerBoardTagChange(int id, QString code, QString tag, QString value)
+void PlanHandler::playerBoardTagChange(int id, QString code, PowerTag tag, int value)
 {
-    if(tag == "LINKED_ENTITY" && !code.isEmpty() &&
-        nowBoard->playerHero != nullptr && nowBoard->playerHero->getId() == value.toInt())
+    if(tag == PT_LINKED_ENTITY && !code.isEmpty() &&
+        nowBoard->playerHero != nullptr && nowBoard->playerHero->getId() == value)
     {
         addAddonToLastTurn(code, id, nowBoard->playerHero->getId(), Addon::AddonNeutral);
         addHero(true, code, id);
@@ -637,10 +638,10 @@ void PlanHandler::playerBoardTagChange(int id, QString code, QString tag, QStrin
 }
 
 
-void PlanHandler::enemyBoardTagChange(int id, QString code, QString tag, QString value)
+void PlanHandler::enemyBoardTagChange(int id, QString code, PowerTag tag, int value)
 {
-    if(tag == "LINKED_ENTITY" && !code.isEmpty() &&
-        nowBoard->enemyHero != nullptr && nowBoard->enemyHero->getId() == value.toInt())
+    if(tag == PT_LINKED_ENTITY && !code.isEmpty() &&
+        nowBoard->enemyHero != nullptr && nowBoard->enemyHero->getId() == value)
     {
         addAddonToLastTurn(code, id, nowBoard->enemyHero->getId(), Addon::AddonNeutral);
         addHero(false, code, id);
@@ -649,13 +650,13 @@ void PlanHandler::enemyBoardTagChange(int id, QString code, QString tag, QString
 }
 
 
-bool PlanHandler::updateInPendingTagChange(int id, QString tag, QString value)
+bool PlanHandler::updateInPendingTagChange(int id, PowerTag tag, int value)
 {
     for(QMap<int,TagChange>::iterator it = pendingTagChanges.begin(); it != pendingTagChanges.end(); it++)
     {
         if(it->id == id && it->tag == tag)
         {
-            emit pDebug("Mapped Tag Change updated: Id: " + QString::number(id) + " - " + tag + " --> " + value);
+            emit pDebug("Mapped Tag Change updated: Id: " + QString::number(id) + " - " + PowerTags::tagName(tag) + " --> " + PowerTags::valueText(tag, value));
             it->value = value;
             return true;
         }
@@ -666,11 +667,11 @@ bool PlanHandler::updateInPendingTagChange(int id, QString tag, QString value)
 
 void PlanHandler::addCardTagChange(const TagChange &tagChange, CardGraphicsItem *card)
 {
-    emit pDebug("Tag Change Card: Id: " + QString::number(tagChange.id) + " - " + tagChange.tag + " --> " + tagChange.value);
+    emit pDebug("Tag Change Card: Id: " + QString::number(tagChange.id) + " - " + PowerTags::tagName(tagChange.tag) + " --> " + PowerTags::valueText(tagChange.tag, tagChange.value));
     card->processTagChange(tagChange.tag, tagChange.value);
     cardTagChangePrevTurn(tagChange.id, tagChange.friendly, tagChange.tag, tagChange.value);
 
-    if(tagChange.friendly && tagChange.tag == "COST")
+    if(tagChange.friendly && tagChange.tag == PT_COST)
     {
         showManaPlayableCardsAuto();
     }
@@ -679,12 +680,12 @@ void PlanHandler::addCardTagChange(const TagChange &tagChange, CardGraphicsItem
 
 void PlanHandler::addMinionTagChange(const TagChange &tagChange, MinionGraphicsItem * minion)
 {
-    emit pDebug("Tag Change Minion: Id: " + QString::number(tagChange.id) + " - " + tagChange.tag + " --> " + tagChange.value);
+    emit pDebug("Tag Change Minion: Id: " + QString::number(tagChange.id) + " - " + PowerTags::tagName(tagChange.tag) + " --> " + PowerTags::valueText(tagChange.tag, tagChange.value));
     checkAtkHealthChange(minion, tagChange.friendly, tagChange.tag, tagChange.value);
     bool healing = minion->processTagChange(tagChange.tag, tagChange.value);
     bool isDead = minion->isDead();
     bool isHero = false;
-    if(tagChange.tag == "ATK" || tagChange.tag == "EXHAUSTED" || tagChange.tag == "WINDFURY" || tagChange.tag == "FROZEN")
+    if(tagChange.tag == PT_ATK || tagChange.tag == PT_EXHAUSTED || tagChange.tag == PT_WINDFURY || tagChange.tag == PT_FROZEN)
     {
         updateMinionsAttack(tagChange.friendly);
     }
@@ -698,7 +699,7 @@ void PlanHandler::addHeroTagChange(const TagChange &tagChange)
     HeroGraphicsItem* hero = (tagChange.friendly?nowBoard->playerHero:nowBoard->enemyHero);
 
     emit pDebug("Tag Change " + QString(tagChange.friendly?"Player":"Enemy") + " Hero: Id: " +
-                QString::number(tagChange.id) + " - " + tagChange.tag + " --> " + tagChange.value);
+                QString::number(tagChange.id) + " - " + PowerTags::tagName(tagChange.tag) + " --> " + PowerTags::valueText(tagChange.tag, tagChange.value));
     bool healing = hero->processTagChange(tagChange.tag, tagChange.value);
     bool isDead = hero->isDead();
     bool isHero = true;
@@ -712,13 +713,14 @@ void PlanHandler::addHeroPowerTagChange(const TagChange &tagChange)
     HeroPowerGraphicsItem* heroPower = (tagChange.friendly?nowBoard->playerHeroPower:nowBoard->enemyHeroPower);
 
     emit pDebug("Tag Change " + QString(tagChange.friendly?"Player":"Enemy") + " Hero Power: Id: " +
-                QString::number(tagChange.id) + " - " + tagChange.tag + " --> " + tagChange.value);
+                QString::number(tagChange.id) + " - " + PowerTags::tagName(tagChange.tag) + " --> " + PowerTags::valueText(tagChange.tag, tagChange.value));
     heroPower->processTagChange(tagChange.tag, tagChange.value);
 
-    if(tagChange.tag == "EXHAUSTED" && tagChange.value == "1" && !turnBoards.empty())
+    if(tagChange.tag == PT_EXHAUSTED && tagChange.value == 1 && !turnBoards.empty())
     {
-        if(tagChange.friendly)  turnBoards.last()->playerHeroPower->processTagChange(tagChange.tag, tagChange.value);
-        else                    turnBoards.last()->enemyHeroPower->processTagChange(tagChange.tag, tagChange.value);
+        Board *board = turnBoards.last();
+        HeroPowerGraphicsItem* heroPowerLastTurn = (tagChange.friendly?board->playerHeroPower:board->enemyHeroPower);
+        if(heroPowerLastTurn != nullptr)    heroPowerLastTurn->processTagChange(tagChange.tag, tagChange.value);
     }
 }
 
@@ -728,7 +730,7 @@ void PlanHandler::addWeaponTagChange(const TagChange &tagChange)
     WeaponGraphicsItem* weapon = (tagChange.friendly?nowBoard->playerWeapon:nowBoard->enemyWeapon);
 
     emit pDebug("Tag Change " + QString(tagChange.friendly?"Player":"Enemy") + " Weapon: Id: " +
-                QString::number(tagChange.id) + " - " + tagChange.tag + " --> " + tagChange.value);
+                QString::number(tagChange.id) + " - " + PowerTags::tagName(tagChange.tag) + " --> " + PowerTags::valueText(tagChange.tag, tagChange.value));
     weapon->processTagChange(tagChange.tag, tagChange.value);
 }
 
@@ -737,13 +739,13 @@ void PlanHandler::addAddonTagChange(const TagChange &tagChange, bool healing, bo
 {
     if(!isDead && isLastPowerAddonValid(tagChange.tag, tagChange.value, tagChange.id, tagChange.friendly, isHero, healing))
     {
-        if(tagChange.tag == "DAMAGE" || tagChange.tag == "ARMOR" || tagChange.tag == "CONTROLLER" || tagChange.tag == "TO_BE_DESTROYED" ||
-            tagChange.tag == "SHOULDEXITCOMBAT" || (tagChange.tag == "DIVINE_SHIELD" && tagChange.value == "0"))
+        if(tagChange.tag == PT_DAMAGE || tagChange.tag == PT_ARMOR || tagChange.tag == PT_CONTROLLER || tagChange.tag == PT_TO_BE_DESTROYED ||
+            tagChange.tag == PT_SHOULDEXITCOMBAT || (tagChange.tag == PT_DIVINE_SHIELD && tagChange.value == 0))
         {
             addAddonToLastTurn(this->lastPowerAddon.code, this->lastPowerAddon.id, tagChange.id, healing?Addon::AddonLife:Addon::AddonDamage);
 
             //Evita que un efecto que quita la armadura y hace algo de damage aparezca 2 veces
-            if(isHero && tagChange.tag == "ARMOR" && tagChange.value == "0")
+            if(isHero && tagChange.tag == PT_ARMOR && tagChange.value == 0)
             {
                 this->lastArmorRemoverIds.idAddon = this->lastPowerAddon.id;
                 this->lastArmorRemoverIds.idHero = tagChange.id;
@@ -751,10 +753,10 @@ void PlanHandler::addAddonTagChange(const TagChange &tagChange, bool healing, bo
             }
         }
         else if(
-                    tagChange.tag == "ATK" || tagChange.tag == "HEALTH" || tagChange.tag == "ZONE" ||
-                    tagChange.tag == "DIVINE_SHIELD" || tagChange.tag == "STEALTH" || tagChange.tag == "TAUNT" ||
-                    tagChange.tag == "CHARGE" || tagChange.tag == "FROZEN" || tagChange.tag == "WINDFURY" ||
-                    tagChange.tag == "SILENCED" || tagChange.tag == "AURA" || tagChange.tag == "CANT_BE_DAMAGED"
+                    tagChange.tag == PT_ATK || tagChange.tag == PT_HEALTH || tagChange.tag == PT_ZONE ||
+                    tagChange.tag == PT_DIVINE_SHIELD || tagChange.tag == PT_STEALTH || tagChange.tag == PT_TAUNT ||
+                    tagChange.tag == PT_CHARGE || tagChange.tag == PT_FROZEN || tagChange.tag == PT_WINDFURY ||
+                    tagChange.tag == PT_SILENCED || tagChange.tag == PT_AURA || tagChange.tag == PT_CANT_BE_DAMAGED
                )
         {
             addAddonToLastTurn(this->lastPowerAddon.code, this->lastPowerAddon.id, tagChange.id, Addon::AddonNeutral);
@@ -763,7 +765,7 @@ void PlanHandler::addAddonTagChange(const TagChange &tagChange, bool healing, bo
 }
 
 
-void PlanHandler::addBoardTagChange(int id, bool friendly, QString tag, QString value)
+void PlanHandler::addBoardTagChange(int id, bool friendly, PowerTag tag, int value)
 {
     TagChange tagChange;
     tagChange.id = id;
@@ -778,7 +780,7 @@ void PlanHandler::addBoardTagChange(int id, bool friendly, QString tag, QString
     CardGraphicsItem *card = findCard(friendly, id);
     if(card != nullptr)
     {
-        if(tag == "COST" || tag == "ATK" || tag == "HEALTH")
+        if(tag == PT_COST || tag == PT_ATK || tag == PT_HEALTH)
         {
             addCardTagChange(tagChange, card);
             return;
@@ -787,7 +789,7 @@ void PlanHandler::addBoardTagChange(int id, bool friendly, QString tag, QString
 
     //Minions
     MinionGraphicsItem * minion = findMinion(friendly, id);
-    if(minion != nullptr && tag != "COST")
+    if(minion != nullptr && tag != PT_COST)
     {
         addMinionTagChange(tagChange, minion);
     }
@@ -826,46 +828,46 @@ void PlanHandler::addBoardTagChange(int id, bool friendly, QString tag, QString
     else
     {
         //Si un minion llega a la mano y es jugado rapido puede que reciba el ZONE = HAND y aparezca como muerto.
-        if(tag == "ZONE")
+        if(tag == PT_ZONE)
         {
-            emit pDebug("Zone Tag Change not appended: Id: " + QString::number(id) + " - " + tag + " --> " + value);
+            emit pDebug("Zone Tag Change not appended: Id: " + QString::number(id) + " - " + PowerTags::tagName(tag) + " --> " + PowerTags::valueText(tag, value));
         }
         else
         {
             pendingTagChanges.insertMulti(id, tagChange);
-            emit pDebug("Tag Change Mapped: Id: " + QString::number(id) + " - " + tag + " --> " + value);
+            emit pDebug("Tag Change Mapped: Id: " + QString::number(id) + " - " + PowerTags::tagName(tag) + " --> " + PowerTags::valueText(tag, value));
         }
     }
 }
 
 
-bool PlanHandler::isLastPowerAddonValid(QString tag, QString value, int idTarget, bool friendly, bool isHero, bool healing)
+bool PlanHandler::isLastPowerAddonValid(PowerTag tag, int value, int idTarget, bool friendly, bool isHero, bool healing)
 {
     if(this->lastPowerAddon.id == -1)   return false;
 
     //Evita addons al perder un arma y cambiar el atk a 0
-    if(isHero && tag == "ATK" && value == "0")
+    if(isHero && tag == PT_ATK && value == 0)
     {
         emit pDebug("Addon(" + QString::number(idTarget) + ")-->" + this->lastPowerAddon.code + " Avoid ATK to 0 when losing a weapon.");
         return false;
     }
 
     //Evita addons por perder el frozen al final del turno
-    if(tag == "FROZEN" && value == "0")
+    if(tag == PT_FROZEN && value == 0)
     {
         emit pDebug("Addon(" + QString::number(idTarget) + ")-->" + this->lastPowerAddon.code + " Avoid FROZEN lost in end turn.");
         return false;
     }
 
     //Evita minions a ZONE PLAY
-    if(tag == "ZONE" && value == "PLAY")
+    if(tag == PT_ZONE && value == PZ_PLAY)
     {
         emit pDebug("Addon(" + QString::number(idTarget) + ")-->" + this->lastPowerAddon.code + " Avoid minion moved to PLAY.");
         return false;
     }
 
     //Evita que un efecto que quita la armadura y hace algo de damage aparezca 2 veces
-    if(isHero && tag == "DAMAGE" && !healing &&
+    if(isHero && tag == PT_DAMAGE && !healing &&
             this->lastArmorRemoverIds.idAddon == this->lastPowerAddon.id &&
             this->lastArmorRemoverIds.idHero == idTarget)
     {
@@ -875,14 +877,14 @@ bool PlanHandler::isLastPowerAddonValid(QString tag, QString value, int idTarget
     }
 
     //Evita addons por cambio de ATK/HEALTH provocados por AURAS
-    if(!isHero && (tag == "ATK" || tag == "HEALTH") && areThereAuras(friendly))
+    if(!isHero && (tag == PT_ATK || tag == PT_HEALTH) && areThereAuras(friendly))
     {
         emit pDebug("Addon(" + QString::number(idTarget) + ")-->" + this->lastPowerAddon.code + " Avoid ATK/HEALTH with auras.");
         return false;
     }
 
     //Evita ENCHANTMENT
-    if(Utility::getCardAttribute(this->lastPowerAddon.code, "type").toString() == "ENCHANTMENT")
+    if(Utility::getTypeFromCode(this->lastPowerAddon.code) == ENCHANTMENT)
     {
         emit pDebug("Addon(" + QString::number(idTarget) + ")-->" + this->lastPowerAddon.code + " Avoid ENCHANTMENT.");
         return false;
@@ -915,11 +917,11 @@ bool PlanHandler::isLastPowerAddonValid(QString tag, QString value, int idTarget
 }
 
 
-void PlanHandler::checkAtkHealthChange(MinionGraphicsItem * minion, bool friendly, QString tag, QString value)
+void PlanHandler::checkAtkHealthChange(MinionGraphicsItem * minion, bool friendly, PowerTag tag, int value)
 {
     if(minion == nullptr || minion->isDead())  return;
 
-    if(tag == "ATK")
+    if(tag == PT_ATK)
     {
         if(turnBoards.empty())  return;
 
@@ -927,15 +929,15 @@ void PlanHandler::checkAtkHealthChange(MinionGraphicsItem * minion, bool friendl
         if(minionLastTurn == nullptr)  return;
 
         int attack = minion->getAttack();
-        int newAttack = value.toInt();
+        int newAttack = value;
 
         //Swaps pone ATK y HEALTH a 0 y luego los valores finales, lo que crea signos - confusos.
         if(attack == 0 || newAttack == 0)  return;
 
-        if(newAttack > attack)          minionLastTurn->setChangeAttack(MinionGraphicsItem::ChangePositive);
-        else if(newAttack < attack)     minionLastTurn->setChangeAttack(MinionGraphicsItem::ChangeNegative);
+        if(newAttack > attack)          minionLastTurn->setChangeAttack(MinionData::ChangePositive);
+        else if(newAttack < attack)     minionLastTurn->setChangeAttack(MinionData::ChangeNegative);
     }
-    else if(tag == "HEALTH")
+    else if(tag == PT_HEALTH)
     {
         if(turnBoards.empty())  return;
 
@@ -943,57 +945,57 @@ void PlanHandler::checkAtkHealthChange(MinionGraphicsItem * minion, bool friendl
         if(minionLastTurn == nullptr)  return;
 
         int health = minion->getHealth();
-        int newHealth = value.toInt();
+        int newHealth = value;
 
         if(health == 0 || newHealth == 0)  return;
 
-        if(newHealth > health)          minionLastTurn->setChangeHealth(MinionGraphicsItem::ChangePositive);
-        else if(newHealth < health)     minionLastTurn->setChangeHealth(MinionGraphicsItem::ChangeNegative);
+        if(newHealth > health)          minionLastTurn->setChangeHealth(MinionData::ChangePositive);
+        else if(newHealth < health)     minionLastTurn->setChangeHealth(MinionData::ChangeNegative);
     }
 }
 
 
-void PlanHandler::playerTagChange(QString tag, QString value)
+void PlanHandler::playerTagChange(PowerTag tag, int value)
 {
     addTagChange(true, tag, value);
 }
 
 
-void PlanHandler::enemyTagChange(QString tag, QString value)
+void PlanHandler::enemyTagChange(PowerTag tag, int value)
 {
     addTagChange(false, tag, value);
 }
 
 
-void PlanHandler::unknownTagChange(QString tag, QString value)
+void PlanHandler::unknownTagChange(PowerTag tag, int value)
 {
     addTagChange(!nowBoard->playerTurn, tag, value);
     if(this->firstStoredTurn == 0)  addTagChange(nowBoard->playerTurn, tag, value);
 }
 
 
-void PlanHandler::addTagChange(bool friendly, QString tag, QString value)
+void PlanHandler::addTagChange(bool friendly, PowerTag tag, int value)
 {
     HeroGraphicsItem *hero = getHero(friendly, nullptr);
     if(hero == nullptr)        return;
 
-    if(tag == "RESOURCES")
+    if(tag == PT_RESOURCES)
     {
-        hero->setResources(value.toInt());
+        hero->setResources(value);
         if(friendly)    showManaPlayableCardsAuto();
     }
-    else if(tag == "RESOURCES_USED")
+    else if(tag == PT_RESOURCES_USED)
     {
-        hero->setResourcesUsed(value.toInt());
+        hero->setResourcesUsed(value);
         //        13:08:35 - GameWatcher(11790): Player: TAG_CHANGE(RESOURCES)= 5 -- Name: triodo
         //        13:08:35 - GameWatcher(11791): Player: TAG_CHANGE(RESOURCES_USED)= 0 -- Name: triodo
         //El reinicio de los recursos del jugador se hace al final del turno enemigo por eso
         //forzamos a que el de RESOURCES_USED sea para el turno actual del jugador.
         if(friendly)    showManaPlayableCards(nowBoard);
     }
-    else if(tag == "CURRENT_SPELLPOWER")
+    else if(tag == PT_CURRENT_SPELLPOWER)
     {
-        hero->setSpellDamage(value.toInt());
+        hero->setSpellDamage(value);
     }
 }
 
@@ -1377,7 +1379,7 @@ void PlanHandler::playerSecretRevealed(int id, QString code)
 
     if(turnBoards.empty())  return;
     Board *board = turnBoards.last();
-    board->playerHero->showSecret(id, code);
+    if(board->playerHero != nullptr)    board->playerHero->showSecret(id, code);
 }
 
 
@@ -1388,7 +1390,7 @@ void PlanHandler::enemySecretRevealed(int id, QString code)
 
     if(turnBoards.empty())  return;
     Board *board = turnBoards.last();
-    board->enemyHero->showSecret(id, code);
+    if(board->enemyHero != nullptr)     board->enemyHero->showSecret(id, code);
 
     revealEnemyCardPrevTurns(id, code);
 }
@@ -1619,12 +1621,31 @@ void PlanHandler::revealEnemyCardPrevTurns(int id, QString code)
 {
     foreach(Board *board, turnBoards)
     {
+        bool found = false;
+
+        if(board->archived)
+        {
+            QList<CardState> &cardList = board->state.enemyHandList;
+            for(int i=0; i<cardList.count(); i++)
+            {
+                if(cardList.at(i).data.id == id)
+                {
+                    cardList[i].data.changeCode(code);
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        //Turnos con items, incluido el archivado que se este mostrando
         CardGraphicsItem *card = findCard(false, id, board);
         if(card != nullptr)
         {
             card->changeCode(code);
-            emit checkCardImage(code, false);
+            found = true;
         }
+
+        if(found)   emit checkCardImage(code, false);
     }
 }
 
@@ -1648,7 +1669,7 @@ void PlanHandler::fixLastEchoCard()
     CardGraphicsItem *card = cardList->last();
     QString code = card->getCode();
     if(card->isDraw() && card->isPlayed() && !code.isEmpty() &&
-            (Utility::getCardAttribute(code, "mechanics").toArray().contains(QJsonValue("ECHO")) ||
+            (Utility::hasMechanic(code, "ECHO") ||
              code == UNSTABLE_EVOLUTION_TOKEN))
     {
         cardList->removeLast();
@@ -1736,7 +1757,10 @@ void PlanHandler::newTurn(bool playerTurn, int numTurn)
     pendingTagChanges.clear();
 
     //Store nowBoard
+    //Solo el ultimo turno guardado se sigue actualizando (*LastTurn), el anterior se archiva.
+    if(!turnBoards.isEmpty())   archiveBoard(turnBoards.last());
     turnBoards.append(copyBoard(nowBoard, numTurn));
+    updateArchivedBoardsCache();
     showManaPlayableCardsAuto();
     updateTurnSliderRange();
 
@@ -1778,6 +1802,11 @@ Board * PlanHandler::copyBoard(Board *origBoard, int numTurn, bool copySecretCod
         if(board->enemyHero != nullptr)       board->enemyHero->setHeroWeapon(board->enemyWeapon, false);
     }
 
+    board->playerMinions.reserve(origBoard->playerMinions.count());
+    board->enemyMinions.reserve(origBoard->enemyMinions.count());
+    board->playerHandList.reserve(origBoard->playerHandList.count());
+    board->enemyHandList.reserve(origBoard->enemyHandList.count());
+
     foreach(MinionGraphicsItem * minion, origBoard->playerMinions)
     {
         board->playerMinions.append(new MinionGraphicsItem(minion));
@@ -1802,6 +1831,167 @@ Board * PlanHandler::copyBoard(Board *origBoard, int numTurn, bool copySecretCod
 }
 
 
+void PlanHandler::archiveBoard(Board *board)
+{
+    BoardState &state = board->state;
+
+    foreach(MinionGraphicsItem * minion, board->playerMinions)
+    {
+        state.playerMinions.append(minion->getState());
+    }
+
+    foreach(MinionGraphicsItem * minion, board->enemyMinions)
+    {
+        state.enemyMinions.append(minion->getState());
+    }
+
+    foreach(ArrowGraphicsItem * arrow, board->arrows)
+    {
+        ArrowState arrowState;
+        arrowState.arrowType = arrow->getArrowType();
+        arrowState.numAttacks = arrow->getNumAttacks();
+        arrowState.from = getArrowEnd(arrow->getEnd(true), board);
+        arrowState.to = getArrowEnd(arrow->getEnd(false), board);
+        if(arrowState.from.pos < -1 || arrowState.to.pos < -1)
+        {
+            emit pDebug("Archive board: Arrow end not found in board.", Warning);
+            continue;
+        }
+        state.arrows.append(arrowState);
+    }
+
+    foreach(CardGraphicsItem * card, board->playerHandList)
+    {
+        state.playerHandList.append(card->getState());
+    }
+
+    foreach(CardGraphicsItem * card, board->enemyHandList)
+    {
+        state.enemyHandList.append(card->getState());
+    }
+
+    if(board->playerHero != nullptr)        state.playerHero = board->playerHero->getState();
+    if(board->enemyHero != nullptr)         state.enemyHero = board->enemyHero->getState();
+    if(board->playerHeroPower != nullptr)   state.playerHeroPower = board->playerHeroPower->getState();
+    if(board->enemyHeroPower != nullptr)    state.enemyHeroPower = board->enemyHeroPower->getState();
+    if(board->playerWeapon != nullptr)      state.playerWeapon = board->playerWeapon->getState();
+    if(board->enemyWeapon != nullptr)       state.enemyWeapon = board->enemyWeapon->getState();
+
+    //Los items se mantienen hasta que deje de ser vecino de viewBoard (updateArchivedBoardsCache)
+    board->archived = true;
+    board->loaded = true;
+}
+
+
+//Crea los items de un turno archivado para mostrarlo en viewBoard
+void PlanHandler::loadArchivedBoard(Board *board)
+{
+    const BoardState &state = board->state;
+    board->loaded = true;
+
+    if(state.playerHero.valid)      board->playerHero = new HeroGraphicsItem(state.playerHero, graphicsItemSender);
+    if(state.enemyHero.valid)       board->enemyHero = new HeroGraphicsItem(state.enemyHero, graphicsItemSender);
+    if(state.playerHeroPower.valid) board->playerHeroPower = new HeroPowerGraphicsItem(state.playerHeroPower, graphicsItemSender);
+    if(state.enemyHeroPower.valid)  board->enemyHeroPower = new HeroPowerGraphicsItem(state.enemyHeroPower, graphicsItemSender);
+
+    if(state.playerWeapon.valid)
+    {
+        board->playerWeapon = new WeaponGraphicsItem(state.playerWeapon, graphicsItemSender);
+        if(board->playerHero != nullptr)       board->playerHero->setHeroWeapon(board->playerWeapon, false);
+    }
+    if(state.enemyWeapon.valid)
+    {
+        board->enemyWeapon = new WeaponGraphicsItem(state.enemyWeapon, graphicsItemSender);
+        if(board->enemyHero != nullptr)        board->enemyHero->setHeroWeapon(board->enemyWeapon, false);
+    }
+
+    board->playerMinions.reserve(state.playerMinions.count());
+    board->enemyMinions.reserve(state.enemyMinions.count());
+    board->playerHandList.reserve(state.playerHandList.count());
+    board->enemyHandList.reserve(state.enemyHandList.count());
+
+    foreach(const MinionState &minionState, state.playerMinions)
+    {
+        board->playerMinions.append(new MinionGraphicsItem(minionState, graphicsItemSender));
+    }
+
+    foreach(const MinionState &minionState, state.enemyMinions)
+    {
+        board->enemyMinions.append(new MinionGraphicsItem(minionState, graphicsItemSender));
+    }
+
+    foreach(const ArrowState &arrowState, state.arrows)
+    {
+        MinionGraphicsItem *from = getArrowEndItem(arrowState.from, board);
+        MinionGraphicsItem *to = getArrowEndItem(arrowState.to, board);
+        if(from == nullptr || to == nullptr)    continue;
+        board->arrows.append(new ArrowGraphicsItem(arrowState, from, to));
+    }
+
+    foreach(const CardState &cardState, state.playerHandList)
+    {
+        board->playerHandList.append(new CardGraphicsItem(cardState, graphicsItemSender));
+    }
+
+    foreach(const CardState &cardState, state.enemyHandList)
+    {
+        board->enemyHandList.append(new CardGraphicsItem(cardState, graphicsItemSender));
+    }
+}
+
+
+//Libera los items de un turno archivado que ha dejado de mostrarse, el state se mantiene
+void PlanHandler::releaseArchivedBoard(Board *board)
+{
+    resetBoard(board);
+    board->loaded = false;
+}
+
+
+//Mantiene los items de los turnos archivados a ARCHIVED_CACHE_TURNS o menos de viewBoard,
+//asi al recorrer el slider turno a turno solo se crea un board por paso y volver atras no crea ninguno.
+void PlanHandler::updateArchivedBoardsCache()
+{
+    int viewIndex = turnBoards.indexOf(viewBoard);
+    if(viewIndex == -1)     viewIndex = turnBoards.count();//nowBoard/futureBoard van tras el ultimo turno
+
+    for(int i=0; i<turnBoards.count(); i++)
+    {
+        Board *board = turnBoards[i];
+        if(!board->archived)    continue;
+
+        bool cached = qAbs(i - viewIndex) <= ARCHIVED_CACHE_TURNS;
+        if(cached && !board->loaded)        loadArchivedBoard(board);
+        else if(!cached && board->loaded)   releaseArchivedBoard(board);
+    }
+}
+
+
+//pos -1 --> heroe, -2 --> no esta en el board
+ArrowEnd PlanHandler::getArrowEnd(MinionGraphicsItem *item, Board *board)
+{
+    ArrowEnd end;
+    end.friendly = item->isFriendly();
+    if(item == getHero(end.friendly, board))    end.pos = -1;
+    else
+    {
+        end.pos = getMinionList(end.friendly, board)->indexOf(item);
+        if(end.pos == -1)   end.pos = -2;
+    }
+    return end;
+}
+
+
+MinionGraphicsItem * PlanHandler::getArrowEndItem(const ArrowEnd &end, Board *board)
+{
+    if(end.pos == -1)   return getHero(end.friendly, board);
+
+    QList<MinionGraphicsItem *> *minionsList = getMinionList(end.friendly, board);
+    if(end.pos < minionsList->count())  return minionsList->at(end.pos);
+    return nullptr;
+}
+
+
 //Evita addons provocado por ocultar/aparecer el arma al final del turno
 void PlanHandler::resetLastPowerAddon()
 {
@@ -2387,12 +2577,17 @@ void PlanHandler::updateTurnLabel()
 
 void PlanHandler::showSliderTurn(int turn)
 {
+    Board *prevViewBoard = viewBoard;
     int lastTurn = firstStoredTurn + turnBoards.count() - 1;
     if(turn > lastTurn)     viewBoard = nowBoard;
     else                    viewBoard = turnBoards[turn-firstStoredTurn];
 
+    if(viewBoard->archived && !viewBoard->loaded)   loadArchivedBoard(viewBoard);
+
     loadViewBoard();
 
+    if(viewBoard != prevViewBoard)  updateArchivedBoardsCache();
+
     bool prevEnabled = ui->planTurnSlider->minimum() != turn;
     bool nextEnabled = ui->planTurnSlider->maximum() != turn;
     ui->planButtonLast->setEnabled(nextEnabled);
@@ -2614,7 +2809,7 @@ void PlanHandler::resetDeadProbs()
     foreach(MinionGraphicsItem *minion, *getMinionList(true))    minion->setDeadProb();
     foreach(MinionGraphicsItem *minion, *getMinionList(false))   minion->setDeadProb();
 
-    if(futureBombs.isRunning())     abortFutureBombs = true;
+    bombsGeneration.fetchAndAddOrdered(1);
 }
 
 
@@ -2652,16 +2847,17 @@ void PlanHandler::checkBomb(QString code)
     }
 
     //Get dead probs
-    futureBombs.setFuture(QtConcurrent::run(this, &PlanHandler::bombDeads, targets, missiles));
-    abortFutureBombs = false;
+    futureBombsGeneration = bombsGeneration.fetchAndAddOrdered(1) + 1;
+    futureBombs.setFuture(QtConcurrent::run(&BombSolver::deadProbs, targets, missiles, &bombsGeneration, futureBombsGeneration));
 }
 
 
 void PlanHandler::setDeadProbs()
 {
-    if(abortFutureBombs)    return;
+    if(futureBombsGeneration != bombsGeneration.load())    return;
 
     QList<float> deadProbs = futureBombs.result();
+    if(deadProbs.isEmpty())     return;
 
     HeroGraphicsItem *enemyHero = nowBoard->enemyHero;
     QList<MinionGraphicsItem *> *enemyMinions = getMinionList(false);
@@ -2678,80 +2874,6 @@ void PlanHandler::setDeadProbs()
 }
 
 
-QList<float> PlanHandler::bombDeads(QList<int> targets, int missiles)
-{
-    QMap<QString, float> states;
-    states[encodeBombState(targets)] = 1;
-    for(int i=0; i<missiles; i++)           states = bomb(states);
-
-    QList<float> deadProbs;
-    for(int i=0; i<targets.count(); i++)    deadProbs.append(0);
-
-    foreach(QString state, states.keys())
-    {
-        float prob = states[state];
-        QList<int> targets = decodeBombState(state);
-        for(int i=0; i<targets.count(); i++)
-        {
-            if(targets[i] == 0)     deadProbs[i] += prob;
-        }
-    }
-
-    return deadProbs;
-}
-
-
-QList<int> PlanHandler::decodeBombState(QString state)
-{
-    QList<int> targets;
-    foreach(QString targetString, state.split(":"))  targets.append(targetString.toInt());
-    return targets;
-}
-
-
-QString PlanHandler::encodeBombState(QList<int> targets)
-{
-    QStringList targetsString;
-    foreach(int target, targets)      targetsString.append(QString::number(target));
-    return targetsString.join(":");
-}
-
-
-QMap<QString, float> PlanHandler::bomb(QMap<QString, float> &oldStates)
-{
-    QMap<QString, float> newStates;
-
-    foreach(QString oldState, oldStates.keys())
-    {
-        float oldProb = oldStates[oldState];
-        QList<int> oldTargets = decodeBombState(oldState);
-
-        int livingTargets = 0;
-        for(int i=0; i<oldTargets.count(); i++)
-        {
-            if(oldTargets[i] > 0)   livingTargets++;
-        }
-
-        //Apply an attack to each living targets
-        for(int i=0; i<oldTargets.count(); i++)
-        {
-            if(oldTargets[i] > 0)
-            {
-                QList<int> newTargets(oldTargets);
-                newTargets[i]--;
-                QString newState = encodeBombState(newTargets);
-
-                //Update probabilities
-                float addProb = newStates.contains(newState)?newStates[newState]:0;
-                newStates[newState] = addProb + oldProb/livingTargets;
-            }
-        }
-    }
-
-    return newStates;
-}
-
-
 int PlanHandler::flamewakersOnBoard()
 {
     int num = 0;
@@ -2863,12 +2985,26 @@ QJsonArray PlanHandler::getJsonCardHistory()
         item[ "turn" ] = (board->numTurn + 1)/2;
         item[ "player" ] = board->playerTurn?"me":"opponent";
 
-        for(CardGraphicsItem *card: (board->playerTurn?board->playerHandList:board->enemyHandList))
+        if(board->archived)
+        {
+            for(const CardState &card: (board->playerTurn?board->state.playerHandList:board->state.enemyHandList))
+            {
+                if(card.data.played)
+                {
+                    item[ "card_id" ] = card.data.code;
+                    cardHistory.append(item);
+                }
+            }
+        }
+        else
         {
-            if(card->isPlayed())
+            for(CardGraphicsItem *card: (board->playerTurn?board->playerHandList:board->enemyHandList))
             {
-                item[ "card_id" ] = card->getCode();
-                cardHistory.append(item);
+                if(card->isPlayed())
+                {
+                    item[ "card_id" ] = card->getCode();
+                    cardHistory.append(item);
+                }
             }
         }
     }
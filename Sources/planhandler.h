@@ -11,16 +11,21 @@
 #include "Widgets/GraphicItems/graphicsitemsender.h"
 #include "Cards/handcard.h"
 #include "utility.h"
+#include "Utils/powertags.h"
+#include "Utils/bombsolver.h"
 #include <QObject>
 #include <QFutureWatcher>
 
+#define ARCHIVED_CACHE_TURNS 1
+
 
 class TagChange
 {
 public:
     int id;
     bool friendly;
-    QString tag, value;
+    PowerTag tag;
+    int value;
 };
 
 
@@ -31,6 +36,21 @@ public:
 };
 
 
+//Turno guardado como valores, sin QGraphicsItems
+class BoardState
+{
+public:
+    QList<MinionState> playerMinions, enemyMinions;
+    HeroState playerHero, enemyHero;
+    HeroPowerState playerHeroPower, enemyHeroPower;
+    WeaponState playerWeapon, enemyWeapon;
+    QList<ArrowState> arrows;
+    QList<CardState> playerHandList, enemyHandList;
+};
+
+
+//Los turnos guardados anteriores al ultimo estan archivados: solo tienen state y se crean sus items
+//cuando se muestran en viewBoard o son vecinos suyos (updateArchivedBoardsCache). El resto de boards solo tienen items.
 class Board
 {
 public:
@@ -46,6 +66,9 @@ public:
     QList<CardGraphicsItem *> enemyHandList;
     bool playerTurn;
     int numTurn = 0;//0 --> nowBoard
+    bool archived = false;
+    bool loaded = false;//Solo archived: tiene items creados
+    BoardState state;//Solo archived
 };
 
 
@@ -79,7 +102,8 @@ private:
     Transparency transparency;
     GraphicsItemSender *graphicsItemSender;
     QFutureWatcher<QList<float> > futureBombs;
-    bool abortFutureBombs;
+    QAtomicInt bombsGeneration;     //Cambia con cada calculo nuevo o reset, cancela el calculo en curso
+    int futureBombsGeneration;
     QPushButton *planPatreonButton;
 
 //Metodos:
@@ -97,7 +121,7 @@ private:
     void addReinforceToLastTurn(MinionGraphicsItem *parent, MinionGraphicsItem *child, Board *board);
     void updateMinionPos(bool friendly, int id, int pos);
     void removeMinion(bool friendly, int id);
-    void addBoardTagChange(int id, bool friendly, QString tag, QString value);
+    void addBoardTagChange(int id, bool friendly, PowerTag tag, int value);
     void addCardTagChange(const TagChange &tagChange, CardGraphicsItem *card);
     void addMinionTagChange(const TagChange &tagChange, MinionGraphicsItem *minion);
     void addHeroTagChange(const TagChange &tagChange);
@@ -117,14 +141,14 @@ private:
     void addAddonToLastTurn(QString code, int id1, int id2, Addon::AddonType type, int number=1);
     void addAddon(MinionGraphicsItem *minion, QString code, int id, Addon::AddonType type, int number=1);
     void addHeroDeadToLastTurn(bool playerWon);
-    bool isLastPowerAddonValid(QString tag, QString value, int idTarget, bool friendly, bool isHero, bool healing);
+    bool isLastPowerAddonValid(PowerTag tag, int value, int idTarget, bool friendly, bool isHero, bool healing);
     bool isLastMinionAddedValid();
     bool isLastTriggerValid(const QString &code);
     bool areThereAuras(bool friendly);    
     bool isAddonMinionValid(const QString &code);
     bool isAddonHeroValid(const QString &code);
     bool isAddonCommonValid(const QString &code);
-    void checkAtkHealthChange(MinionGraphicsItem *minion, bool friendly, QString tag, QString value);    
+    void checkAtkHealthChange(MinionGraphicsItem *minion, bool friendly, PowerTag tag, int value);    
     void updateCardZoneSpots(bool friendly, Board *board = nullptr);
     int findCardPos(QList<CardGraphicsItem *> *cardsList, int id);
     QList<CardGraphicsItem *> *getHandList(bool friendly, Board *board = nullptr);
@@ -140,20 +164,22 @@ private:
     void updateMinionsAttack(bool friendly, Board *board = nullptr);
     void fixTurn1Card();    
     void fixLastEchoCard();
-    void addTagChange(bool friendly, QString tag, QString value);
+    void addTagChange(bool friendly, PowerTag tag, int value);
     bool getWinner();
-    void cardTagChangePrevTurn(int id, bool friendly, QString tag, QString value);
-    bool updateInPendingTagChange(int id, QString tag, QString value);
+    void cardTagChangePrevTurn(int id, bool friendly, PowerTag tag, int value);
+    bool updateInPendingTagChange(int id, PowerTag tag, int value);
     void createGraphicsItemSender();
-    QMap<QString, float> bomb(QMap<QString, float> &oldStates);
-    QList<int> decodeBombState(QString state);
-    QString encodeBombState(QList<int> targets);
-    QList<float> bombDeads(QList<int> targets, int missiles);
     bool isCardBomb(QString code, bool &playerIn, int &missiles);
     bool isMechOnBoard();
     int flamewakersOnBoard();
     void updateTurnSliderRange();
     Board *copyBoard(Board *origBoard, int numTurn = 0, bool copySecretCodes=false);
+    void archiveBoard(Board *board);
+    void loadArchivedBoard(Board *board);
+    void releaseArchivedBoard(Board *board);
+    void updateArchivedBoardsCache();
+    ArrowEnd getArrowEnd(MinionGraphicsItem *item, Board *board);
+    MinionGraphicsItem *getArrowEndItem(const ArrowEnd &end, Board *board);
     void deleteFutureBoard();
     void createFutureBoard();
     void updateMinionFromCard(MinionGraphicsItem *minion);
@@ -212,8 +238,8 @@ public slots:
     void enemyMinionZonePlayRemove(int id);
     void playerMinionPosChange(int id, int pos);
     void enemyMinionPosChange(int id, int pos);
-    void playerBoardTagChange(int id, QString code, QString tag, QString value);
-    void enemyBoardTagChange(int id, QString code, QString tag, QString value);
+    void playerBoardTagChange(int id, QString code, PowerTag tag, int value);
+    void enemyBoardTagChange(int id, QString code, PowerTag tag, int value);
     void playerHeroZonePlayAdd(QString code, int id);
     void enemyHeroZonePlayAdd(QString code, int id);
     void playerWeaponZonePlayAdd(QString code, int id);
@@ -241,9 +267,9 @@ public slots:
     void enemyWeaponZonePlayRemove(int id);
     void playerHeroPowerZonePlayAdd(QString code, int id);
     void enemyHeroPowerZonePlayAdd(QString code, int id);
-    void playerTagChange(QString tag, QString value);
-    void enemyTagChange(QString tag, QString value);
-    void unknownTagChange(QString tag, QString value);
+    void playerTagChange(PowerTag tag, int value);
+    void enemyTagChange(PowerTag tag, int value);
+    void unknownTagChange(PowerTag tag, int value);
     void resizePlan();
     void resetDeadProbs();
     void checkBomb(QString code);
@@ -147,6 +147,15 @@ void SynergyHandler::createDraftItemCounters()
     ui->draftVerticalLayout->addLayout(horLayoutCardTypes);
     ui->draftVerticalLayout->addLayout(horLayoutMechanics1);
     ui->draftVerticalLayout->addLayout(horLayoutMechanics2);
+
+    //Todos los contadores comparten el mazo draftado
+    for(int i=0; i<V_NUM_TYPES; i++)        cardTypeCounters[i]->setDraftedCards(&draftedCards);
+    for(int i=0; i<V_NUM_RACES; i++)        raceCounters[i]->setDraftedCards(&draftedCards);
+    for(int i=0; i<V_NUM_MECHANICS; i++)    mechanicCounters[i]->setDraftedCards(&draftedCards);
+    costMinions.setDraftedCards(&draftedCards);
+    attackMinions.setDraftedCards(&draftedCards);
+    healthMinions.setDraftedCards(&draftedCards);
+    costSpells.setDraftedCards(&draftedCards);
 }
 
 
@@ -251,6 +260,161 @@ void SynergyHandler::initSynergyCodes()
         }
     }
     emit pDebug("Direct Link Cards: " + QString::number(directLinks.count()));
+
+    //Las features dependen de synergyCodes
+    cardFeatures.clear();
+}
+
+
+//Cada carta se evalua la primera vez que se pide (cartas del draft y las que se muestran),
+//sin recorrer todo el pool de arena al empezar el draft.
+CardSynergyFeatures SynergyHandler::getFeatures(const QString &code)
+{
+    QHash<QString, CardSynergyFeatures>::const_iterator it = cardFeatures.constFind(code);
+    if(it != cardFeatures.constEnd())   return it.value();
+    return cardFeatures.insert(code, computeFeatures(code)).value();
+}
+
+
+//Evalua todos los predicados is*Gen/is*Syn de la carta una sola vez
+CardSynergyFeatures SynergyHandler::computeFeatures(const QString &code)
+{
+    CardSynergyFeatures features;
+    QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
+    QJsonArray referencedTags = Utility::getCardAttribute(code, "referencedTags").toArray();
+    QString text = Utility::cardEnLowerTextFromCode(code);
+    CardType cardType = Utility::getTypeFromCode(code);
+    int attack = Utility::getAttackFromCode(code);
+    int cost = Utility::getCostFromCode(code);
+
+    features.flags[F_SPELL_GEN]                   = isSpellGen(code);
+    features.flags[F_WEAPON_GEN]                  = isWeaponGen(code, text);
+    features.flags[F_MURLOC_GEN]                  = isMurlocGen(code);
+    features.flags[F_DEMON_GEN]                   = isDemonGen(code);
+    features.flags[F_MECH_GEN]                    = isMechGen(code);
+    features.flags[F_ELEMENTAL_GEN]               = isElementalGen(code);
+    features.flags[F_BEAST_GEN]                   = isBeastGen(code);
+    features.flags[F_TOTEM_GEN]                   = isTotemGen(code);
+    features.flags[F_PIRATE_GEN]                  = isPirateGen(code);
+    features.flags[F_DRAGON_GEN]                  = isDragonGen(code);
+    features.flags[F_DISCOVER_DRAW_GEN]           = isDiscoverDrawGen(code, mechanics, referencedTags, text);
+    features.flags[F_DISCOVER_GEN]                = isDiscoverGen(code, mechanics, referencedTags);
+    features.flags[F_DRAW_GEN]                    = isDrawGen(code, text);
+    features.flags[F_TO_YOUR_HAND_GEN]            = isToYourHandGen(code, text);
+    features.flags[F_TAUNT]                       = isTaunt(code, mechanics);
+    features.flags[F_TAUNT_GEN]                   = isTauntGen(code, referencedTags);
+    features.flags[F_AOE_GEN]                     = isAoeGen(code, text);
+    features.flags[F_DAMAGE_MINIONS_GEN]          = isDamageMinionsGen(code, mechanics, referencedTags, text, cardType, attack);
+    features.flags[F_DESTROY_GEN]                 = isDestroyGen(code, mechanics, text);
+    features.flags[F_PING_GEN]                    = isPingGen(code, mechanics, referencedTags, text, cardType, attack);
+    features.flags[F_REACH_GEN]                   = isReachGen(code, mechanics, referencedTags, text, cardType, attack);
+    features.flags[F_ENRAGE_GEN]                  = isEnrageGen(code, mechanics);
+    features.flags[F_OVERLOAD]                    = isOverload(code);
+    features.flags[F_JADE_GOLEM_GEN]              = isJadeGolemGen(code, mechanics, referencedTags);
+    features.flags[F_SECRET]                      = isSecret(code, mechanics);
+    features.flags[F_SECRET_GEN]                  = isSecretGen(code);
+    features.flags[F_ECHO]                        = isEcho(code, text);
+    features.flags[F_ECHO_GEN]                    = isEchoGen(code);
+    features.flags[F_RUSH]                        = isRush(code, text);
+    features.flags[F_RUSH_GEN]                    = isRushGen(code);
+    features.flags[F_MAGNETIC]                    = isMagnetic(code, mechanics);
+    features.flags[F_MAGNETIC_GEN]                = isMagneticGen(code);
+    features.flags[F_EGG_GEN]                     = isEggGen(code, mechanics, attack, cardType);
+    features.flags[F_DAMAGE_FRIENDLY_HERO_GEN]    = isDamageFriendlyHeroGen(code);
+    features.flags[F_FREEZE_ENEMY_GEN]            = isFreezeEnemyGen(code, mechanics, referencedTags, text);
+    features.flags[F_DISCARD_GEN]                 = isDiscardGen(code, text);
+    features.flags[F_DEATHRATTLE_MINION]          = isDeathrattleMinion(code, mechanics, cardType);
+    features.flags[F_DEATHRATTLE_GOOD_ALL]        = isDeathrattleGoodAll(code, mechanics, referencedTags, cardType);
+    features.flags[F_BATTLECRY]                   = isBattlecry(code, mechanics);
+    features.flags[F_SILENCE_OWN_GEN]             = isSilenceOwnGen(code, mechanics, referencedTags);
+    features.flags[F_TAUNT_GIVER_GEN]             = isTauntGiverGen(code);
+    features.flags[F_TOKEN_GEN]                   = isTokenGen(code, text);
+    features.flags[F_TOKEN_CARD_GEN]              = isTokenCardGen(code, cost);
+    features.flags[F_COMBO_GEN]                   = isComboGen(code, mechanics);
+    features.flags[F_WINDFURY_MINION]             = isWindfuryMinion(code, mechanics, cardType);
+    features.flags[F_ATTACK_BUFF_GEN]             = isAttackBuffGen(code, text);
+    features.flags[F_HEALTH_BUFF_GEN]             = isHealthBuffGen(code, text);
+    features.flags[F_RETURN_GEN]                  = isReturnGen(code, text);
+    features.flags[F_STEALTH_GEN]                 = isStealthGen(code, mechanics);
+    features.flags[F_DIVINE_SHIELD]               = isDivineShield(code, mechanics);
+    features.flags[F_DIVINE_SHIELD_GEN]           = isDivineShieldGen(code, referencedTags);
+    features.flags[F_RESTORE_TARGET_MINION_GEN]   = isRestoreTargetMinionGen(code, text);
+    features.flags[F_RESTORE_FRIENDLY_HERO_GEN]   = isRestoreFriendlyHeroGen(code, mechanics, text);
+    features.flags[F_RESTORE_FRIENDLY_MINION_GEN] = isRestoreFriendlyMinionGen(code, text);
+    features.flags[F_ARMOR_GEN]                   = isArmorGen(code, text);
+    features.flags[F_LIFESTEAL_MINION]            = isLifestealMinon(code, mechanics, cardType);
+    features.flags[F_SPELL_DAMAGE_GEN]            = isSpellDamageGen(code);
+    features.flags[F_EVOLVE_GEN]                  = isEvolveGen(code, text);
+    features.flags[F_SPAWN_ENEMY_GEN]             = isSpawnEnemyGen(code, text);
+    features.flags[F_MURLOC_SYN]                  = isMurlocSyn(code);
+    features.flags[F_DEMON_SYN]                   = isDemonSyn(code);
+    features.flags[F_MECH_SYN]                    = isMechSyn(code);
+    features.flags[F_ELEMENTAL_SYN]               = isElementalSyn(code);
+    features.flags[F_BEAST_SYN]                   = isBeastSyn(code);
+    features.flags[F_TOTEM_SYN]                   = isTotemSyn(code);
+    features.flags[F_PIRATE_SYN]                  = isPirateSyn(code);
+    features.flags[F_DRAGON_SYN]                  = isDragonSyn(code, text);
+    features.flags[F_MURLOC_ALL_SYN]              = isMurlocAllSyn(code, text);
+    features.flags[F_DEMON_ALL_SYN]               = isDemonAllSyn(code, text);
+    features.flags[F_MECH_ALL_SYN]                = isMechAllSyn(code, mechanics, text);
+    features.flags[F_ELEMENTAL_ALL_SYN]           = isElementalAllSyn(code, text);
+    features.flags[F_BEAST_ALL_SYN]               = isBeastAllSyn(code, text);
+    features.flags[F_TOTEM_ALL_SYN]               = isTotemAllSyn(code, text);
+    features.flags[F_PIRATE_ALL_SYN]              = isPirateAllSyn(code, text);
+    features.flags[F_DRAGON_ALL_SYN]              = isDragonAllSyn(code);
+    features.flags[F_DISCOVER_SYN]                = isDiscoverSyn(code);
+    features.flags[F_DRAW_SYN]                    = isDrawSyn(code);
+    features.flags[F_TO_YOUR_HAND_SYN]            = isToYourHandSyn(code);
+    features.flags[F_SPELL_SYN]                   = isSpellSyn(code);
+    features.flags[F_SPELL_ALL_SYN]               = isSpellAllSyn(code, text);
+    features.flags[F_WEAPON_SYN]                  = isWeaponSyn(code);
+    features.flags[F_WEAPON_ALL_SYN]              = isWeaponAllSyn(code, text);
+    features.flags[F_ENRAGE_SYN]                  = isEnrageSyn(code, text);
+    features.flags[F_OVERLOAD_SYN]                = isOverloadSyn(code, text);
+    features.flags[F_PING_SYN]                    = isPingSyn(code);
+    features.flags[F_AOE_SYN]                     = isAoeSyn(code);
+    features.flags[F_TAUNT_SYN]                   = isTauntSyn(code);
+    features.flags[F_TAUNT_ALL_SYN]               = isTauntAllSyn(code);
+    features.flags[F_SECRET_SYN]                  = isSecretSyn(code);
+    features.flags[F_SECRET_ALL_SYN]              = isSecretAllSyn(code, referencedTags);
+    features.flags[F_ECHO_SYN]                    = isEchoSyn(code);
+    features.flags[F_ECHO_ALL_SYN]                = isEchoAllSyn(code);
+    features.flags[F_RUSH_SYN]                    = isRushSyn(code);
+    features.flags[F_RUSH_ALL_SYN]                = isRushAllSyn(code);
+    features.flags[F_MAGNETIC_SYN]                = isMagneticSyn(code);
+    features.flags[F_MAGNETIC_ALL_SYN]            = isMagneticAllSyn(code);
+    features.flags[F_EGG_SYN]                     = isEggSyn(code, text);
+    features.flags[F_DAMAGE_FRIENDLY_HERO_SYN]    = isDamageFriendlyHeroSyn(code);
+    features.flags[F_FREEZE_ENEMY_SYN]            = isFreezeEnemySyn(code, referencedTags, text);
+    features.flags[F_DISCARD_SYN]                 = isDiscardSyn(code, text);
+    features.flags[F_DEATHRATTLE_SYN]             = isDeathrattleSyn(code);
+    features.flags[F_DEATHRATTLE_GOOD_ALL_SYN]    = isDeathrattleGoodAllSyn(code);
+    features.flags[F_BATTLECRY_SYN]               = isBattlecrySyn(code, referencedTags);
+    features.flags[F_SILENCE_OWN_SYN]             = isSilenceOwnSyn(code, mechanics);
+    features.flags[F_TAUNT_GIVER_SYN]             = isTauntGiverSyn(code, mechanics, attack, cardType);
+    features.flags[F_TOKEN_SYN]                   = isTokenSyn(code, text);
+    features.flags[F_TOKEN_CARD_SYN]              = isTokenCardSyn(code, text);
+    features.flags[F_COMBO_SYN]                   = isComboSyn(code, referencedTags);
+    features.flags[F_WINDFURY_MINION_SYN]         = isWindfuryMinionSyn(code);
+    features.flags[F_ATTACK_BUFF_SYN]             = isAttackBuffSyn(code, mechanics, attack, cardType);
+    features.flags[F_HEALTH_BUFF_SYN]             = isHealthBuffSyn(code);
+    features.flags[F_RETURN_SYN]                  = isReturnSyn(code, mechanics, cardType, text);
+    features.flags[F_STEALTH_SYN]                 = isStealthSyn(code);
+    features.flags[F_DIVINE_SHIELD_SYN]           = isDivineShieldSyn(code);
+    features.flags[F_DIVINE_SHIELD_ALL_SYN]       = isDivineShieldAllSyn(code);
+    features.flags[F_RESTORE_TARGET_MINION_SYN]   = isRestoreTargetMinionSyn(code);
+    features.flags[F_RESTORE_FRIENDLY_HERO_SYN]   = isRestoreFriendlyHeroSyn(code);
+    features.flags[F_RESTORE_FRIENDLY_MINION_SYN] = isRestoreFriendlyMinionSyn(code);
+    features.flags[F_ARMOR_SYN]                   = isArmorSyn(code);
+    features.flags[F_LIFESTEAL_MINION_SYN]        = isLifestealMinionSyn(code);
+    features.flags[F_SPELL_DAMAGE_SYN]            = isSpellDamageSyn(code, mechanics, cardType, text);
+    features.flags[F_EVOLVE_SYN]                  = isEvolveSyn(code);
+    features.flags[F_SPAWN_ENEMY_SYN]             = isSpawnEnemySyn(code);
+
+    features.numDiscover = static_cast<quint8>(numDiscoverGen(code, mechanics, referencedTags));
+    features.numDraw = static_cast<quint8>(numDrawGen(code, text));
+    features.numToYourHand = static_cast<quint8>(numToYourHandGen(code, text));
+    return features;
 }
 
 
@@ -258,6 +422,7 @@ void SynergyHandler::clearLists(bool keepCounters)
 {
     synergyCodes.clear();
     directLinks.clear();
+    cardFeatures.clear();
 
     if(!keepCounters)
     {
@@ -276,6 +441,8 @@ void SynergyHandler::clearLists(bool keepCounters)
             mechanicCounters[i]->reset();
         }
 
+        draftedCards.clear();
+
         //Reset stats maps
         costMinions.clear();
         attackMinions.clear();
@@ -358,77 +525,26 @@ int SynergyHandler::getCounters(QStringList &spellList, QStringList &minionList,
                                 QStringList &pingList, QStringList &damageList, QStringList &destroyList, QStringList &reachList,
                                 int &draw, int &toYourHand, int &discover)
 {
-    for(DeckCard &deckCard: cardTypeCounters[V_SPELL]->getDeckCardList())
+    for(const QString &code: cardTypeCounters[V_SPELL]->getCodes())
     {
-        QString code = deckCard.getCode();
-        if(DeckCard(code).getType() == SPELL)
-        {
-            for(int i=0; i<deckCard.total; i++)    spellList.append(code);
-        }
-    }
-    for(DeckCard &deckCard: cardTypeCounters[V_MINION]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    minionList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: cardTypeCounters[V_WEAPON]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    weaponList.append(deckCard.getCode());
+        if(DeckCard(code).getType() == SPELL)   spellList.append(code);
     }
+    minionList.append(cardTypeCounters[V_MINION]->getCodes());
+    weaponList.append(cardTypeCounters[V_WEAPON]->getCodes());
 
-
-    for(DeckCard &deckCard: mechanicCounters[V_AOE]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    aoeList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_TAUNT_ALL]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    tauntList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_SURVIVABILITY]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    survivabilityList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_DISCOVER_DRAW]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    drawList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_PING]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    pingList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_DAMAGE]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    damageList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_DESTROY]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    destroyList.append(deckCard.getCode());
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_REACH]->getDeckCardList())
-    {
-        for(int i=0; i<deckCard.total; i++)    reachList.append(deckCard.getCode());
-    }
+    aoeList.append(mechanicCounters[V_AOE]->getCodes());
+    tauntList.append(mechanicCounters[V_TAUNT_ALL]->getCodes());
+    survivabilityList.append(mechanicCounters[V_SURVIVABILITY]->getCodes());
+    drawList.append(mechanicCounters[V_DISCOVER_DRAW]->getCodes());
+    pingList.append(mechanicCounters[V_PING]->getCodes());
+    damageList.append(mechanicCounters[V_DAMAGE]->getCodes());
+    destroyList.append(mechanicCounters[V_DESTROY]->getCodes());
+    reachList.append(mechanicCounters[V_REACH]->getCodes());
 
     discover = draw = toYourHand = 0;
-    for(DeckCard &deckCard: mechanicCounters[V_DISCOVER]->getDeckCardList())
-    {
-        QString code = deckCard.getCode();
-        QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
-        QJsonArray referencedTags = Utility::getCardAttribute(code, "referencedTags").toArray();
-        discover += deckCard.total * numDiscoverGen(code, mechanics, referencedTags);
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_DRAW]->getDeckCardList())
-    {
-        QString code = deckCard.getCode();
-        QString text = Utility::cardEnTextFromCode(code).toLower();
-        draw += deckCard.total * numDrawGen(code, text);
-    }
-    for(DeckCard &deckCard: mechanicCounters[V_TOYOURHAND]->getDeckCardList())
-    {
-        QString code = deckCard.getCode();
-        QString text = Utility::cardEnTextFromCode(code).toLower();
-        toYourHand += deckCard.total * numToYourHandGen(code, text);
-    }
+    for(const QString &code: mechanicCounters[V_DISCOVER]->getCodes())      discover += getFeatures(code).numDiscover;
+    for(const QString &code: mechanicCounters[V_DRAW]->getCodes())          draw += getFeatures(code).numDraw;
+    for(const QString &code: mechanicCounters[V_TOYOURHAND]->getCodes())    toYourHand += getFeatures(code).numToYourHand;
 
     return manaCounter->count();
 }
@@ -445,6 +561,7 @@ void SynergyHandler::updateCounters(DeckCard &deckCard, QStringList &spellList,
                                     QStringList &pingList, QStringList &damageList, QStringList &destroyList, QStringList &reachList,
                                     int &draw, int &toYourHand, int &discover)
 {
+    draftedCards.add(deckCard.getCode());
     updateRaceCounters(deckCard);
     updateCardTypeCounters(deckCard, spellList, minionList, weaponList);
     updateManaCounter(deckCard);
@@ -463,83 +580,82 @@ void SynergyHandler::updateManaCounter(DeckCard &deckCard)
 void SynergyHandler::updateRaceCounters(DeckCard &deckCard)
 {
     QString code = deckCard.getCode();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
     CardRace cardRace = deckCard.getRace();
-    QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
+    const CardSynergyFeatures &features = getFeatures(code);
 
     if(cardRace == MURLOC)
     {
         raceCounters[V_MURLOC]->increase(code);
         raceCounters[V_MURLOC_ALL]->increase(code);
     }
-    else if(isMurlocGen(code))      raceCounters[V_MURLOC_ALL]->increase(code);
+    else if(features.has(F_MURLOC_GEN))     raceCounters[V_MURLOC_ALL]->increase(code);
     if(cardRace == DEMON)
     {
         raceCounters[V_DEMON]->increase(code);
         raceCounters[V_DEMON_ALL]->increase(code);
     }
-    else if(isDemonGen(code))       raceCounters[V_DEMON_ALL]->increase(code);
+    else if(features.has(F_DEMON_GEN))      raceCounters[V_DEMON_ALL]->increase(code);
     if(cardRace == MECHANICAL)
     {
         raceCounters[V_MECHANICAL]->increase(code);
         raceCounters[V_MECHANICAL_ALL]->increase(code);
     }
-    else if(isMechGen(code))        raceCounters[V_MECHANICAL_ALL]->increase(code);
+    else if(features.has(F_MECH_GEN))       raceCounters[V_MECHANICAL_ALL]->increase(code);
     if(cardRace == ELEMENTAL)
     {
         raceCounters[V_ELEMENTAL]->increase(code);
         raceCounters[V_ELEMENTAL_ALL]->increase(code);
     }
-    else if(isElementalGen(code))   raceCounters[V_ELEMENTAL_ALL]->increase(code);
+    else if(features.has(F_ELEMENTAL_GEN))  raceCounters[V_ELEMENTAL_ALL]->increase(code);
     if(cardRace == BEAST)
     {
         raceCounters[V_BEAST]->increase(code);
         raceCounters[V_BEAST_ALL]->increase(code);
     }
-    else if(isBeastGen(code))       raceCounters[V_BEAST_ALL]->increase(code);
+    else if(features.has(F_BEAST_GEN))      raceCounters[V_BEAST_ALL]->increase(code);
     if(cardRace == TOTEM)
     {
         raceCounters[V_TOTEM]->increase(code);
         raceCounters[V_TOTEM_ALL]->increase(code);
     }
-    else if(isTotemGen(code))       raceCounters[V_TOTEM_ALL]->increase(code);
+    else if(features.has(F_TOTEM_GEN))      raceCounters[V_TOTEM_ALL]->increase(code);
     if(cardRace == PIRATE)
     {
         raceCounters[V_PIRATE]->increase(code);
         raceCounters[V_PIRATE_ALL]->increase(code);
     }
-    else if(isPirateGen(code))      raceCounters[V_PIRATE_ALL]->increase(code);
+    else if(features.has(F_PIRATE_GEN))     raceCounters[V_PIRATE_ALL]->increase(code);
     if(cardRace == DRAGON)
     {
         raceCounters[V_DRAGON]->increase(code);
         raceCounters[V_DRAGON_ALL]->increase(code);
     }
-    else if(isDragonGen(code))      raceCounters[V_DRAGON_ALL]->increase(code);
+    else if(features.has(F_DRAGON_GEN))     raceCounters[V_DRAGON_ALL]->increase(code);
 
-    if(isMurlocSyn(code))                           raceCounters[V_MURLOC]->increaseSyn(code);
-    else if(isMurlocAllSyn(code, text))             raceCounters[V_MURLOC_ALL]->increaseSyn(code);
-    if(isDemonSyn(code))                            raceCounters[V_DEMON]->increaseSyn(code);
-    else if(isDemonAllSyn(code, text))              raceCounters[V_DEMON_ALL]->increaseSyn(code);
-    if(isMechSyn(code))                             raceCounters[V_MECHANICAL]->increaseSyn(code);
-    else if(isMechAllSyn(code, mechanics, text))    raceCounters[V_MECHANICAL_ALL]->increaseSyn(code);
-    if(isElementalSyn(code))                        raceCounters[V_ELEMENTAL]->increaseSyn(code);
-    else if(isElementalAllSyn(code, text))          raceCounters[V_ELEMENTAL_ALL]->increaseSyn(code);
-    if(isBeastSyn(code))                            raceCounters[V_BEAST]->increaseSyn(code);
-    else if(isBeastAllSyn(code, text))              raceCounters[V_BEAST_ALL]->increaseSyn(code);
-    if(isTotemSyn(code))                            raceCounters[V_TOTEM]->increaseSyn(code);
-    else if(isTotemAllSyn(code, text))              raceCounters[V_TOTEM_ALL]->increaseSyn(code);
-    if(isPirateSyn(code))                           raceCounters[V_PIRATE]->increaseSyn(code);
-    else if(isPirateAllSyn(code, text))             raceCounters[V_PIRATE_ALL]->increaseSyn(code);
-    if(isDragonSyn(code, text))                     raceCounters[V_DRAGON]->increaseSyn(code);
-    else if(isDragonAllSyn(code))                   raceCounters[V_DRAGON_ALL]->increaseSyn(code);
+    if(features.has(F_MURLOC_SYN))              raceCounters[V_MURLOC]->increaseSyn(code);
+    else if(features.has(F_MURLOC_ALL_SYN))     raceCounters[V_MURLOC_ALL]->increaseSyn(code);
+    if(features.has(F_DEMON_SYN))               raceCounters[V_DEMON]->increaseSyn(code);
+    else if(features.has(F_DEMON_ALL_SYN))      raceCounters[V_DEMON_ALL]->increaseSyn(code);
+    if(features.has(F_MECH_SYN))                raceCounters[V_MECHANICAL]->increaseSyn(code);
+    else if(features.has(F_MECH_ALL_SYN))       raceCounters[V_MECHANICAL_ALL]->increaseSyn(code);
+    if(features.has(F_ELEMENTAL_SYN))           raceCounters[V_ELEMENTAL]->increaseSyn(code);
+    else if(features.has(F_ELEMENTAL_ALL_SYN))  raceCounters[V_ELEMENTAL_ALL]->increaseSyn(code);
+    if(features.has(F_BEAST_SYN))               raceCounters[V_BEAST]->increaseSyn(code);
+    else if(features.has(F_BEAST_ALL_SYN))      raceCounters[V_BEAST_ALL]->increaseSyn(code);
+    if(features.has(F_TOTEM_SYN))               raceCounters[V_TOTEM]->increaseSyn(code);
+    else if(features.has(F_TOTEM_ALL_SYN))      raceCounters[V_TOTEM_ALL]->increaseSyn(code);
+    if(features.has(F_PIRATE_SYN))              raceCounters[V_PIRATE]->increaseSyn(code);
+    else if(features.has(F_PIRATE_ALL_SYN))     raceCounters[V_PIRATE_ALL]->increaseSyn(code);
+    if(features.has(F_DRAGON_SYN))              raceCounters[V_DRAGON]->increaseSyn(code);
+    else if(features.has(F_DRAGON_ALL_SYN))     raceCounters[V_DRAGON_ALL]->increaseSyn(code);
 }
 
 
 void SynergyHandler::updateCardTypeCounters(DeckCard &deckCard, QStringList &spellList, QStringList &minionList, QStringList &weaponList)
 {
     QString code = deckCard.getCode();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
     CardType cardType = deckCard.getType();
+    const CardSynergyFeatures &features = getFeatures(code);
 
     if(cardType == SPELL)
     {
@@ -547,7 +663,7 @@ void SynergyHandler::updateCardTypeCounters(DeckCard &deckCard, QStringList &spe
         cardTypeCounters[V_SPELL_ALL]->increase(code);
         spellList.append(code);
     }
-    else if(isSpellGen(code))           cardTypeCounters[V_SPELL_ALL]->increase(code);
+    else if(features.has(F_SPELL_GEN))  cardTypeCounters[V_SPELL_ALL]->increase(code);
     if(cardType == MINION || cardType == HERO)
     {
         cardTypeCounters[V_MINION]->increase(code);
@@ -559,13 +675,13 @@ void SynergyHandler::updateCardTypeCounters(DeckCard &deckCard, QStringList &spe
         cardTypeCounters[V_WEAPON_ALL]->increase(code);
         weaponList.append(code);
     }
-    else if(isWeaponGen(code, text))    cardTypeCounters[V_WEAPON_ALL]->increase(code);
+    else if(features.has(F_WEAPON_GEN)) cardTypeCounters[V_WEAPON_ALL]->increase(code);
 
 
-    if(isSpellSyn(code))                cardTypeCounters[V_SPELL]->increaseSyn(code);
-    else if(isSpellAllSyn(code, text))  cardTypeCounters[V_SPELL_ALL]->increaseSyn(code);
-    if(isWeaponSyn(code))               cardTypeCounters[V_WEAPON]->increaseSyn(code);
-    else if(isWeaponAllSyn(code, text)) cardTypeCounters[V_WEAPON_ALL]->increaseSyn(code);
+    if(features.has(F_SPELL_SYN))           cardTypeCounters[V_SPELL]->increaseSyn(code);
+    else if(features.has(F_SPELL_ALL_SYN))  cardTypeCounters[V_SPELL_ALL]->increaseSyn(code);
+    if(features.has(F_WEAPON_SYN))          cardTypeCounters[V_WEAPON]->increaseSyn(code);
+    else if(features.has(F_WEAPON_ALL_SYN)) cardTypeCounters[V_WEAPON_ALL]->increaseSyn(code);
 }
 
 
@@ -576,50 +692,45 @@ void SynergyHandler::updateMechanicCounters(DeckCard &deckCard,
 {
     bool isSurvivability = false;
     QString code = deckCard.getCode();
-    QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
-    QJsonArray referencedTags = Utility::getCardAttribute(code, "referencedTags").toArray();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
-    CardType cardType = deckCard.getType();
-    int attack = Utility::getCardAttribute(code, "attack").toInt();
-//    int cost = deckCard.getCost();
+    const CardSynergyFeatures &features = getFeatures(code);
 
     //GEN
-    if(isDiscoverDrawGen(code, mechanics, referencedTags, text))
+    if(features.has(F_DISCOVER_DRAW_GEN))
     {
         mechanicCounters[V_DISCOVER_DRAW]->increase(code);
         drawList.append(code);
     }
-    if(isAoeGen(code, text))
+    if(features.has(F_AOE_GEN))
     {
         mechanicCounters[V_AOE]->increase(code);
         aoeList.append(code);
     }
-    if(isPingGen(code, mechanics, referencedTags, text, cardType, attack))
+    if(features.has(F_PING_GEN))
     {
         mechanicCounters[V_PING]->increase(code);
         pingList.append(code);
     }
-    if(isDamageMinionsGen(code, mechanics, referencedTags, text, cardType, attack))
+    if(features.has(F_DAMAGE_MINIONS_GEN))
     {
         mechanicCounters[V_DAMAGE]->increase(code);
         damageList.append(code);
     }
-    if(isDestroyGen(code, mechanics, text))
+    if(features.has(F_DESTROY_GEN))
     {
         mechanicCounters[V_DESTROY]->increase(code);
         destroyList.append(code);
     }
-    if(isReachGen(code, mechanics, referencedTags, text, cardType, attack))
+    if(features.has(F_REACH_GEN))
     {
         mechanicCounters[V_REACH]->increase(code);
         reachList.append(code);
     }
-    if(isRestoreFriendlyHeroGen(code, mechanics, text))
+    if(features.has(F_RESTORE_FRIENDLY_HERO_GEN))
     {
         mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->increase(code);
         isSurvivability = true;
     }
-    if(isArmorGen(code, text))
+    if(features.has(F_ARMOR_GEN))
     {
         mechanicCounters[V_ARMOR]->increase(code);
         isSurvivability = true;
@@ -629,129 +740,129 @@ void SynergyHandler::updateMechanicCounters(DeckCard &deckCard,
         mechanicCounters[V_SURVIVABILITY]->increase(code);
         survivabilityList.append(code);
     }
-    discover = numDiscoverGen(code, mechanics, referencedTags);
-    draw = numDrawGen(code, text);
-    toYourHand = numToYourHandGen(code, text);
-    if(discover > 0)                                                        mechanicCounters[V_DISCOVER]->increase(code);
-    if(draw > 0)                                                            mechanicCounters[V_DRAW]->increase(code);
-    if(toYourHand > 0)                                                      mechanicCounters[V_TOYOURHAND]->increase(code);
-    if(isOverload(code))                                                    mechanicCounters[V_OVERLOAD]->increase(code);
-    if(isJadeGolemGen(code, mechanics, referencedTags))                     mechanicCounters[V_JADE_GOLEM]->increase(code);
-    if(isFreezeEnemyGen(code, mechanics, referencedTags, text))             mechanicCounters[V_FREEZE_ENEMY]->increase(code);
-    if(isDiscardGen(code, text))                                            mechanicCounters[V_DISCARD]->increase(code);
-    if(isDeathrattleMinion(code, mechanics, cardType))                      mechanicCounters[V_DEATHRATTLE]->increase(code);
-    if(isDeathrattleGoodAll(code, mechanics, referencedTags, cardType))     mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->increase(code);
-    if(isBattlecry(code, mechanics))                                        mechanicCounters[V_BATTLECRY]->increase(code);
-    if(isSilenceOwnGen(code, mechanics, referencedTags))                    mechanicCounters[V_SILENCE]->increase(code);
-    if(isTauntGiverGen(code))                                               mechanicCounters[V_TAUNT_GIVER]->increase(code);
-    if(isTokenGen(code, text))                                              mechanicCounters[V_TOKEN]->increase(code);
+    discover = features.numDiscover;
+    draw = features.numDraw;
+    toYourHand = features.numToYourHand;
+    if(discover > 0)                                mechanicCounters[V_DISCOVER]->increase(code);
+    if(draw > 0)                                    mechanicCounters[V_DRAW]->increase(code);
+    if(toYourHand > 0)                              mechanicCounters[V_TOYOURHAND]->increase(code);
+    if(features.has(F_OVERLOAD))                    mechanicCounters[V_OVERLOAD]->increase(code);
+    if(features.has(F_JADE_GOLEM_GEN))              mechanicCounters[V_JADE_GOLEM]->increase(code);
+    if(features.has(F_FREEZE_ENEMY_GEN))            mechanicCounters[V_FREEZE_ENEMY]->increase(code);
+    if(features.has(F_DISCARD_GEN))                 mechanicCounters[V_DISCARD]->increase(code);
+    if(features.has(F_DEATHRATTLE_MINION))          mechanicCounters[V_DEATHRATTLE]->increase(code);
+    if(features.has(F_DEATHRATTLE_GOOD_ALL))        mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->increase(code);
+    if(features.has(F_BATTLECRY))                   mechanicCounters[V_BATTLECRY]->increase(code);
+    if(features.has(F_SILENCE_OWN_GEN))             mechanicCounters[V_SILENCE]->increase(code);
+    if(features.has(F_TAUNT_GIVER_GEN))             mechanicCounters[V_TAUNT_GIVER]->increase(code);
+    if(features.has(F_TOKEN_GEN))                   mechanicCounters[V_TOKEN]->increase(code);
     //TokenCard es synergia debil
     //Evitamos que aparezcan token cards synergies en cada combo card
-//    if(isTokenCardGen(code, cost))                                          mechanicCounters[V_TOKEN_CARD]->increase(code);
-    if(isComboGen(code, mechanics))                                         mechanicCounters[V_COMBO]->increase(code);
-    if(isWindfuryMinion(code, mechanics, cardType))                         mechanicCounters[V_WINDFURY_MINION]->increase(code);
-    if(isAttackBuffGen(code, text))                                         mechanicCounters[V_ATTACK_BUFF]->increase(code);
-    if(isHealthBuffGen(code, text))                                         mechanicCounters[V_HEALTH_BUFF]->increase(code);
-    if(isReturnGen(code, text))                                             mechanicCounters[V_RETURN]->increase(code);
-    if(isStealthGen(code, mechanics))                                       mechanicCounters[V_STEALTH]->increase(code);
-    if(isSpellDamageGen(code))                                              mechanicCounters[V_SPELL_DAMAGE]->increase(code);
-    if(isEvolveGen(code, text))                                             mechanicCounters[V_EVOLVE]->increase(code);
-    if(isSpawnEnemyGen(code, text))                                         mechanicCounters[V_SPAWN_ENEMY]->increase(code);
-    if(isRestoreTargetMinionGen(code, text))                                mechanicCounters[V_RESTORE_TARGET_MINION]->increase(code);
-    if(isRestoreFriendlyMinionGen(code, text))                              mechanicCounters[V_RESTORE_FRIENDLY_MINION]->increase(code);
-    if(isLifestealMinon(code, mechanics, cardType))                         mechanicCounters[V_LIFESTEAL_MINION]->increase(code);
-    if(isEnrageGen(code, mechanics))                                        mechanicCounters[V_ENRAGED]->increase(code);
-    if(isEggGen(code, mechanics, attack, cardType))                         mechanicCounters[V_EGG]->increase(code);
-    if(isDamageFriendlyHeroGen(code))                                       mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->increase(code);
-    if(isTaunt(code, mechanics))
+//    if(features.has(F_TOKEN_CARD_GEN))            mechanicCounters[V_TOKEN_CARD]->increase(code);
+    if(features.has(F_COMBO_GEN))                   mechanicCounters[V_COMBO]->increase(code);
+    if(features.has(F_WINDFURY_MINION))             mechanicCounters[V_WINDFURY_MINION]->increase(code);
+    if(features.has(F_ATTACK_BUFF_GEN))             mechanicCounters[V_ATTACK_BUFF]->increase(code);
+    if(features.has(F_HEALTH_BUFF_GEN))             mechanicCounters[V_HEALTH_BUFF]->increase(code);
+    if(features.has(F_RETURN_GEN))                  mechanicCounters[V_RETURN]->increase(code);
+    if(features.has(F_STEALTH_GEN))                 mechanicCounters[V_STEALTH]->increase(code);
+    if(features.has(F_SPELL_DAMAGE_GEN))            mechanicCounters[V_SPELL_DAMAGE]->increase(code);
+    if(features.has(F_EVOLVE_GEN))                  mechanicCounters[V_EVOLVE]->increase(code);
+    if(features.has(F_SPAWN_ENEMY_GEN))             mechanicCounters[V_SPAWN_ENEMY]->increase(code);
+    if(features.has(F_RESTORE_TARGET_MINION_GEN))   mechanicCounters[V_RESTORE_TARGET_MINION]->increase(code);
+    if(features.has(F_RESTORE_FRIENDLY_MINION_GEN)) mechanicCounters[V_RESTORE_FRIENDLY_MINION]->increase(code);
+    if(features.has(F_LIFESTEAL_MINION))            mechanicCounters[V_LIFESTEAL_MINION]->increase(code);
+    if(features.has(F_ENRAGE_GEN))                  mechanicCounters[V_ENRAGED]->increase(code);
+    if(features.has(F_EGG_GEN))                     mechanicCounters[V_EGG]->increase(code);
+    if(features.has(F_DAMAGE_FRIENDLY_HERO_GEN))    mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->increase(code);
+    if(features.has(F_TAUNT))
     {
         mechanicCounters[V_TAUNT]->increase(code);
         mechanicCounters[V_TAUNT_ALL]->increase(code);
         tauntList.append(code);
     }
-    else if(isTauntGen(code, referencedTags))
+    else if(features.has(F_TAUNT_GEN))
     {
         mechanicCounters[V_TAUNT_ALL]->increase(code);
         tauntList.append(code);
     }
-    if(isDivineShield(code, mechanics))
+    if(features.has(F_DIVINE_SHIELD))
     {
         mechanicCounters[V_DIVINE_SHIELD]->increase(code);
         mechanicCounters[V_DIVINE_SHIELD_ALL]->increase(code);
     }
-    else if(isDivineShieldGen(code, referencedTags))                        mechanicCounters[V_DIVINE_SHIELD_ALL]->increase(code);
-    if(isSecret(code, mechanics))
+    else if(features.has(F_DIVINE_SHIELD_GEN))      mechanicCounters[V_DIVINE_SHIELD_ALL]->increase(code);
+    if(features.has(F_SECRET))
     {
         mechanicCounters[V_SECRET]->increase(code);
         mechanicCounters[V_SECRET_ALL]->increase(code);
     }
-    else if(isSecretGen(code))                                              mechanicCounters[V_SECRET_ALL]->increase(code);
-    if(isEcho(code, text))
+    else if(features.has(F_SECRET_GEN))             mechanicCounters[V_SECRET_ALL]->increase(code);
+    if(features.has(F_ECHO))
     {
         mechanicCounters[V_ECHO]->increase(code);
         mechanicCounters[V_ECHO_ALL]->increase(code);
     }
-    else if(isEchoGen(code))                                                mechanicCounters[V_ECHO_ALL]->increase(code);
-    if(isRush(code, text))
+    else if(features.has(F_ECHO_GEN))               mechanicCounters[V_ECHO_ALL]->increase(code);
+    if(features.has(F_RUSH))
     {
         mechanicCounters[V_RUSH]->increase(code);
         mechanicCounters[V_RUSH_ALL]->increase(code);
     }
-    else if(isRushGen(code))                                                mechanicCounters[V_RUSH_ALL]->increase(code);
-    if(isMagnetic(code, mechanics))
+    else if(features.has(F_RUSH_GEN))               mechanicCounters[V_RUSH_ALL]->increase(code);
+    if(features.has(F_MAGNETIC))
     {
         mechanicCounters[V_MAGNETIC]->increase(code);
         mechanicCounters[V_MAGNETIC_ALL]->increase(code);
     }
-    else if(isMagneticGen(code))                                            mechanicCounters[V_MAGNETIC_ALL]->increase(code);
+    else if(features.has(F_MAGNETIC_GEN))           mechanicCounters[V_MAGNETIC_ALL]->increase(code);
 
 
 
     //SYN
-    if(isAoeSyn(code))                                                      mechanicCounters[V_AOE]->increaseSyn(code);
-    if(isPingSyn(code))                                                     mechanicCounters[V_PING]->increaseSyn(code);
-    if(isDiscoverSyn(code))                                                 mechanicCounters[V_DISCOVER]->increaseSyn(code);
-    if(isDrawSyn(code))                                                     mechanicCounters[V_DRAW]->increaseSyn(code);
-    if(isToYourHandSyn(code))                                               mechanicCounters[V_TOYOURHAND]->increaseSyn(code);
-    if(isOverloadSyn(code, text))                                           mechanicCounters[V_OVERLOAD]->increaseSyn(code);
-    if(isFreezeEnemySyn(code, referencedTags, text))                        mechanicCounters[V_FREEZE_ENEMY]->increaseSyn(code);
-    if(isDiscardSyn(code, text))                                            mechanicCounters[V_DISCARD]->increaseSyn(code);
-    if(isBattlecrySyn(code, referencedTags))                                mechanicCounters[V_BATTLECRY]->increaseSyn(code);
-    if(isSilenceOwnSyn(code, mechanics))                                    mechanicCounters[V_SILENCE]->increaseSyn(code);
-    if(isTauntGiverSyn(code, mechanics, attack, cardType))                  mechanicCounters[V_TAUNT_GIVER]->increaseSyn(code);
-    if(isTokenSyn(code, text))                                              mechanicCounters[V_TOKEN]->increaseSyn(code);
-    if(isTokenCardSyn(code, text))                                          mechanicCounters[V_TOKEN_CARD]->increaseSyn(code);
-    if(isComboSyn(code, referencedTags))                                    mechanicCounters[V_COMBO]->increaseSyn(code);
-    if(isWindfuryMinionSyn(code))                                           mechanicCounters[V_WINDFURY_MINION]->increaseSyn(code);
-    if(isAttackBuffSyn(code, mechanics, attack, cardType))                  mechanicCounters[V_ATTACK_BUFF]->increaseSyn(code);
-    if(isHealthBuffSyn(code))                                               mechanicCounters[V_HEALTH_BUFF]->increaseSyn(code);
-    if(isReturnSyn(code, mechanics, cardType, text))                        mechanicCounters[V_RETURN]->increaseSyn(code);
-    if(isStealthSyn(code))                                                  mechanicCounters[V_STEALTH]->increaseSyn(code);
-    if(isSpellDamageSyn(code, mechanics, cardType, text))                   mechanicCounters[V_SPELL_DAMAGE]->increaseSyn(code);
-    if(isEvolveSyn(code))                                                   mechanicCounters[V_EVOLVE]->increaseSyn(code);
-    if(isSpawnEnemySyn(code))                                               mechanicCounters[V_SPAWN_ENEMY]->increaseSyn(code);
-    if(isRestoreTargetMinionSyn(code))                                      mechanicCounters[V_RESTORE_TARGET_MINION]->increaseSyn(code);
-    if(isRestoreFriendlyHeroSyn(code))                                      mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->increaseSyn(code);
-    if(isRestoreFriendlyMinionSyn(code))                                    mechanicCounters[V_RESTORE_FRIENDLY_MINION]->increaseSyn(code);
-    if(isLifestealMinionSyn(code))                                          mechanicCounters[V_LIFESTEAL_MINION]->increaseSyn(code);
-    if(isArmorSyn(code))                                                    mechanicCounters[V_ARMOR]->increaseSyn(code);
-    if(isEnrageSyn(code, text))                                             mechanicCounters[V_ENRAGED]->increaseSyn(code);
-    if(isEggSyn(code, text))                                                mechanicCounters[V_EGG]->increaseSyn(code);
-    if(isDamageFriendlyHeroSyn(code))                                       mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->increaseSyn(code);
-    if(isTauntSyn(code))                                                    mechanicCounters[V_TAUNT]->increaseSyn(code);
-    else if(isTauntAllSyn(code))                                            mechanicCounters[V_TAUNT_ALL]->increaseSyn(code);
-    if(isDeathrattleSyn(code))                                              mechanicCounters[V_DEATHRATTLE]->increaseSyn(code);
-    else if(isDeathrattleGoodAllSyn(code))                                  mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->increaseSyn(code);
-    if(isDivineShieldSyn(code))                                             mechanicCounters[V_DIVINE_SHIELD]->increaseSyn(code);
-    else if(isDivineShieldAllSyn(code))                                     mechanicCounters[V_DIVINE_SHIELD_ALL]->increaseSyn(code);
-    if(isSecretSyn(code))                                                   mechanicCounters[V_SECRET]->increaseSyn(code);
-    else if(isSecretAllSyn(code, referencedTags))                           mechanicCounters[V_SECRET_ALL]->increaseSyn(code);
-    if(isEchoSyn(code))                                                     mechanicCounters[V_ECHO]->increaseSyn(code);
-    else if(isEchoAllSyn(code))                                             mechanicCounters[V_ECHO_ALL]->increaseSyn(code);
-    if(isRushSyn(code))                                                     mechanicCounters[V_RUSH]->increaseSyn(code);
-    else if(isRushAllSyn(code))                                             mechanicCounters[V_RUSH_ALL]->increaseSyn(code);
-    if(isMagneticSyn(code))                                                 mechanicCounters[V_MAGNETIC]->increaseSyn(code);
-    else if(isMagneticAllSyn(code))                                         mechanicCounters[V_MAGNETIC_ALL]->increaseSyn(code);
+    if(features.has(F_AOE_SYN))                         mechanicCounters[V_AOE]->increaseSyn(code);
+    if(features.has(F_PING_SYN))                        mechanicCounters[V_PING]->increaseSyn(code);
+    if(features.has(F_DISCOVER_SYN))                    mechanicCounters[V_DISCOVER]->increaseSyn(code);
+    if(features.has(F_DRAW_SYN))                        mechanicCounters[V_DRAW]->increaseSyn(code);
+    if(features.has(F_TO_YOUR_HAND_SYN))                mechanicCounters[V_TOYOURHAND]->increaseSyn(code);
+    if(features.has(F_OVERLOAD_SYN))                    mechanicCounters[V_OVERLOAD]->increaseSyn(code);
+    if(features.has(F_FREEZE_ENEMY_SYN))                mechanicCounters[V_FREEZE_ENEMY]->increaseSyn(code);
+    if(features.has(F_DISCARD_SYN))                     mechanicCounters[V_DISCARD]->increaseSyn(code);
+    if(features.has(F_BATTLECRY_SYN))                   mechanicCounters[V_BATTLECRY]->increaseSyn(code);
+    if(features.has(F_SILENCE_OWN_SYN))                 mechanicCounters[V_SILENCE]->increaseSyn(code);
+    if(features.has(F_TAUNT_GIVER_SYN))                 mechanicCounters[V_TAUNT_GIVER]->increaseSyn(code);
+    if(features.has(F_TOKEN_SYN))                       mechanicCounters[V_TOKEN]->increaseSyn(code);
+    if(features.has(F_TOKEN_CARD_SYN))                  mechanicCounters[V_TOKEN_CARD]->increaseSyn(code);
+    if(features.has(F_COMBO_SYN))                       mechanicCounters[V_COMBO]->increaseSyn(code);
+    if(features.has(F_WINDFURY_MINION_SYN))             mechanicCounters[V_WINDFURY_MINION]->increaseSyn(code);
+    if(features.has(F_ATTACK_BUFF_SYN))                 mechanicCounters[V_ATTACK_BUFF]->increaseSyn(code);
+    if(features.has(F_HEALTH_BUFF_SYN))                 mechanicCounters[V_HEALTH_BUFF]->increaseSyn(code);
+    if(features.has(F_RETURN_SYN))                      mechanicCounters[V_RETURN]->increaseSyn(code);
+    if(features.has(F_STEALTH_SYN))                     mechanicCounters[V_STEALTH]->increaseSyn(code);
+    if(features.has(F_SPELL_DAMAGE_SYN))                mechanicCounters[V_SPELL_DAMAGE]->increaseSyn(code);
+    if(features.has(F_EVOLVE_SYN))                      mechanicCounters[V_EVOLVE]->increaseSyn(code);
+    if(features.has(F_SPAWN_ENEMY_SYN))                 mechanicCounters[V_SPAWN_ENEMY]->increaseSyn(code);
+    if(features.has(F_RESTORE_TARGET_MINION_SYN))       mechanicCounters[V_RESTORE_TARGET_MINION]->increaseSyn(code);
+    if(features.has(F_RESTORE_FRIENDLY_HERO_SYN))       mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->increaseSyn(code);
+    if(features.has(F_RESTORE_FRIENDLY_MINION_SYN))     mechanicCounters[V_RESTORE_FRIENDLY_MINION]->increaseSyn(code);
+    if(features.has(F_LIFESTEAL_MINION_SYN))            mechanicCounters[V_LIFESTEAL_MINION]->increaseSyn(code);
+    if(features.has(F_ARMOR_SYN))                       mechanicCounters[V_ARMOR]->increaseSyn(code);
+    if(features.has(F_ENRAGE_SYN))                      mechanicCounters[V_ENRAGED]->increaseSyn(code);
+    if(features.has(F_EGG_SYN))                         mechanicCounters[V_EGG]->increaseSyn(code);
+    if(features.has(F_DAMAGE_FRIENDLY_HERO_SYN))        mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->increaseSyn(code);
+    if(features.has(F_TAUNT_SYN))                       mechanicCounters[V_TAUNT]->increaseSyn(code);
+    else if(features.has(F_TAUNT_ALL_SYN))              mechanicCounters[V_TAUNT_ALL]->increaseSyn(code);
+    if(features.has(F_DEATHRATTLE_SYN))                 mechanicCounters[V_DEATHRATTLE]->increaseSyn(code);
+    else if(features.has(F_DEATHRATTLE_GOOD_ALL_SYN))   mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->increaseSyn(code);
+    if(features.has(F_DIVINE_SHIELD_SYN))               mechanicCounters[V_DIVINE_SHIELD]->increaseSyn(code);
+    else if(features.has(F_DIVINE_SHIELD_ALL_SYN))      mechanicCounters[V_DIVINE_SHIELD_ALL]->increaseSyn(code);
+    if(features.has(F_SECRET_SYN))                      mechanicCounters[V_SECRET]->increaseSyn(code);
+    else if(features.has(F_SECRET_ALL_SYN))             mechanicCounters[V_SECRET_ALL]->increaseSyn(code);
+    if(features.has(F_ECHO_SYN))                        mechanicCounters[V_ECHO]->increaseSyn(code);
+    else if(features.has(F_ECHO_ALL_SYN))               mechanicCounters[V_ECHO_ALL]->increaseSyn(code);
+    if(features.has(F_RUSH_SYN))                        mechanicCounters[V_RUSH]->increaseSyn(code);
+    else if(features.has(F_RUSH_ALL_SYN))               mechanicCounters[V_RUSH_ALL]->increaseSyn(code);
+    if(features.has(F_MAGNETIC_SYN))                    mechanicCounters[V_MAGNETIC]->increaseSyn(code);
+    else if(features.has(F_MAGNETIC_ALL_SYN))           mechanicCounters[V_MAGNETIC_ALL]->increaseSyn(code);
 }
 
 
@@ -762,8 +873,8 @@ void SynergyHandler::updateStatsCards(DeckCard &deckCard)
     if(deckCard.getType() == MINION)
     {
         //Stats
-        int attack = Utility::getCardAttribute(code, "attack").toInt();
-        int health = Utility::getCardAttribute(code, "health").toInt();
+        int attack = Utility::getAttackFromCode(code);
+        int health = Utility::getHealthFromCode(code);
 
         costMinions.appendStatValue(false, deckCard.getCost(), code);
         attackMinions.appendStatValue(false, attack, code);
@@ -776,8 +887,8 @@ void SynergyHandler::updateStatsCards(DeckCard &deckCard)
 //    else if(deckCard.getType() == WEAPON)
 //    {
 //        //Stats
-//        int attack = Utility::getCardAttribute(code, "attack").toInt();
-//        int health = Utility::getCardAttribute(code, "health").toInt();
+//        int attack = Utility::getAttackFromCode(code);
+//        int health = Utility::getHealthFromCode(code);
 
 //        costWeapons.appendStatValue(false, deckCard.getCost(), code);
 //        attackWeapons.appendStatValue(false, attack, code);
@@ -848,294 +959,291 @@ void SynergyHandler::updateStatsCards(DeckCard &deckCard)
 }
 
 
+//Cada contador marca sus ids de cartas draftadas y solo al final se pasan a codigos
 void SynergyHandler::getSynergies(DeckCard &deckCard, QMap<QString,int> &synergies, QMap<QString, int> &mechanicIcons)
 {
-    getCardTypeSynergies(deckCard, synergies);
-    getRaceSynergies(deckCard, synergies);
-    getMechanicSynergies(deckCard, synergies, mechanicIcons);
-    getDirectLinkSynergies(deckCard, synergies);
-    getStatsCardsSynergies(deckCard, synergies);
+    QBitArray synergyIds(draftedCards.count());
+    getCardTypeSynergies(deckCard, synergyIds);
+    getRaceSynergies(deckCard, synergyIds);
+    getMechanicSynergies(deckCard, synergyIds, mechanicIcons);
+    getDirectLinkSynergies(deckCard, synergyIds);
+    getStatsCardsSynergies(deckCard, synergyIds);
+    draftedCards.insertCards(synergyIds, synergies);
 }
 
 
-void SynergyHandler::getCardTypeSynergies(DeckCard &deckCard, QMap<QString,int> &synergies)
+void SynergyHandler::getCardTypeSynergies(DeckCard &deckCard, QBitArray &synergyIds)
 {
     QString code = deckCard.getCode();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
     CardType cardType = deckCard.getType();
+    const CardSynergyFeatures &features = getFeatures(code);
 
     //Evita mostrar spellSyn cards en cada hechizo que veamos
 //    if(cardType == SPELL)
 //    {
-//        cardTypeCounters[V_SPELL]->insertSynCards(synergies);
-//        cardTypeCounters[V_SPELL_ALL]->insertSynCards(synergies);
+//        cardTypeCounters[V_SPELL]->insertSynCards(synergyIds);
+//        cardTypeCounters[V_SPELL_ALL]->insertSynCards(synergyIds);
 //    }
-//    else if(isSpellGen(code))                   cardTypeCounters[V_SPELL_ALL]->insertSynCards(synergies);
+//    else if(features.has(F_SPELL_GEN))    cardTypeCounters[V_SPELL_ALL]->insertSynCards(synergyIds);
     if(cardType == WEAPON)
     {
-        cardTypeCounters[V_WEAPON]->insertSynCards(synergies);
-        cardTypeCounters[V_WEAPON_ALL]->insertSynCards(synergies);
+        cardTypeCounters[V_WEAPON]->insertSynCards(synergyIds);
+        cardTypeCounters[V_WEAPON_ALL]->insertSynCards(synergyIds);
     }
-    else if(isWeaponGen(code, text))            cardTypeCounters[V_WEAPON_ALL]->insertSynCards(synergies);
+    else if(features.has(F_WEAPON_GEN))     cardTypeCounters[V_WEAPON_ALL]->insertSynCards(synergyIds);
 
 
-    if(isSpellSyn(code))                        cardTypeCounters[V_SPELL]->insertCards(synergies);
-    else if(isSpellAllSyn(code, text))          cardTypeCounters[V_SPELL_ALL]->insertCards(synergies);
-    if(isWeaponSyn(code))                       cardTypeCounters[V_WEAPON]->insertCards(synergies);
-    else if(isWeaponAllSyn(code, text))         cardTypeCounters[V_WEAPON_ALL]->insertCards(synergies);
+    if(features.has(F_SPELL_SYN))           cardTypeCounters[V_SPELL]->insertCards(synergyIds);
+    else if(features.has(F_SPELL_ALL_SYN))  cardTypeCounters[V_SPELL_ALL]->insertCards(synergyIds);
+    if(features.has(F_WEAPON_SYN))          cardTypeCounters[V_WEAPON]->insertCards(synergyIds);
+    else if(features.has(F_WEAPON_ALL_SYN)) cardTypeCounters[V_WEAPON_ALL]->insertCards(synergyIds);
 }
 
 
-void SynergyHandler::getRaceSynergies(DeckCard &deckCard, QMap<QString,int> &synergies)
+void SynergyHandler::getRaceSynergies(DeckCard &deckCard, QBitArray &synergyIds)
 {
     QString code = deckCard.getCode();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
     CardRace cardRace = deckCard.getRace();
-    QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
+    const CardSynergyFeatures &features = getFeatures(code);
 
     if(cardRace == MURLOC)
     {
-        raceCounters[V_MURLOC]->insertSynCards(synergies);
-        raceCounters[V_MURLOC_ALL]->insertSynCards(synergies);
+        raceCounters[V_MURLOC]->insertSynCards(synergyIds);
+        raceCounters[V_MURLOC_ALL]->insertSynCards(synergyIds);
     }
-    else if(isMurlocGen(code))      raceCounters[V_MURLOC_ALL]->insertSynCards(synergies);
+    else if(features.has(F_MURLOC_GEN))     raceCounters[V_MURLOC_ALL]->insertSynCards(synergyIds);
     if(cardRace == DEMON)
     {
-        raceCounters[V_DEMON]->insertSynCards(synergies);
-        raceCounters[V_DEMON_ALL]->insertSynCards(synergies);
+        raceCounters[V_DEMON]->insertSynCards(synergyIds);
+        raceCounters[V_DEMON_ALL]->insertSynCards(synergyIds);
     }
-    else if(isDemonGen(code))       raceCounters[V_DEMON_ALL]->insertSynCards(synergies);
+    else if(features.has(F_DEMON_GEN))      raceCounters[V_DEMON_ALL]->insertSynCards(synergyIds);
     if(cardRace == MECHANICAL)
     {
-        raceCounters[V_MECHANICAL]->insertSynCards(synergies);
-        raceCounters[V_MECHANICAL_ALL]->insertSynCards(synergies);
+        raceCounters[V_MECHANICAL]->insertSynCards(synergyIds);
+        raceCounters[V_MECHANICAL_ALL]->insertSynCards(synergyIds);
     }
-    else if(isMechGen(code))        raceCounters[V_MECHANICAL_ALL]->insertSynCards(synergies);
+    else if(features.has(F_MECH_GEN))       raceCounters[V_MECHANICAL_ALL]->insertSynCards(synergyIds);
     if(cardRace == ELEMENTAL)
     {
-        raceCounters[V_ELEMENTAL]->insertSynCards(synergies);
-        raceCounters[V_ELEMENTAL_ALL]->insertSynCards(synergies);
+        raceCounters[V_ELEMENTAL]->insertSynCards(synergyIds);
+        raceCounters[V_ELEMENTAL_ALL]->insertSynCards(synergyIds);
     }
-    else if(isElementalGen(code))   raceCounters[V_ELEMENTAL_ALL]->insertSynCards(synergies);
+    else if(features.has(F_ELEMENTAL_GEN))  raceCounters[V_ELEMENTAL_ALL]->insertSynCards(synergyIds);
     if(cardRace == BEAST)
     {
-        raceCounters[V_BEAST]->insertSynCards(synergies);
-        raceCounters[V_BEAST_ALL]->insertSynCards(synergies);
+        raceCounters[V_BEAST]->insertSynCards(synergyIds);
+        raceCounters[V_BEAST_ALL]->insertSynCards(synergyIds);
     }
-    else if(isBeastGen(code))       raceCounters[V_BEAST_ALL]->insertSynCards(synergies);
+    else if(features.has(F_BEAST_GEN))      raceCounters[V_BEAST_ALL]->insertSynCards(synergyIds);
     if(cardRace == TOTEM)
     {
-        raceCounters[V_TOTEM]->insertSynCards(synergies);
-        raceCounters[V_TOTEM_ALL]->insertSynCards(synergies);
+        raceCounters[V_TOTEM]->insertSynCards(synergyIds);
+        raceCounters[V_TOTEM_ALL]->insertSynCards(synergyIds);
     }
-    else if(isTotemGen(code))       raceCounters[V_TOTEM_ALL]->insertSynCards(synergies);
+    else if(features.has(F_TOTEM_GEN))      raceCounters[V_TOTEM_ALL]->insertSynCards(synergyIds);
     if(cardRace == PIRATE)
     {
-        raceCounters[V_PIRATE]->insertSynCards(synergies);
-        raceCounters[V_PIRATE_ALL]->insertSynCards(synergies);
+        raceCounters[V_PIRATE]->insertSynCards(synergyIds);
+        raceCounters[V_PIRATE_ALL]->insertSynCards(synergyIds);
     }
-    else if(isPirateGen(code))      raceCounters[V_PIRATE_ALL]->insertSynCards(synergies);
+    else if(features.has(F_PIRATE_GEN))     raceCounters[V_PIRATE_ALL]->insertSynCards(synergyIds);
     if(cardRace == DRAGON)
     {
-        raceCounters[V_DRAGON]->insertSynCards(synergies);
-        raceCounters[V_DRAGON_ALL]->insertSynCards(synergies);
+        raceCounters[V_DRAGON]->insertSynCards(synergyIds);
+        raceCounters[V_DRAGON_ALL]->insertSynCards(synergyIds);
     }
-    else if(isDragonGen(code))      raceCounters[V_DRAGON_ALL]->insertSynCards(synergies);
+    else if(features.has(F_DRAGON_GEN))     raceCounters[V_DRAGON_ALL]->insertSynCards(synergyIds);
 
-    if(isMurlocSyn(code))                           raceCounters[V_MURLOC]->insertCards(synergies);
-    else if(isMurlocAllSyn(code, text))             raceCounters[V_MURLOC_ALL]->insertCards(synergies);
-    if(isDemonSyn(code))                            raceCounters[V_DEMON]->insertCards(synergies);
-    else if(isDemonAllSyn(code, text))              raceCounters[V_DEMON_ALL]->insertCards(synergies);
-    if(isMechSyn(code))                             raceCounters[V_MECHANICAL]->insertCards(synergies);
-    else if(isMechAllSyn(code, mechanics, text))    raceCounters[V_MECHANICAL_ALL]->insertCards(synergies);
-    if(isElementalSyn(code))                        raceCounters[V_ELEMENTAL]->insertCards(synergies);
-    else if(isElementalAllSyn(code, text))          raceCounters[V_ELEMENTAL_ALL]->insertCards(synergies);
-    if(isBeastSyn(code))                            raceCounters[V_BEAST]->insertCards(synergies);
-    else if(isBeastAllSyn(code, text))              raceCounters[V_BEAST_ALL]->insertCards(synergies);
-    if(isTotemSyn(code))                            raceCounters[V_TOTEM]->insertCards(synergies);
-    else if(isTotemAllSyn(code, text))              raceCounters[V_TOTEM_ALL]->insertCards(synergies);
-    if(isPirateSyn(code))                           raceCounters[V_PIRATE]->insertCards(synergies);
-    else if(isPirateAllSyn(code, text))             raceCounters[V_PIRATE_ALL]->insertCards(synergies);
-    if(isDragonSyn(code, text))                     raceCounters[V_DRAGON]->insertCards(synergies);
-    else if(isDragonAllSyn(code))                   raceCounters[V_DRAGON_ALL]->insertCards(synergies);
+    if(features.has(F_MURLOC_SYN))              raceCounters[V_MURLOC]->insertCards(synergyIds);
+    else if(features.has(F_MURLOC_ALL_SYN))     raceCounters[V_MURLOC_ALL]->insertCards(synergyIds);
+    if(features.has(F_DEMON_SYN))               raceCounters[V_DEMON]->insertCards(synergyIds);
+    else if(features.has(F_DEMON_ALL_SYN))      raceCounters[V_DEMON_ALL]->insertCards(synergyIds);
+    if(features.has(F_MECH_SYN))                raceCounters[V_MECHANICAL]->insertCards(synergyIds);
+    else if(features.has(F_MECH_ALL_SYN))       raceCounters[V_MECHANICAL_ALL]->insertCards(synergyIds);
+    if(features.has(F_ELEMENTAL_SYN))           raceCounters[V_ELEMENTAL]->insertCards(synergyIds);
+    else if(features.has(F_ELEMENTAL_ALL_SYN))  raceCounters[V_ELEMENTAL_ALL]->insertCards(synergyIds);
+    if(features.has(F_BEAST_SYN))               raceCounters[V_BEAST]->insertCards(synergyIds);
+    else if(features.has(F_BEAST_ALL_SYN))      raceCounters[V_BEAST_ALL]->insertCards(synergyIds);
+    if(features.has(F_TOTEM_SYN))               raceCounters[V_TOTEM]->insertCards(synergyIds);
+    else if(features.has(F_TOTEM_ALL_SYN))      raceCounters[V_TOTEM_ALL]->insertCards(synergyIds);
+    if(features.has(F_PIRATE_SYN))              raceCounters[V_PIRATE]->insertCards(synergyIds);
+    else if(features.has(F_PIRATE_ALL_SYN))     raceCounters[V_PIRATE_ALL]->insertCards(synergyIds);
+    if(features.has(F_DRAGON_SYN))              raceCounters[V_DRAGON]->insertCards(synergyIds);
+    else if(features.has(F_DRAGON_ALL_SYN))     raceCounters[V_DRAGON_ALL]->insertCards(synergyIds);
 }
 
 
-void SynergyHandler::getMechanicSynergies(DeckCard &deckCard, QMap<QString,int> &synergies, QMap<QString, int> &mechanicIcons)
+void SynergyHandler::getMechanicSynergies(DeckCard &deckCard, QBitArray &synergyIds, QMap<QString, int> &mechanicIcons)
 {
     QString code = deckCard.getCode();
-    QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
-    QJsonArray referencedTags = Utility::getCardAttribute(code, "referencedTags").toArray();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
-    CardType cardType = deckCard.getType();
-    int attack = Utility::getCardAttribute(code, "attack").toInt();
-    int cost = deckCard.getCost();
+    const CardSynergyFeatures &features = getFeatures(code);
     bool addRestoreIcon = false;
 
     //GEN
-    if(isDiscoverDrawGen(code, mechanics, referencedTags, text))
+    if(features.has(F_DISCOVER_DRAW_GEN))
     {
         mechanicIcons[ThemeHandler::drawMechanicFile()] = mechanicCounters[V_DISCOVER_DRAW]->count() + 1;
     }
-    if(isTaunt(code, mechanics))
+    if(features.has(F_TAUNT))
     {
-        mechanicCounters[V_TAUNT]->insertSynCards(synergies);
-        mechanicCounters[V_TAUNT_ALL]->insertSynCards(synergies);
+        mechanicCounters[V_TAUNT]->insertSynCards(synergyIds);
+        mechanicCounters[V_TAUNT_ALL]->insertSynCards(synergyIds);
         mechanicIcons[ThemeHandler::tauntMechanicFile()] = mechanicCounters[V_TAUNT_ALL]->count() + 1;
     }
-    else if(isTauntGen(code, referencedTags))
+    else if(features.has(F_TAUNT_GEN))
     {
-        mechanicCounters[V_TAUNT_ALL]->insertSynCards(synergies);
+        mechanicCounters[V_TAUNT_ALL]->insertSynCards(synergyIds);
         mechanicIcons[ThemeHandler::tauntMechanicFile()] = mechanicCounters[V_TAUNT_ALL]->count() + 1;
     }
-    if(isAoeGen(code, text))
+    if(features.has(F_AOE_GEN))
     {
-        mechanicCounters[V_AOE]->insertSynCards(synergies);
+        mechanicCounters[V_AOE]->insertSynCards(synergyIds);
         mechanicIcons[ThemeHandler::aoeMechanicFile()] = mechanicCounters[V_AOE]->count() + 1;
     }
-    if(isPingGen(code, mechanics, referencedTags, text, cardType, attack))
+    if(features.has(F_PING_GEN))
     {
-        mechanicCounters[V_PING]->insertSynCards(synergies);
+        mechanicCounters[V_PING]->insertSynCards(synergyIds);
         mechanicIcons[ThemeHandler::pingMechanicFile()] = mechanicCounters[V_PING]->count() + 1;
     }
-    if(isDamageMinionsGen(code, mechanics, referencedTags, text, cardType, attack))
+    if(features.has(F_DAMAGE_MINIONS_GEN))
     {
         mechanicIcons[ThemeHandler::damageMechanicFile()] = mechanicCounters[V_DAMAGE]->count() + 1;
     }
-    if(isDestroyGen(code, mechanics, text))
+    if(features.has(F_DESTROY_GEN))
     {
         mechanicIcons[ThemeHandler::destroyMechanicFile()] = mechanicCounters[V_DESTROY]->count() + 1;
     }
-    if(isReachGen(code, mechanics, referencedTags, text, cardType, attack))
+    if(features.has(F_REACH_GEN))
     {
         mechanicIcons[ThemeHandler::reachMechanicFile()] = mechanicCounters[V_REACH]->count() + 1;
     }
-    if(isArmorGen(code, text))
+    if(features.has(F_ARMOR_GEN))
     {
-        mechanicCounters[V_ARMOR]->insertSynCards(synergies);
+        mechanicCounters[V_ARMOR]->insertSynCards(synergyIds);
         addRestoreIcon = true;
     }
-    if(isRestoreFriendlyHeroGen(code, mechanics, text))
+    if(features.has(F_RESTORE_FRIENDLY_HERO_GEN))
     {
-        mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->insertSynCards(synergies);
+        mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->insertSynCards(synergyIds);
         addRestoreIcon = true;
     }
     if(addRestoreIcon)
     {
         mechanicIcons[ThemeHandler::survivalMechanicFile()] = mechanicCounters[V_SURVIVABILITY]->count() + 1;
     }
-    if(isRestoreTargetMinionGen(code, text))                    mechanicCounters[V_RESTORE_TARGET_MINION]->insertSynCards(synergies);
-    if(isRestoreFriendlyMinionGen(code, text))                  mechanicCounters[V_RESTORE_FRIENDLY_MINION]->insertSynCards(synergies);
-    if(isLifestealMinon(code, mechanics, cardType))             mechanicCounters[V_LIFESTEAL_MINION]->insertSynCards(synergies);
-    if(isJadeGolemGen(code, mechanics, referencedTags))         mechanicCounters[V_JADE_GOLEM]->insertCards(synergies);//Sinergias gen-gen
-    if(isDiscoverGen(code, mechanics, referencedTags))          mechanicCounters[V_DISCOVER]->insertSynCards(synergies);
-    if(isDrawGen(code, text))                                   mechanicCounters[V_DRAW]->insertSynCards(synergies);
-    if(isToYourHandGen(code, text))                             mechanicCounters[V_TOYOURHAND]->insertSynCards(synergies);
-    if(isOverload(code))                                        mechanicCounters[V_OVERLOAD]->insertSynCards(synergies);
-    if(isFreezeEnemyGen(code, mechanics, referencedTags, text)) mechanicCounters[V_FREEZE_ENEMY]->insertSynCards(synergies);
-    if(isDiscardGen(code, text))                                mechanicCounters[V_DISCARD]->insertSynCards(synergies);
-    if(isDeathrattleMinion(code, mechanics, cardType))          mechanicCounters[V_DEATHRATTLE]->insertSynCards(synergies);
-    if(isDeathrattleGoodAll(code, mechanics, referencedTags, cardType)) mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->insertSynCards(synergies);
-    if(isBattlecry(code, mechanics))                            mechanicCounters[V_BATTLECRY]->insertSynCards(synergies);
-    if(isSilenceOwnGen(code, mechanics, referencedTags))        mechanicCounters[V_SILENCE]->insertSynCards(synergies);
-    if(isTauntGiverGen(code))                                   mechanicCounters[V_TAUNT_GIVER]->insertSynCards(synergies);
-    if(isTokenGen(code, text))                                  mechanicCounters[V_TOKEN]->insertSynCards(synergies);
-    if(isTokenCardGen(code, cost))                              mechanicCounters[V_TOKEN_CARD]->insertSynCards(synergies);
-    if(isComboGen(code, mechanics))                             mechanicCounters[V_COMBO]->insertSynCards(synergies);
-    if(isWindfuryMinion(code, mechanics, cardType))             mechanicCounters[V_WINDFURY_MINION]->insertSynCards(synergies);
-    if(isAttackBuffGen(code, text))                             mechanicCounters[V_ATTACK_BUFF]->insertSynCards(synergies);
-    if(isHealthBuffGen(code, text))                             mechanicCounters[V_HEALTH_BUFF]->insertSynCards(synergies);
-    if(isReturnGen(code, text))                                 mechanicCounters[V_RETURN]->insertSynCards(synergies);
-    if(isStealthGen(code, mechanics))                           mechanicCounters[V_STEALTH]->insertSynCards(synergies);
-    if(isSpellDamageGen(code))                                  mechanicCounters[V_SPELL_DAMAGE]->insertSynCards(synergies);
-    if(isEvolveGen(code, text))                                 mechanicCounters[V_EVOLVE]->insertSynCards(synergies);
-    if(isSpawnEnemyGen(code, text))                             mechanicCounters[V_SPAWN_ENEMY]->insertSynCards(synergies);
-    if(isEnrageGen(code, mechanics))                            mechanicCounters[V_ENRAGED]->insertSynCards(synergies);
-    if(isEggGen(code, mechanics, attack, cardType))             mechanicCounters[V_EGG]->insertSynCards(synergies);
-    if(isDamageFriendlyHeroGen(code))                           mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->insertSynCards(synergies);
-    if(isDivineShield(code, mechanics))
-    {
-        mechanicCounters[V_DIVINE_SHIELD]->insertSynCards(synergies);
-        mechanicCounters[V_DIVINE_SHIELD_ALL]->insertSynCards(synergies);
-    }
-    else if(isDivineShieldGen(code, referencedTags))            mechanicCounters[V_DIVINE_SHIELD_ALL]->insertSynCards(synergies);
-
-    if(isSecret(code, mechanics))
-    {
-        mechanicCounters[V_SECRET]->insertSynCards(synergies);
-        mechanicCounters[V_SECRET_ALL]->insertSynCards(synergies);
-    }
-    else if(isSecretGen(code))                                  mechanicCounters[V_SECRET_ALL]->insertSynCards(synergies);
-    if(isEcho(code, text))
-    {
-        mechanicCounters[V_ECHO]->insertSynCards(synergies);
-        mechanicCounters[V_ECHO_ALL]->insertSynCards(synergies);
-    }
-    else if(isEchoGen(code))                                    mechanicCounters[V_ECHO_ALL]->insertSynCards(synergies);
-    if(isRush(code, text))
-    {
-        mechanicCounters[V_RUSH]->insertSynCards(synergies);
-        mechanicCounters[V_RUSH_ALL]->insertSynCards(synergies);
-    }
-    else if(isRushGen(code))                                    mechanicCounters[V_RUSH_ALL]->insertSynCards(synergies);
-    if(isMagnetic(code, mechanics))
-    {
-        mechanicCounters[V_MAGNETIC]->insertSynCards(synergies);
-        mechanicCounters[V_MAGNETIC_ALL]->insertSynCards(synergies);
-    }
-    else if(isMagneticGen(code))                                mechanicCounters[V_MAGNETIC_ALL]->insertSynCards(synergies);
+    if(features.has(F_RESTORE_TARGET_MINION_GEN))   mechanicCounters[V_RESTORE_TARGET_MINION]->insertSynCards(synergyIds);
+    if(features.has(F_RESTORE_FRIENDLY_MINION_GEN)) mechanicCounters[V_RESTORE_FRIENDLY_MINION]->insertSynCards(synergyIds);
+    if(features.has(F_LIFESTEAL_MINION))            mechanicCounters[V_LIFESTEAL_MINION]->insertSynCards(synergyIds);
+    if(features.has(F_JADE_GOLEM_GEN))              mechanicCounters[V_JADE_GOLEM]->insertCards(synergyIds);//Sinergias gen-gen
+    if(features.has(F_DISCOVER_GEN))                mechanicCounters[V_DISCOVER]->insertSynCards(synergyIds);
+    if(features.has(F_DRAW_GEN))                    mechanicCounters[V_DRAW]->insertSynCards(synergyIds);
+    if(features.has(F_TO_YOUR_HAND_GEN))            mechanicCounters[V_TOYOURHAND]->insertSynCards(synergyIds);
+    if(features.has(F_OVERLOAD))                    mechanicCounters[V_OVERLOAD]->insertSynCards(synergyIds);
+    if(features.has(F_FREEZE_ENEMY_GEN))            mechanicCounters[V_FREEZE_ENEMY]->insertSynCards(synergyIds);
+    if(features.has(F_DISCARD_GEN))                 mechanicCounters[V_DISCARD]->insertSynCards(synergyIds);
+    if(features.has(F_DEATHRATTLE_MINION))          mechanicCounters[V_DEATHRATTLE]->insertSynCards(synergyIds);
+    if(features.has(F_DEATHRATTLE_GOOD_ALL))        mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->insertSynCards(synergyIds);
+    if(features.has(F_BATTLECRY))                   mechanicCounters[V_BATTLECRY]->insertSynCards(synergyIds);
+    if(features.has(F_SILENCE_OWN_GEN))             mechanicCounters[V_SILENCE]->insertSynCards(synergyIds);
+    if(features.has(F_TAUNT_GIVER_GEN))             mechanicCounters[V_TAUNT_GIVER]->insertSynCards(synergyIds);
+    if(features.has(F_TOKEN_GEN))                   mechanicCounters[V_TOKEN]->insertSynCards(synergyIds);
+    if(features.has(F_TOKEN_CARD_GEN))              mechanicCounters[V_TOKEN_CARD]->insertSynCards(synergyIds);
+    if(features.has(F_COMBO_GEN))                   mechanicCounters[V_COMBO]->insertSynCards(synergyIds);
+    if(features.has(F_WINDFURY_MINION))             mechanicCounters[V_WINDFURY_MINION]->insertSynCards(synergyIds);
+    if(features.has(F_ATTACK_BUFF_GEN))             mechanicCounters[V_ATTACK_BUFF]->insertSynCards(synergyIds);
+    if(features.has(F_HEALTH_BUFF_GEN))             mechanicCounters[V_HEALTH_BUFF]->insertSynCards(synergyIds);
+    if(features.has(F_RETURN_GEN))                  mechanicCounters[V_RETURN]->insertSynCards(synergyIds);
+    if(features.has(F_STEALTH_GEN))                 mechanicCounters[V_STEALTH]->insertSynCards(synergyIds);
+    if(features.has(F_SPELL_DAMAGE_GEN))            mechanicCounters[V_SPELL_DAMAGE]->insertSynCards(synergyIds);
+    if(features.has(F_EVOLVE_GEN))                  mechanicCounters[V_EVOLVE]->insertSynCards(synergyIds);
+    if(features.has(F_SPAWN_ENEMY_GEN))             mechanicCounters[V_SPAWN_ENEMY]->insertSynCards(synergyIds);
+    if(features.has(F_ENRAGE_GEN))                  mechanicCounters[V_ENRAGED]->insertSynCards(synergyIds);
+    if(features.has(F_EGG_GEN))                     mechanicCounters[V_EGG]->insertSynCards(synergyIds);
+    if(features.has(F_DAMAGE_FRIENDLY_HERO_GEN))    mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->insertSynCards(synergyIds);
+    if(features.has(F_DIVINE_SHIELD))
+    {
+        mechanicCounters[V_DIVINE_SHIELD]->insertSynCards(synergyIds);
+        mechanicCounters[V_DIVINE_SHIELD_ALL]->insertSynCards(synergyIds);
+    }
+    else if(features.has(F_DIVINE_SHIELD_GEN))      mechanicCounters[V_DIVINE_SHIELD_ALL]->insertSynCards(synergyIds);
+
+    if(features.has(F_SECRET))
+    {
+        mechanicCounters[V_SECRET]->insertSynCards(synergyIds);
+        mechanicCounters[V_SECRET_ALL]->insertSynCards(synergyIds);
+    }
+    else if(features.has(F_SECRET_GEN))     mechanicCounters[V_SECRET_ALL]->insertSynCards(synergyIds);
+    if(features.has(F_ECHO))
+    {
+        mechanicCounters[V_ECHO]->insertSynCards(synergyIds);
+        mechanicCounters[V_ECHO_ALL]->insertSynCards(synergyIds);
+    }
+    else if(features.has(F_ECHO_GEN))       mechanicCounters[V_ECHO_ALL]->insertSynCards(synergyIds);
+    if(features.has(F_RUSH))
+    {
+        mechanicCounters[V_RUSH]->insertSynCards(synergyIds);
+        mechanicCounters[V_RUSH_ALL]->insertSynCards(synergyIds);
+    }
+    else if(features.has(F_RUSH_GEN))       mechanicCounters[V_RUSH_ALL]->insertSynCards(synergyIds);
+    if(features.has(F_MAGNETIC))
+    {
+        mechanicCounters[V_MAGNETIC]->insertSynCards(synergyIds);
+        mechanicCounters[V_MAGNETIC_ALL]->insertSynCards(synergyIds);
+    }
+    else if(features.has(F_MAGNETIC_GEN))   mechanicCounters[V_MAGNETIC_ALL]->insertSynCards(synergyIds);
 
 
     //SYN
-    if(isAoeSyn(code))                                          mechanicCounters[V_AOE]->insertCards(synergies);
-    if(isPingSyn(code))                                         mechanicCounters[V_PING]->insertCards(synergies);
-    if(isDiscoverSyn(code))                                     mechanicCounters[V_DISCOVER]->insertCards(synergies);
-    if(isDrawSyn(code))                                         mechanicCounters[V_DRAW]->insertCards(synergies);
-    if(isToYourHandSyn(code))                                   mechanicCounters[V_TOYOURHAND]->insertCards(synergies);
-    if(isOverloadSyn(code, text))                               mechanicCounters[V_OVERLOAD]->insertCards(synergies);
-    if(isFreezeEnemySyn(code, referencedTags, text))            mechanicCounters[V_FREEZE_ENEMY]->insertCards(synergies);
-    if(isDiscardSyn(code, text))                                mechanicCounters[V_DISCARD]->insertCards(synergies);
-    if(isBattlecrySyn(code, referencedTags))                    mechanicCounters[V_BATTLECRY]->insertCards(synergies);
-    if(isSilenceOwnSyn(code, mechanics))                        mechanicCounters[V_SILENCE]->insertCards(synergies);
-    if(isTauntGiverSyn(code, mechanics, attack, cardType))      mechanicCounters[V_TAUNT_GIVER]->insertCards(synergies);
-    if(isTokenSyn(code, text))                                  mechanicCounters[V_TOKEN]->insertCards(synergies);
-    if(isTokenCardSyn(code, text))                              mechanicCounters[V_TOKEN_CARD]->insertCards(synergies);
-    if(isComboSyn(code, referencedTags))                        mechanicCounters[V_COMBO]->insertCards(synergies);
-    if(isWindfuryMinionSyn(code))                               mechanicCounters[V_WINDFURY_MINION]->insertCards(synergies);
-    if(isAttackBuffSyn(code, mechanics, attack, cardType))      mechanicCounters[V_ATTACK_BUFF]->insertCards(synergies);
-    if(isHealthBuffSyn(code))                                   mechanicCounters[V_HEALTH_BUFF]->insertCards(synergies);
+    if(features.has(F_AOE_SYN))                         mechanicCounters[V_AOE]->insertCards(synergyIds);
+    if(features.has(F_PING_SYN))                        mechanicCounters[V_PING]->insertCards(synergyIds);
+    if(features.has(F_DISCOVER_SYN))                    mechanicCounters[V_DISCOVER]->insertCards(synergyIds);
+    if(features.has(F_DRAW_SYN))                        mechanicCounters[V_DRAW]->insertCards(synergyIds);
+    if(features.has(F_TO_YOUR_HAND_SYN))                mechanicCounters[V_TOYOURHAND]->insertCards(synergyIds);
+    if(features.has(F_OVERLOAD_SYN))                    mechanicCounters[V_OVERLOAD]->insertCards(synergyIds);
+    if(features.has(F_FREEZE_ENEMY_SYN))                mechanicCounters[V_FREEZE_ENEMY]->insertCards(synergyIds);
+    if(features.has(F_DISCARD_SYN))                     mechanicCounters[V_DISCARD]->insertCards(synergyIds);
+    if(features.has(F_BATTLECRY_SYN))                   mechanicCounters[V_BATTLECRY]->insertCards(synergyIds);
+    if(features.has(F_SILENCE_OWN_SYN))                 mechanicCounters[V_SILENCE]->insertCards(synergyIds);
+    if(features.has(F_TAUNT_GIVER_SYN))                 mechanicCounters[V_TAUNT_GIVER]->insertCards(synergyIds);
+    if(features.has(F_TOKEN_SYN))                       mechanicCounters[V_TOKEN]->insertCards(synergyIds);
+    if(features.has(F_TOKEN_CARD_SYN))                  mechanicCounters[V_TOKEN_CARD]->insertCards(synergyIds);
+    if(features.has(F_COMBO_SYN))                       mechanicCounters[V_COMBO]->insertCards(synergyIds);
+    if(features.has(F_WINDFURY_MINION_SYN))             mechanicCounters[V_WINDFURY_MINION]->insertCards(synergyIds);
+    if(features.has(F_ATTACK_BUFF_SYN))                 mechanicCounters[V_ATTACK_BUFF]->insertCards(synergyIds);
+    if(features.has(F_HEALTH_BUFF_SYN))                 mechanicCounters[V_HEALTH_BUFF]->insertCards(synergyIds);
     //returnSyn es synergia debil
-//    if(isReturnSyn(code, mechanics, cardType, text))            mechanicCounters[V_RETURN]->insertCards(synergies);
-    if(isStealthSyn(code))                                      mechanicCounters[V_STEALTH]->insertCards(synergies);
-    if(isSpellDamageSyn(code, mechanics, cardType, text))       mechanicCounters[V_SPELL_DAMAGE]->insertCards(synergies);
-    if(isEvolveSyn(code))                                       mechanicCounters[V_EVOLVE]->insertCards(synergies);
-    if(isSpawnEnemySyn(code))                                   mechanicCounters[V_SPAWN_ENEMY]->insertCards(synergies);
-    if(isRestoreTargetMinionSyn(code))                          mechanicCounters[V_RESTORE_TARGET_MINION]->insertCards(synergies);
-    if(isRestoreFriendlyHeroSyn(code))                          mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->insertCards(synergies);
-    if(isRestoreFriendlyMinionSyn(code))                        mechanicCounters[V_RESTORE_FRIENDLY_MINION]->insertCards(synergies);
-    if(isArmorSyn(code))                                        mechanicCounters[V_ARMOR]->insertCards(synergies);
-    if(isLifestealMinionSyn(code))                              mechanicCounters[V_LIFESTEAL_MINION]->insertCards(synergies);
-    if(isEnrageSyn(code, text))                                 mechanicCounters[V_ENRAGED]->insertCards(synergies);
-    if(isEggSyn(code, text))                                    mechanicCounters[V_EGG]->insertCards(synergies);
-    if(isDamageFriendlyHeroSyn(code))                           mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->insertCards(synergies);
-    if(isTauntSyn(code))                                        mechanicCounters[V_TAUNT]->insertCards(synergies);
-    else if(isTauntAllSyn(code))                                mechanicCounters[V_TAUNT_ALL]->insertCards(synergies);
-    if(isDeathrattleSyn(code))                                  mechanicCounters[V_DEATHRATTLE]->insertCards(synergies);
-    else if(isDeathrattleGoodAllSyn(code))                      mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->insertCards(synergies);
-    if(isDivineShieldSyn(code))                                 mechanicCounters[V_DIVINE_SHIELD]->insertCards(synergies);
-    else if(isDivineShieldAllSyn(code))                         mechanicCounters[V_DIVINE_SHIELD_ALL]->insertCards(synergies);
-    if(isSecretSyn(code))                                       mechanicCounters[V_SECRET]->insertCards(synergies);
-    else if(isSecretAllSyn(code, referencedTags))               mechanicCounters[V_SECRET_ALL]->insertCards(synergies);
-    if(isEchoSyn(code))                                         mechanicCounters[V_ECHO]->insertCards(synergies);
-    else if(isEchoAllSyn(code))                                 mechanicCounters[V_ECHO_ALL]->insertCards(synergies);
-    if(isRushSyn(code))                                         mechanicCounters[V_RUSH]->insertCards(synergies);
-    else if(isRushAllSyn(code))                                 mechanicCounters[V_RUSH_ALL]->insertCards(synergies);
-    if(isMagneticSyn(code))                                     mechanicCounters[V_MAGNETIC]->insertCards(synergies);
-    else if(isMagneticAllSyn(code))                             mechanicCounters[V_MAGNETIC_ALL]->insertCards(synergies);
-}
-
-
-void SynergyHandler::getDirectLinkSynergies(DeckCard &deckCard, QMap<QString,int> &synergies)
+//    if(features.has(F_RETURN_SYN))                    mechanicCounters[V_RETURN]->insertCards(synergyIds);
+    if(features.has(F_STEALTH_SYN))                     mechanicCounters[V_STEALTH]->insertCards(synergyIds);
+    if(features.has(F_SPELL_DAMAGE_SYN))                mechanicCounters[V_SPELL_DAMAGE]->insertCards(synergyIds);
+    if(features.has(F_EVOLVE_SYN))                      mechanicCounters[V_EVOLVE]->insertCards(synergyIds);
+    if(features.has(F_SPAWN_ENEMY_SYN))                 mechanicCounters[V_SPAWN_ENEMY]->insertCards(synergyIds);
+    if(features.has(F_RESTORE_TARGET_MINION_SYN))       mechanicCounters[V_RESTORE_TARGET_MINION]->insertCards(synergyIds);
+    if(features.has(F_RESTORE_FRIENDLY_HERO_SYN))       mechanicCounters[V_RESTORE_FRIENDLY_HEROE]->insertCards(synergyIds);
+    if(features.has(F_RESTORE_FRIENDLY_MINION_SYN))     mechanicCounters[V_RESTORE_FRIENDLY_MINION]->insertCards(synergyIds);
+    if(features.has(F_ARMOR_SYN))                       mechanicCounters[V_ARMOR]->insertCards(synergyIds);
+    if(features.has(F_LIFESTEAL_MINION_SYN))            mechanicCounters[V_LIFESTEAL_MINION]->insertCards(synergyIds);
+    if(features.has(F_ENRAGE_SYN))                      mechanicCounters[V_ENRAGED]->insertCards(synergyIds);
+    if(features.has(F_EGG_SYN))                         mechanicCounters[V_EGG]->insertCards(synergyIds);
+    if(features.has(F_DAMAGE_FRIENDLY_HERO_SYN))        mechanicCounters[V_DAMAGE_FRIENDLY_HERO]->insertCards(synergyIds);
+    if(features.has(F_TAUNT_SYN))                       mechanicCounters[V_TAUNT]->insertCards(synergyIds);
+    else if(features.has(F_TAUNT_ALL_SYN))              mechanicCounters[V_TAUNT_ALL]->insertCards(synergyIds);
+    if(features.has(F_DEATHRATTLE_SYN))                 mechanicCounters[V_DEATHRATTLE]->insertCards(synergyIds);
+    else if(features.has(F_DEATHRATTLE_GOOD_ALL_SYN))   mechanicCounters[V_DEATHRATTLE_GOOD_ALL]->insertCards(synergyIds);
+    if(features.has(F_DIVINE_SHIELD_SYN))               mechanicCounters[V_DIVINE_SHIELD]->insertCards(synergyIds);
+    else if(features.has(F_DIVINE_SHIELD_ALL_SYN))      mechanicCounters[V_DIVINE_SHIELD_ALL]->insertCards(synergyIds);
+    if(features.has(F_SECRET_SYN))                      mechanicCounters[V_SECRET]->insertCards(synergyIds);
+    else if(features.has(F_SECRET_ALL_SYN))             mechanicCounters[V_SECRET_ALL]->insertCards(synergyIds);
+    if(features.has(F_ECHO_SYN))                        mechanicCounters[V_ECHO]->insertCards(synergyIds);
+    else if(features.has(F_ECHO_ALL_SYN))               mechanicCounters[V_ECHO_ALL]->insertCards(synergyIds);
+    if(features.has(F_RUSH_SYN))                        mechanicCounters[V_RUSH]->insertCards(synergyIds);
+    else if(features.has(F_RUSH_ALL_SYN))               mechanicCounters[V_RUSH_ALL]->insertCards(synergyIds);
+    if(features.has(F_MAGNETIC_SYN))                    mechanicCounters[V_MAGNETIC]->insertCards(synergyIds);
+    else if(features.has(F_MAGNETIC_ALL_SYN))           mechanicCounters[V_MAGNETIC_ALL]->insertCards(synergyIds);
+}
+
+
+void SynergyHandler::getDirectLinkSynergies(DeckCard &deckCard, QBitArray &synergyIds)
 {
     QString code = deckCard.getCode();
 
@@ -1145,41 +1253,41 @@ void SynergyHandler::getDirectLinkSynergies(DeckCard &deckCard, QMap<QString,int
 
         for(QString linkCode: linkCodes)
         {
-            if(cardTypeCounters[V_MINION]->insertCode(linkCode, synergies)){}
-            else if(cardTypeCounters[V_WEAPON]->insertCode(linkCode, synergies)){}
-            else cardTypeCounters[V_SPELL]->insertCode(linkCode, synergies);
+            if(cardTypeCounters[V_MINION]->insertCode(linkCode, synergyIds)){}
+            else if(cardTypeCounters[V_WEAPON]->insertCode(linkCode, synergyIds)){}
+            else cardTypeCounters[V_SPELL]->insertCode(linkCode, synergyIds);
         }
     }
 }
 
 
-void SynergyHandler::getStatsCardsSynergies(DeckCard &deckCard, QMap<QString,int> &synergies)
+void SynergyHandler::getStatsCardsSynergies(DeckCard &deckCard, QBitArray &synergyIds)
 {
     QString code = deckCard.getCode();
 
     if(deckCard.getType() == MINION)
     {
         //Stats
-        int attack = Utility::getCardAttribute(code, "attack").toInt();
-        int health = Utility::getCardAttribute(code, "health").toInt();
+        int attack = Utility::getAttackFromCode(code);
+        int health = Utility::getHealthFromCode(code);
 
-        costMinions.insertCards(true, deckCard.getCost(), synergies);
-        attackMinions.insertCards(true, attack, synergies);
-        healthMinions.insertCards(true, health, synergies);
+        costMinions.insertCards(true, deckCard.getCost(), synergyIds);
+        attackMinions.insertCards(true, attack, synergyIds);
+        healthMinions.insertCards(true, health, synergyIds);
     }
     else if(deckCard.getType() == SPELL)
     {
-        costSpells.insertCards(true, deckCard.getCost(), synergies);
+        costSpells.insertCards(true, deckCard.getCost(), synergyIds);
     }
 //    else if(deckCard.getType() == WEAPON)
 //    {
 //        //Stats
-//        int attack = Utility::getCardAttribute(code, "attack").toInt();
-//        int health = Utility::getCardAttribute(code, "health").toInt();
+//        int attack = Utility::getAttackFromCode(code);
+//        int health = Utility::getHealthFromCode(code);
 
-//        costWeapons.insertCards(true, deckCard.getCost(), synergies);
-//        attackWeapons.insertCards(true, attack, synergies);
-//        healthWeapons.insertCards(true, health, synergies);
+//        costWeapons.insertCards(true, deckCard.getCost(), synergyIds);
+//        attackWeapons.insertCards(true, attack, synergyIds);
+//        healthWeapons.insertCards(true, health, synergyIds);
 //    }
 
     //Synergies
@@ -1192,16 +1300,16 @@ void SynergyHandler::getStatsCardsSynergies(DeckCard &deckCard, QMap<QString,int
                 switch(statSyn.statKind)
                 {
                     case S_COST:
-                        if(statSyn.isGen)   costMinions.insertCards(true, statSyn.statValue, synergies);
-                        else                costMinions.insertStatCards(statSyn, synergies);
+                        if(statSyn.isGen)   costMinions.insertCards(true, statSyn.statValue, synergyIds);
+                        else                costMinions.insertStatCards(statSyn, synergyIds);
                     break;
                     case S_ATTACK:
-                        if(statSyn.isGen)   attackMinions.insertCards(true, statSyn.statValue, synergies);
-                        else                attackMinions.insertStatCards(statSyn, synergies);
+                        if(statSyn.isGen)   attackMinions.insertCards(true, statSyn.statValue, synergyIds);
+                        else                attackMinions.insertStatCards(statSyn, synergyIds);
                     break;
                     case S_HEALTH:
-                        if(statSyn.isGen)   healthMinions.insertCards(true, statSyn.statValue, synergies);
-                        else                healthMinions.insertStatCards(statSyn, synergies);
+                        if(statSyn.isGen)   healthMinions.insertCards(true, statSyn.statValue, synergyIds);
+                        else                healthMinions.insertStatCards(statSyn, synergyIds);
                     break;
                 }
             break;
@@ -1209,8 +1317,8 @@ void SynergyHandler::getStatsCardsSynergies(DeckCard &deckCard, QMap<QString,int
                 switch(statSyn.statKind)
                 {
                     case S_COST:
-                        if(statSyn.isGen)   costSpells.insertCards(true, statSyn.statValue, synergies);
-                        else                costSpells.insertStatCards(statSyn, synergies);
+                        if(statSyn.isGen)   costSpells.insertCards(true, statSyn.statValue, synergyIds);
+                        else                costSpells.insertStatCards(statSyn, synergyIds);
                     break;
                     case S_ATTACK:
                     case S_HEALTH:
@@ -1221,16 +1329,16 @@ void SynergyHandler::getStatsCardsSynergies(DeckCard &deckCard, QMap<QString,int
 //                switch(statSyn.statKind)
 //                {
 //                    case S_COST:
-//                        if(statSyn.isGen)   costWeapons.insertCards(true, statSyn.statValue, synergies);
-//                        else                costWeapons.insertStatCards(statSyn, synergies);
+//                        if(statSyn.isGen)   costWeapons.insertCards(true, statSyn.statValue, synergyIds);
+//                        else                costWeapons.insertStatCards(statSyn, synergyIds);
 //                    break;
 //                    case S_ATTACK:
-//                        if(statSyn.isGen)   attackWeapons.insertCards(true, statSyn.statValue, synergies);
-//                        else                attackWeapons.insertStatCards(statSyn, synergies);
+//                        if(statSyn.isGen)   attackWeapons.insertCards(true, statSyn.statValue, synergyIds);
+//                        else                attackWeapons.insertStatCards(statSyn, synergyIds);
 //                    break;
 //                    case S_HEALTH:
-//                        if(statSyn.isGen)   healthWeapons.insertCards(true, statSyn.statValue, synergies);
-//                        else                healthWeapons.insertStatCards(statSyn, synergies);
+//                        if(statSyn.isGen)   healthWeapons.insertCards(true, statSyn.statValue, synergyIds);
+//                        else                healthWeapons.insertStatCards(statSyn, synergyIds);
 //                    break;
 //                }
             break;
@@ -1249,16 +1357,17 @@ void SynergyHandler::testSynergies()
 //    for(const QString &code: Utility::getWildCodes())
     {
         DeckCard deckCard(code);
+        const CardSynergyFeatures &features = getFeatures(code);
         CardType cardType = deckCard.getType();
         CardClass cardClass = deckCard.getCardClass();
-        QString text = Utility::cardEnTextFromCode(code).toLower();
-        int attack = Utility::getCardAttribute(code, "attack").toInt();
+        QString text = Utility::cardEnLowerTextFromCode(code);
+        int attack = Utility::getAttackFromCode(code);
         int cost = deckCard.getCost();
         QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
         QJsonArray referencedTags = Utility::getCardAttribute(code, "referencedTags").toArray();
         if(
 //                (text.contains("2-cost"))
-                isWeaponAllSyn(code, text) &&
+                features.has(F_WEAPON_ALL_SYN) &&
                 (cardClass == NEUTRAL || cardClass == ROGUE)
             )
         {
@@ -1303,8 +1412,8 @@ void SynergyHandler::debugSynergiesCode(const QString &code, int num)
     if(synergyCodes.contains(code)) manual<<synergyCodes[code];
     DeckCard deckCard(code);
     CardType cardType = deckCard.getType();
-    QString text = Utility::cardEnTextFromCode(code).toLower();
-    int attack = Utility::getCardAttribute(code, "attack").toInt();
+    QString text = Utility::cardEnLowerTextFromCode(code);
+    int attack = Utility::getAttackFromCode(code);
     int cost = deckCard.getCost();
     QJsonArray mechanics = Utility::getCardAttribute(code, "mechanics").toArray();
     QJsonArray referencedTags = Utility::getCardAttribute(code, "referencedTags").toArray();
@@ -1715,7 +1824,7 @@ bool SynergyHandler::isOverload(const QString &code)
     }
     else
     {
-        int overload = Utility::getCardAttribute(code, "overload").toInt();
+        int overload = Utility::getOverloadFromCode(code);
         return overload > 0;
     }
 }
@@ -2158,7 +2267,7 @@ bool SynergyHandler::isSpellDamageGen(const QString &code)
     }
     else
     {
-        int spellDamage = Utility::getCardAttribute(code, "spellDamage").toInt();
+        int spellDamage = Utility::getSpellDamageFromCode(code);
         return spellDamage > 0;
     }
 }
@@ -2435,7 +2544,7 @@ bool SynergyHandler::isOverloadSyn(const QString &code, const QString &text)
     }
     else if(text.contains("overload"))
     {
-        int overload = Utility::getCardAttribute(code, "overload").toInt();
+        int overload = Utility::getOverloadFromCode(code);
         return overload == 0;
     }
     return false;
@@ -2891,7 +3000,7 @@ int SynergyHandler::getCorrectedCardMana(DeckCard &deckCard)
     if(code == SEA_GIANT)           return 6;
     if(code == MULCHMUNCHER)        return 8;
 
-    int overload = Utility::getCardAttribute(code, "overload").toInt();
+    int overload = Utility::getOverloadFromCode(code);
     return std::min(10, deckCard.getCost()) + overload;
 }
 
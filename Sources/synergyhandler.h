@@ -5,6 +5,8 @@
 #include "Widgets/ui_extended.h"
 #include "Synergies/draftitemcounter.h"
 #include "Synergies/statsynergies.h"
+#include "Synergies/synergyfeatures.h"
+#include "Synergies/draftedcards.h"
 #include "utility.h"
 
 
@@ -19,6 +21,8 @@ public:
 private:
     Ui::Extended *ui;
     QMap<QString, QList<QString>> synergyCodes, directLinks;
+    QHash<QString, CardSynergyFeatures> cardFeatures;
+    DraftedCards draftedCards;
     StatSynergies costMinions, attackMinions, healthMinions, costSpells;
 //    StatSynergies costWeapons, attackWeapons, healthWeapons;
     DraftItemCounter **raceCounters, **cardTypeCounters, **mechanicCounters;
@@ -48,6 +52,8 @@ public:
 
 private:
     void createDraftItemCounters();
+    CardSynergyFeatures getFeatures(const QString &code);
+    CardSynergyFeatures computeFeatures(const QString &code);
     void deleteDraftItemCounters();
 
     void updateManaCounter(DeckCard &deckCard);
@@ -58,11 +64,11 @@ private:
                                 QStringList &pingList, QStringList &damageList, QStringList &destroyList, QStringList &reachList, int &draw, int &toYourHand, int &discover);
     void updateStatsCards(DeckCard &deckCard);
 
-    void getCardTypeSynergies(DeckCard &deckCard, QMap<QString, int> &synergies);
-    void getRaceSynergies(DeckCard &deckCard, QMap<QString, int> &synergies);
-    void getMechanicSynergies(DeckCard &deckCard, QMap<QString, int> &synergies, QMap<QString, int> &mechanicIcons);
-    void getDirectLinkSynergies(DeckCard &deckCard, QMap<QString, int> &synergies);
-    void getStatsCardsSynergies(DeckCard &deckCard, QMap<QString, int> &synergies);
+    void getCardTypeSynergies(DeckCard &deckCard, QBitArray &synergyIds);
+    void getRaceSynergies(DeckCard &deckCard, QBitArray &synergyIds);
+    void getMechanicSynergies(DeckCard &deckCard, QBitArray &synergyIds, QMap<QString, int> &mechanicIcons);
+    void getDirectLinkSynergies(DeckCard &deckCard, QBitArray &synergyIds);
+    void getStatsCardsSynergies(DeckCard &deckCard, QBitArray &synergyIds);
 
     bool isSpellGen(const QString &code);
     bool isWeaponGen(const QString &code, const QString &text);
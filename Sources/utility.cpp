@@ -1,17 +1,17 @@
 #include "utility.h"
 #include "themehandler.h"
+#include "Utils/screenlocator.h"
 #include <QtWidgets>
 #include "opencv2/opencv.hpp"
 #include "opencv2/core/core.hpp"
 #include "opencv2/features2d/features2d.hpp"
 #include "opencv2/highgui/highgui.hpp"
-#include "opencv2/nonfree/features2d.hpp"
 
 using namespace libzippp;
 using namespace std;
 
 
-QMap<QString, QJsonObject> * Utility::cardsJson = nullptr;
+QAtomicPointer<CardDB> Utility::cardDB(nullptr);
 QString Utility::localLang = "enUS";
 QString Utility::diacriticLetters;
 QStringList Utility::noDiacriticLetters;
@@ -170,77 +170,61 @@ LoadingScreenState Utility::getLoadingScreenFromString(QString loadingScreenStri
 
 QString Utility::cardEnNameFromCode(QString code)
 {
-    return (*cardsJson)[code].value("name").toObject().value("enUS").toString();
+    return db()->enName(code);
 }
 
 
 QString Utility::cardEnTextFromCode(QString code)
 {
-    return (*cardsJson)[code].value("text").toObject().value("enUS").toString();
+    return db()->enText(code);
 }
 
 
-QString Utility::cardEnCodeFromName(QString name, bool onlyCollectible)
+QString Utility::cardEnLowerTextFromCode(QString code)
 {
-    for (QMap<QString, QJsonObject>::const_iterator it = cardsJson->cbegin(); it != cardsJson->cend(); it++)
-    {
-        if(it->value("name").toObject().value("enUS").toString() == name)
-        {
-            if(!onlyCollectible || it->value("collectible").toBool())    return it.key();
-        }
-    }
+    return db()->enLowerText(code);
+}
 
-    return "";
+
+QString Utility::cardLocalNameFromCode(QString code)
+{
+    return db()->localName(code);
+}
+
+
+QString Utility::cardEnCodeFromName(QString name, bool onlyCollectible)
+{
+    return db()->codeFromEnName(name, onlyCollectible);
 }
 
 
 QString Utility::cardLocalCodeFromName(QString name)
 {
-    for (QMap<QString, QJsonObject>::const_iterator it = cardsJson->cbegin(); it != cardsJson->cend(); it++)
-    {
-        if(it->value("name").toObject().value(localLang).toString() == name)
-        {
-            if(!it->value("cost").isUndefined())    return it.key();
-        }
-    }
+    return db()->codeFromLocalName(name);
+}
 
-    return "";
+
+QString Utility::getCodeFromDbfId(int dbfId)
+{
+    return db()->codeFromDbfId(dbfId);
 }
 
 
 QJsonValue Utility::getCardAttribute(QString code, QString attribute)
 {
-    if(attribute == "text" || attribute == "name")
-    {
-        return (*cardsJson)[code].value(attribute).toObject().value(localLang);
-    }
-    else
-    {
-        return (*cardsJson)[code].value(attribute);
-    }
+    if(attribute == "name")         return db()->contains(code)?QJsonValue(db()->localName(code)):QJsonValue(QJsonValue::Undefined);
+    else if(attribute == "text")    return db()->contains(code)?QJsonValue(db()->localText(code)):QJsonValue(QJsonValue::Undefined);
+    else                            return db()->getJsonAttribute(code, attribute);
 }
 
 
 QString Utility::getCodeFromCardAttribute(QString attribute, QJsonValue value)
 {
-    if(attribute == "text" || attribute == "name")
+    for(const QString &code: db()->getCodes())
     {
-        for (QMap<QString, QJsonObject>::const_iterator it = cardsJson->cbegin(); it != cardsJson->cend(); it++)
+        if(getCardAttribute(code, attribute) == value)
         {
-            if(it->value(attribute).toObject().value(localLang) == value)
-            {
-                return it.key();
-            }
-        }
-    }
-    else
-    {
-        for (QMap<QString, QJsonObject>::const_iterator it = cardsJson->cbegin(); it != cardsJson->cend(); it++)
-        {
-            if(it->value(attribute) == value)
-            {
-                return it.key();
-            }
+            return code;
         }
     }
 
@@ -250,152 +234,142 @@ QString Utility::getCodeFromCardAttribute(QString attribute, QJsonValue value)
 
 CardType Utility::getTypeFromCode(QString code)
 {
-    QString value = Utility::getCardAttribute(code, "type").toString();
-    if(value == "MINION")           return MINION;
-    else if(value == "SPELL")       return SPELL;
-    else if(value == "WEAPON")      return WEAPON;
-    else if(value == "ENCHANTMENT") return ENCHANTMENT;
-    else if(value == "HERO")        return HERO;
-    else if(value == "HERO_POWER")  return HERO_POWER;
-    else                            return INVALID_TYPE;
+    return db()->type(code);
 }
 
 
 CardRarity Utility::getRarityFromCode(QString code)
 {
-    QString value = Utility::getCardAttribute(code, "rarity").toString();
-    if(value == "FREE")             return COMMON;
-    else if(value == "COMMON")      return COMMON;
-    else if(value == "RARE")        return RARE;
-    else if(value == "EPIC")        return EPIC;
-    else if(value == "LEGENDARY")   return LEGENDARY;
-    else                            return INVALID_RARITY;
+    return db()->rarity(code);
 }
 
 
 CardRace Utility::getRaceFromCode(QString code)
 {
-    QString value = Utility::getCardAttribute(code, "race").toString();
-    if(value == "BLOODELF")         return BLOODELF;
-    else if(value == "DRAENEI")     return DRAENEI;
-    else if(value == "DWARF")       return DWARF;
-    else if(value == "GNOME")       return GNOME;
-    else if(value == "GOBLIN")      return GOBLIN;
-    else if(value == "HUMAN")       return HUMAN;
-    else if(value == "NIGHTELF")    return NIGHTELF;
-    else if(value == "ORC")         return ORC;
-    else if(value == "TAUREN")      return TAUREN;
-    else if(value == "TROLL")       return TROLL;
-    else if(value == "UNDEAD")      return UNDEAD;
-    else if(value == "WORGEN")      return WORGEN;
-    else if(value == "GOBLIN2")     return GOBLIN2;
-    else if(value == "MURLOC")      return MURLOC;
-    else if(value == "DEMON")       return DEMON;
-    else if(value == "SCOURGE")     return SCOURGE;
-    else if(value == "MECHANICAL")  return MECHANICAL;
-    else if(value == "ELEMENTAL")   return ELEMENTAL;
-    else if(value == "OGRE")        return OGRE;
-    else if(value == "BEAST")       return BEAST;
-    else if(value == "TOTEM")       return TOTEM;
-    else if(value == "NERUBIAN")    return NERUBIAN;
-    else if(value == "PIRATE")      return PIRATE;
-    else if(value == "DRAGON")      return DRAGON;
-    else                            return INVALID_RACE;
+    return db()->race(code);
 }
 
 
 CardClass Utility::getClassFromCode(QString code)
 {
-    QString value = Utility::getCardAttribute(code, "cardClass").toString();
-    if(value == "")             return NEUTRAL;
-    else if(value == "NEUTRAL") return NEUTRAL;
-    else if(value == "DRUID")   return DRUID;
-    else if(value == "HUNTER")  return HUNTER;
-    else if(value == "MAGE")    return MAGE;
-    else if(value == "PALADIN") return PALADIN;
-    else if(value == "PRIEST")  return PRIEST;
-    else if(value == "ROGUE")   return ROGUE;
-    else if(value == "SHAMAN")  return SHAMAN;
-    else if(value == "WARLOCK") return WARLOCK;
-    else if(value == "WARRIOR") return WARRIOR;
-    else if(value == "DREAM")   return DREAM;
-    else                        return INVALID_CLASS;
+    return db()->cardClass(code);
 }
 
 
-bool Utility::isFromStandardSet(QString code)
+int Utility::getCostFromCode(QString code)
 {
-    QString cardSet = getCardAttribute(code, "set").toString();
+    return db()->cost(code);
+}
 
-    if( cardSet == "CORE" || cardSet == "EXPERT1" ||
-//        cardSet == "HOF" || cardSet == "NAXX" || cardSet == "GVG" ||
-//        cardSet == "BRM" || cardSet == "TGT" || cardSet == "LOE" ||
-//        cardSet == "OG" || cardSet == "KARA" || cardSet == "GANGS" ||
-        cardSet == "UNGORO" || cardSet == "ICECROWN" || cardSet == "LOOTAPALOOZA" ||
-        cardSet == "GILNEAS" || cardSet == "BOOMSDAY")
-    {
-        return true;
-    }
-    else
-    {
-        return false;
-    }
+
+int Utility::getAttackFromCode(QString code)
+{
+    return db()->attack(code);
 }
 
 
-bool Utility::isASecret(QString code)
+int Utility::getHealthFromCode(QString code)
 {
-    QJsonArray mechanics = getCardAttribute(code, "mechanics").toArray();
+    return db()->health(code);
+}
 
-    foreach(QJsonValue mechanic, mechanics)
-    {
-        if(mechanic.toString() == "SECRET") return true;
-    }
-    return false;
+
+int Utility::getDurabilityFromCode(QString code)
+{
+    return db()->durability(code);
+}
+
+
+int Utility::getArmorFromCode(QString code)
+{
+    return db()->armor(code);
+}
+
+
+int Utility::getOverloadFromCode(QString code)
+{
+    return db()->overload(code);
+}
+
+
+int Utility::getSpellDamageFromCode(QString code)
+{
+    return db()->spellDamage(code);
+}
+
+
+QString Utility::getSetFromCode(QString code)
+{
+    return db()->set(code);
+}
+
+
+int Utility::getDbfIdFromCode(QString code)
+{
+    return db()->dbfId(code);
+}
+
+
+bool Utility::isCollectible(QString code)
+{
+    return db()->isCollectible(code);
+}
+
+
+bool Utility::hasMechanic(QString code, QString mechanic)
+{
+    return db()->hasMechanic(code, mechanic);
+}
+
+
+bool Utility::hasReferencedTag(QString code, QString tag)
+{
+    return db()->hasReferencedTag(code, tag);
+}
+
+
+QStringList Utility::getStandardSets()
+{
+    return {"CORE", "EXPERT1",
+//            "HOF", "NAXX", "GVG",
+//            "BRM", "TGT", "LOE",
+//            "OG", "KARA", "GANGS",
+            "UNGORO", "ICECROWN", "LOOTAPALOOZA",
+            "GILNEAS", "BOOMSDAY"};
+}
+
+
+bool Utility::isFromStandardSet(QString code)
+{
+    static const QStringList standardSets = getStandardSets();
+    return standardSets.contains(db()->set(code));
+}
+
+
+bool Utility::isASecret(QString code)
+{
+    return db()->hasMechanic(code, "SECRET");
 }
 
 
 QStringList Utility::getSetCodes(const QString &set, bool onlyCollectible)
 {
-    QStringList setCodes;
-    for(const QString &code: Utility::cardsJson->keys())
-    {
-        if(getCardAttribute(code, "set").toString() == set)
-        {
-            if(!onlyCollectible || getCardAttribute(code, "collectible").toBool())
-            {
-                setCodes.append(code);
-            }
-        }
-    }
-    return setCodes;
+    return db()->getSetCodes(set, onlyCollectible);
 }
 
 
 QStringList Utility::getWildCodes()
 {
-    QStringList setCodes;
-    for(const QString &code: Utility::cardsJson->keys())
-    {
-        if(getCardAttribute(code, "collectible").toBool() == true)
-        {
-            setCodes.append(code);
-        }
-    }
-    return setCodes;
+    return db()->getCollectibleCodes();
 }
 
 
 QStringList Utility::getStandardCodes()
 {
     QStringList setCodes;
-    for(const QString &code: Utility::cardsJson->keys())
+    for(const QString &set: getStandardSets())
     {
-        if(Utility::isFromStandardSet(code) &&
-            (getCardAttribute(code, "collectible").toBool() == true))
-        {
-            setCodes.append(code);
-        }
+        setCodes.append(db()->getSetCodes(set, true));
     }
     return setCodes;
 }
@@ -456,15 +430,30 @@ QString Utility::themesPath()
 }
 
 
-void Utility::setCardsJson(QMap<QString, QJsonObject> *cardsJson)
+CardDB *Utility::db()
 {
-    Utility::cardsJson = cardsJson;
+    return cardDB.loadAcquire();
 }
 
 
+//El hilo del parser puede estar leyendo la CardDB anterior: quien la sustituye la borra en ese hilo (MainWindow::releaseCardDB)
+void Utility::setCardDB(CardDB *newCardDB)
+{
+    cardDB.storeRelease(newCardDB);
+}
+
+
+QString Utility::getLocalLang()
+{
+    return localLang;
+}
+
+
+//Se llama al leer log.config (LogLoader::init), antes de arrancar el hilo del parser
 void Utility::setLocalLang(QString localLang)
 {
     Utility::localLang = localLang;
+    if(db() != nullptr)   db()->setLocalLang(localLang);
 }
 
 
@@ -498,97 +487,7 @@ QString Utility::removeAccents(QString s)
 
 std::vector<Point2f> Utility::findTemplateOnScreen(QString templateImage, QScreen *screen, std::vector<Point2f> templatePoints, QPointF &screenScale)
 {
-    std::vector<Point2f> screenPoints;
-    QRect rect = screen->geometry();
-    QImage image = screen->grabWindow(0,rect.x(),rect.y(),rect.width(),rect.height()).toImage();
-
-    //Screen scale
-    screenScale.setX(rect.width() / static_cast<qreal>(image.width()));
-    screenScale.setY(rect.height() / static_cast<qreal>(image.height()));
-
-    cv::Mat mat(image.height(),image.width(),CV_8UC4,image.bits(), static_cast<size_t>(image.bytesPerLine()));
-    cv::Mat screenCapture = mat.clone();
-
-    Mat img_object = imread((Utility::extraPath() + "/" + templateImage).toStdString(), CV_LOAD_IMAGE_GRAYSCALE );
-    if(!img_object.data)
-    {
-        qDebug() << "Utility: Cannot find" << templateImage;
-        return screenPoints;
-    }
-    Mat img_scene;
-    cv::cvtColor(screenCapture, img_scene, CV_BGR2GRAY);
-
-    //-- Step 1: Detect the keypoints using SURF Detector
-    int minHessian = 400;
-
-    SurfFeatureDetector detector( minHessian );
-
-    std::vector<KeyPoint> keypoints_object, keypoints_scene;
-
-    detector.detect( img_object, keypoints_object );
-    detector.detect( img_scene, keypoints_scene );
-
-    //-- Step 2: Calculate descriptors (feature vectors)
-    SurfDescriptorExtractor extractor;
-
-    Mat descriptors_object, descriptors_scene;
-
-    extractor.compute( img_object, keypoints_object, descriptors_object );
-    extractor.compute( img_scene, keypoints_scene, descriptors_scene );
-
-    //-- Step 3: Matching descriptor vectors using FLANN matcher
-    FlannBasedMatcher matcher;
-    std::vector< DMatch > matches;
-    matcher.match( descriptors_object, descriptors_scene, matches );
-
-    double min_dist = 100;
-
-    //-- Quick calculation of max and min distances between keypoints
-    for( int i = 0; i < descriptors_object.rows; i++ )
-    { double dist = static_cast<double>(matches[static_cast<ulong>(i)].distance);
-      if( dist < min_dist ) min_dist = dist;
-    }
-
-    qDebug()<< "Utility: FLANN min dist:" <<min_dist;
-
-    //-- Draw only "good" matches (i.e. whose distance is less than 2*min_dist )
-    std::vector< DMatch > good_matches;
-
-    for( int i = 0; i < descriptors_object.rows; i++ )
-    { if( static_cast<double>(matches[static_cast<ulong>(i)].distance) < /*min(0.05,max(2*min_dist, 0.02))*/0.04 )
-       { good_matches.push_back( matches[static_cast<ulong>(i)]); }
-    }
-    qDebug()<< "Utility: FLANN Keypoints buenos:" <<good_matches.size();
-    if(good_matches.size() < 10)    return screenPoints;
-
-
-    //-- Localize the object (find homography)
-    std::vector<Point2f> obj;
-    std::vector<Point2f> scene;
-
-    for( uint i = 0; i < good_matches.size(); i++ )
-    {
-      //-- Get the keypoints from the good matches
-      obj.push_back( keypoints_object[ static_cast<ulong>(good_matches[i].queryIdx) ].pt );
-      scene.push_back( keypoints_scene[ static_cast<ulong>(good_matches[i].trainIdx) ].pt );
-    }
-
-    Mat H = findHomography( obj, scene, CV_RANSAC );
-
-    //-- Get the corners from the image_1 ( the object to be "detected" )
-    perspectiveTransform(templatePoints, screenPoints, H);
-
-    //Show matches
-    if(false)
-    {
-        Mat img_matches;
-        drawMatches( img_object, keypoints_object, img_scene, keypoints_scene,
-                     good_matches, img_matches, Scalar::all(-1), Scalar::all(-1),
-                     vector<char>(), DrawMatchesFlags::NOT_DRAW_SINGLE_POINTS );
-        imshow( "Good Matches & Object detection", img_matches );
-    }
-
-    return screenPoints;
+    return ScreenLocator::findTemplateOnScreen(templateImage, screen, templatePoints, screenScale);
 }
 
 
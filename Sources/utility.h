@@ -2,6 +2,7 @@
 #define UTILITY_H
 
 #include "Cards/deckcard.h"
+#include "Utils/carddb.h"
 #include "opencv2/opencv.hpp"
 #include "Utils/libzippp.h"
 #include <QString>
@@ -11,6 +12,7 @@
 #include <QNetworkRequest>
 #include <QScreen>
 #include <QPropertyAnimation>
+#include <QAtomicPointer>
 
 
 #define REMOVE_CARDS_ON_VERSION_UPDATE false
@@ -70,13 +72,16 @@ public:
 
 //Variables
 private:
-    static QMap<QString, QJsonObject> *cardsJson;
+    static QAtomicPointer<CardDB> cardDB;     //Se sustituye entera al recargar cards.json (setCardDB), nunca se modifica en uso
     static QString localLang;
     static QString diacriticLetters;
     static QStringList noDiacriticLetters;
 
 
 //Metodos
+private:
+    static CardDB *db();
+
 public:
     static QString heroToLogNumber(const QString &hero);
     static QString heroToLogNumber(CardClass cardClass);
@@ -95,7 +100,9 @@ public:
     static QString cardEnNameFromCode(QString code);
     static QString cardEnCodeFromName(QString name, bool onlyCollectible=true);
     static QString cardLocalCodeFromName(QString name);
-    static void setCardsJson(QMap<QString, QJsonObject> *cardsJson);
+    static QString getCodeFromDbfId(int dbfId);
+    static void setCardDB(CardDB *newCardDB);
+    static QString getLocalLang();
     static void setLocalLang(QString localLang);
     static QString removeAccents(QString s);
     static QPropertyAnimation *fadeInWidget(QWidget *widget);
@@ -109,6 +116,19 @@ public:
     static CardRarity getRarityFromCode(QString code);
     static CardClass getClassFromCode(QString code);
     static CardRace getRaceFromCode(QString code);
+    static int getCostFromCode(QString code);
+    static int getAttackFromCode(QString code);
+    static int getHealthFromCode(QString code);
+    static int getDurabilityFromCode(QString code);
+    static int getArmorFromCode(QString code);
+    static int getOverloadFromCode(QString code);
+    static int getSpellDamageFromCode(QString code);
+    static QString getSetFromCode(QString code);
+    static int getDbfIdFromCode(QString code);
+    static bool isCollectible(QString code);
+    static bool hasMechanic(QString code, QString mechanic);
+    static bool hasReferencedTag(QString code, QString tag);
+    static QStringList getStandardSets();
     static bool isFromStandardSet(QString code);
     static bool isASecret(QString code);
     static void dumpOnFile(const QByteArray &data, QString path);
@@ -117,6 +137,8 @@ public:
     static QString themesPath();
     static int heroLogNumber2HeroOrder(QString heroLog);
     static QString cardEnTextFromCode(QString code);
+    static QString cardEnLowerTextFromCode(QString code);
+    static QString cardLocalNameFromCode(QString code);
     static void clearLayout(QLayout *layout, bool deleteWidgets);
     static void showItemsLayout(QLayout *layout);
     static QStringList getSetCodes(const QString &set, bool onlyCollectible=true);